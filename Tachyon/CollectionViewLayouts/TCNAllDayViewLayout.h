@@ -4,12 +4,46 @@
 /**
  The default collection view layout for an all day event collection view.
 
+ Events are packed into the fewest rows, side by side where they cover different days. The days each event covers are
+ read from the delegate's @c collectionView:layout:daysForItemAtIndexPath:.
+
  For the layout used in the standard event collection view, refer to @c TCNDayViewLayout.
  */
 @interface TCNAllDayViewLayout : TCNDayViewLayout
 
 /**
- Asks for the required height for an all day view, given @c eventCount.
+ The number of days shown side by side, each an equal part of the width next to the time view.
+ Defaults to 1.
+ */
+@property (nonatomic, assign, readwrite) NSInteger numberOfDays;
+
+/**
+ The most rows to show, including a last row with the number of events on each day that don't fit, or 0 for no limit.
+ Defaults to 0.
+ */
+@property (nonatomic, assign, readwrite) NSInteger maximumRowCount;
+
+/**
+ The number of rows the events are packed into, including the row of events that don't fit if there is one.
+ */
+@property (nonatomic, assign, readonly) NSInteger rowCount;
+
+/**
+ The height needed to show @c rowCount rows, limited to a little over two rows unless @c maximumRowCount is set, in
+ which case every row is shown without scrolling.
+ */
+@property (nonatomic, assign, readonly) CGFloat allDayViewHeight;
+
+/**
+ The number of events covering @c day that don't fit under @c maximumRowCount.
+
+ @param day The index of a day shown.
+ @return The number of hidden events covering @c day, or 0 if they all fit.
+ */
+- (NSInteger)hiddenEventCountForDay:(NSInteger)day;
+
+/**
+ Asks for the required height for an all day view, given @c eventCount events that each cover every day.
 
  @param eventCount The number of events.
  @return A floating-point height for the all day view.
@@ -1,37 +1,226 @@
 #import "TCNAllDayViewLayout.h"
 #import "TCNDayViewLayout+Protected.h"
+#import "TCNDayViewLayoutInvalidationContext.h"
+#import "TCNAllDayRowEngine.h"
+#import "TCNAllDayOverflowView.h"
 #import "TCNNumberHelper.h"
 #import "TCNDayViewTimeView.h"
 #import "TCNDecorationViewLayoutAttributes.h"
 #import "TCNDayViewGridlineView.h"
 #import "TCNEventCell.h"
+#import "TCNMacros.h"
+
+@interface TCNAllDayViewLayout ()
+
+/**
+ Whether the events have to be packed into rows again before they are laid out, because they or the days changed.
+ */
+@property (nonatomic, assign, readwrite) BOOL needsRowPacking;
+
+/**
+ The @c TCNAllDayRowSpan of each item as the delegate gave it, and its row, or @c TCNAllDayRowNone if it isn't shown.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSData *itemSpans;
+@property (nonatomic, strong, nonnull, readwrite) NSData *itemRows;
+
+/**
+ The number of events on each day that don't fit in the rows, and the number of rows including the one showing them.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSData *overflowCounts;
+@property (nonatomic, assign, readwrite) NSInteger packedRowCount;
+
+/**
+ The overflow view of each day with events that don't fit, as of the last @c prepareLayout.
+ */
+@property (nonatomic, copy, nonnull, readwrite) NSArray<UICollectionViewLayoutAttributes *> *overflowAttributes;
+
+@end
 
 @implementation TCNAllDayViewLayout
 
 static const CGFloat TimeViewWidth = 56.0f;
+static const CGFloat EventRightInset = 2.0f;
 static const CGFloat AllDayViewMaximumHeight = 62.0f;
 static const CGFloat AllDayViewCellHeight = 22.0f;
 static const CGFloat AllDayViewVerticalPadding = 2.0f;
 static const UIEdgeInsets AllDayViewCellMargin = {2.0f, 0.0f, 2.0f, 2.0f};
+// A cell and its vertical margins
+static const CGFloat AllDayViewRowHeight = 26.0f;
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithConfig:(nonnull TCNDayViewConfig *)config {
+    self = [super initWithConfig:config];
+    if (!self) {
+        return nil;
+    }
+
+    _numberOfDays = 1;
+    _maximumRowCount = 0;
+    _needsRowPacking = YES;
+    _itemSpans = [[NSData alloc] init];
+    _itemRows = [[NSData alloc] init];
+    _overflowCounts = [[NSData alloc] init];
+    _overflowAttributes = [[NSArray alloc] init];
+
+    return self;
+}
+
+- (void)setNumberOfDays:(NSInteger)numberOfDays {
+    if (numberOfDays == _numberOfDays) {
+        return;
+    }
+    _numberOfDays = numberOfDays;
+    self.needsRowPacking = YES;
+    [self invalidateLayout];
+}
+
+- (void)setMaximumRowCount:(NSInteger)maximumRowCount {
+    if (maximumRowCount == _maximumRowCount) {
+        return;
+    }
+    _maximumRowCount = maximumRowCount;
+    self.needsRowPacking = YES;
+    [self invalidateLayout];
+}
 
 #pragma mark - Class helpers
 
 + (CGFloat)allDayViewHeightForEventCount:(NSInteger)eventCount {
-    CGFloat contentHeight = [self requiredAllDayViewContentHeightForEventCount:eventCount];
+    CGFloat contentHeight = [self requiredAllDayViewContentHeightForRowCount:eventCount];
     return MIN(contentHeight, AllDayViewMaximumHeight);
 }
 
-+ (CGFloat)requiredAllDayViewContentHeightForEventCount:(NSInteger)eventCount {
-    return (2 * AllDayViewVerticalPadding) + [self heightForNumberOfAllDayEvents:eventCount];
++ (CGFloat)requiredAllDayViewContentHeightForRowCount:(NSInteger)rowCount {
+    return (2 * AllDayViewVerticalPadding) + ((CGFloat)rowCount * AllDayViewRowHeight);
+}
+
+#pragma mark - Rows
+
+- (NSInteger)rowCount {
+    [self prepareRowsIfNeeded];
+    return self.packedRowCount;
+}
+
+- (CGFloat)allDayViewHeight {
+    const CGFloat contentHeight = [TCNAllDayViewLayout requiredAllDayViewContentHeightForRowCount:self.rowCount];
+    return self.maximumRowCount > 0 ? contentHeight : MIN(contentHeight, AllDayViewMaximumHeight);
 }
 
-+ (CGFloat)heightForNumberOfAllDayEvents:(NSInteger)eventCount {
-    const NSInteger numberOfVerticalEvents = (NSInteger)[TCNNumberHelper ceil:((CGFloat)eventCount) / 2];
-    return numberOfVerticalEvents * (AllDayViewCellHeight + AllDayViewCellMargin.top + AllDayViewCellMargin.bottom);
+- (NSInteger)hiddenEventCountForDay:(NSInteger)day {
+    [self prepareRowsIfNeeded];
+    if (day < 0 || (NSUInteger)day >= self.overflowCounts.length / sizeof(uint32_t)) {
+        return 0;
+    }
+    return ((const uint32_t *)self.overflowCounts.bytes)[day];
+}
+
+/**
+ Packs every event into rows if they or the days changed since they were last packed.
+ */
+- (void)prepareRowsIfNeeded {
+    if (!self.needsRowPacking) {
+        return;
+    }
+    self.needsRowPacking = NO;
+
+    UICollectionView *const collectionView = self.collectionView;
+    const NSInteger itemCount = collectionView.numberOfSections > 0 ? [collectionView numberOfItemsInSection:0] : 0;
+    const size_t count = (size_t)MAX(0, itemCount);
+    const NSInteger dayCount = MAX(1, self.numberOfDays);
+
+    // Events that don't say which days they cover cover all of them, like the all day view of a single day
+    id<TCNDayViewLayoutDelegate> const delegate = self.delegate;
+    const BOOL providesDays = [delegate respondsToSelector:@selector(collectionView:layout:daysForItemAtIndexPath:)];
+    NSMutableData *const spans = [[NSMutableData alloc] initWithLength:count * sizeof(TCNAllDayRowSpan)];
+    TCNAllDayRowSpan *const spanBytes = spans.mutableBytes;
+    for (NSInteger item = 0; item < itemCount; item++) {
+        if (providesDays) {
+            const NSRange days = [delegate collectionView:collectionView
+                                                   layout:self
+                                   daysForItemAtIndexPath:[NSIndexPath indexPathForItem:item inSection:0]];
+            spanBytes[item] = (TCNAllDayRowSpan){(int64_t)days.location, (int64_t)NSMaxRange(days) - 1};
+        } else {
+            spanBytes[item] = (TCNAllDayRowSpan){0, dayCount - 1};
+        }
+    }
+
+    NSMutableData *const rows = [[NSMutableData alloc] initWithLength:count * sizeof(uint32_t)];
+    NSMutableData *const overflowCounts = [[NSMutableData alloc] initWithLength:(NSUInteger)dayCount * sizeof(uint32_t)];
+    uint32_t rowCount = 0;
+    if (TCNAllDayRowEngineComputeRows(spanBytes,
+                                      count,
+                                      (size_t)dayCount,
+                                      (uint32_t)MAX(0, self.maximumRowCount),
+                                      rows.mutableBytes,
+                                      overflowCounts.mutableBytes,
+                                      &rowCount) != 0) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate row packing buffers for %ld all day events", (long)itemCount);
+        // Fall back to a row per event, which never overlaps
+        uint32_t *const rowBytes = rows.mutableBytes;
+        for (size_t item = 0; item < count; item++) {
+            rowBytes[item] = (uint32_t)item;
+        }
+        [overflowCounts resetBytesInRange:NSMakeRange(0, overflowCounts.length)];
+        rowCount = (uint32_t)count;
+    }
+
+    self.itemSpans = spans;
+    self.itemRows = rows;
+    self.overflowCounts = overflowCounts;
+    self.packedRowCount = (NSInteger)rowCount;
+}
+
+/**
+ Lays out an overflow view in the last row for each day with events that don't fit.
+ */
+- (void)prepareOverflowAttributes {
+    const NSInteger dayCount = MAX(1, self.numberOfDays);
+    const CGFloat calendarGridMinX = TimeViewWidth;
+    const CGFloat dayWidth = (CGRectGetWidth(self.collectionView.bounds) - EventRightInset - calendarGridMinX) / (CGFloat)dayCount;
+    const CGFloat overflowMinY = AllDayViewVerticalPadding + ((CGFloat)(self.rowCount - 1) * AllDayViewRowHeight) + AllDayViewCellMargin.top;
+
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const overflowAttributes = [[NSMutableArray alloc] init];
+    for (NSInteger day = 0; day < dayCount; day++) {
+        if ([self hiddenEventCountForDay:day] == 0) {
+            continue;
+        }
+        UICollectionViewLayoutAttributes *const attributes =
+        [UICollectionViewLayoutAttributes layoutAttributesForSupplementaryViewOfKind:TCNAllDayOverflowView.kind
+                                                                       withIndexPath:[NSIndexPath indexPathForItem:day inSection:0]];
+        attributes.frame = CGRectMake(calendarGridMinX + ((CGFloat)day * dayWidth) + AllDayViewCellMargin.left,
+                                      overflowMinY,
+                                      dayWidth - AllDayViewCellMargin.left - AllDayViewCellMargin.right,
+                                      AllDayViewCellHeight);
+        attributes.zIndex = [self zIndexForElementKind:TCNAllDayOverflowView.kind];
+        [overflowAttributes addObject:attributes];
+    }
+    self.overflowAttributes = overflowAttributes;
 }
 
 #pragma mark - UICollectionViewLayout
 
+- (void)invalidateLayoutWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+    // Any change to the events can move others between rows, so only invalidations that keep the events keep the rows
+    TCNDayViewLayoutInvalidationContext *const dayViewContext = TCN_CAST_OR_NIL(context, TCNDayViewLayoutInvalidationContext);
+    const BOOL keepsEvents = !context.invalidateEverything
+        && !context.invalidateDataSourceCounts
+        && (dayViewContext.invalidateVisibleSections
+            || dayViewContext.invalidateTimeScale
+            || dayViewContext.invalidateSectionWidth
+            || dayViewContext.invalidateDraggedEvent);
+    if (!keepsEvents) {
+        self.needsRowPacking = YES;
+    }
+
+    [super invalidateLayoutWithContext:context];
+}
+
+- (void)prepareLayout {
+    [super prepareLayout];
+    [self prepareOverflowAttributes];
+}
+
 - (nonnull UICollectionViewLayoutAttributes *)prepareLayoutForDarkGridlineWithIndexPath:(nonnull NSIndexPath *)indexPath
                                                                       calendarGridWidth:(__unused CGFloat)calendarGridWidth
                                                                        calendarGridMinX:(__unused CGFloat)calendarGridMinX
@@ -72,25 +261,79 @@ static const UIEdgeInsets AllDayViewCellMargin = {2.0f, 0.0f, 2.0f, 2.0f};
                                                                    calendarGridMinX:(CGFloat)calendarGridMinX
                                                                    calendarGridMinY:(__unused CGFloat)calendarGridMinY
                                                                    calendarGridMaxX:(CGFloat)calendarGridMaxX  {
+    [self prepareRowsIfNeeded];
     UICollectionViewLayoutAttributes *const itemAttributes = [UICollectionViewLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
+    itemAttributes.zIndex = [self zIndexForElementKind:TCNEventCell.reuseIdentifier];
+
+    // Events that don't fit are only counted in the last row
+    const NSUInteger item = (NSUInteger)indexPath.item;
+    const uint32_t row = item < self.itemRows.length / sizeof(uint32_t) ? ((const uint32_t *)self.itemRows.bytes)[item] : TCNAllDayRowNone;
+    if (row == TCNAllDayRowNone) {
+        itemAttributes.frame = CGRectZero;
+        itemAttributes.hidden = YES;
+        return itemAttributes;
+    }
 
-    const CGFloat heightOfPreviousRow = [TCNAllDayViewLayout heightForNumberOfAllDayEvents:MAX(0, indexPath.row - 1)];
-    const CGFloat itemMinY = AllDayViewVerticalPadding + heightOfPreviousRow + AllDayViewCellMargin.top;
-    const CGFloat itemMinX = calendarGridMinX + AllDayViewCellMargin.left;
-    const CGFloat itemWidth = calendarGridMaxX - calendarGridMinX - AllDayViewCellMargin.left - AllDayViewCellMargin.right;
+    const TCNAllDayRowSpan span = ((const TCNAllDayRowSpan *)self.itemSpans.bytes)[item];
+    const NSInteger dayCount = MAX(1, self.numberOfDays);
+    const NSInteger firstDay = (NSInteger)MAX(0, span.firstDay);
+    const NSInteger lastDay = (NSInteger)MIN(dayCount - 1, MAX(span.firstDay, span.lastDay));
+    const CGFloat dayWidth = (calendarGridMaxX - calendarGridMinX) / (CGFloat)dayCount;
+
+    const CGFloat itemMinY = AllDayViewVerticalPadding + ((CGFloat)row * AllDayViewRowHeight) + AllDayViewCellMargin.top;
+    const CGFloat itemMinX = calendarGridMinX + ((CGFloat)firstDay * dayWidth) + AllDayViewCellMargin.left;
+    const CGFloat itemWidth = ((CGFloat)(lastDay - firstDay + 1) * dayWidth) - AllDayViewCellMargin.left - AllDayViewCellMargin.right;
     itemAttributes.frame = CGRectMake(itemMinX, itemMinY, itemWidth, AllDayViewCellHeight);
-    itemAttributes.zIndex = [self zIndexForElementKind:TCNEventCell.reuseIdentifier];
 
     return itemAttributes;
 }
 
+- (nonnull UICollectionViewLayoutAttributes *)prepareLayoutForEventItemsAtIndexPath:(nonnull NSIndexPath *)indexPath
+                                                                          timeRange:(__unused TCNDayViewLayoutItemTimeRange)timeRange
+                                                                   calendarGridMinX:(CGFloat)calendarGridMinX
+                                                                   calendarGridMinY:(CGFloat)calendarGridMinY
+                                                                   calendarGridMaxX:(CGFloat)calendarGridMaxX {
+    // All day events are laid out by the days they cover, regardless of their times
+    return [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                      calendarGridMinX:calendarGridMinX
+                                      calendarGridMinY:calendarGridMinY
+                                      calendarGridMaxX:calendarGridMaxX];
+}
+
 - (CGSize)collectionViewContentSize {
-    const NSInteger eventCount = [self.collectionView numberOfItemsInSection:0];
-    const CGFloat height = [TCNAllDayViewLayout requiredAllDayViewContentHeightForEventCount:eventCount];
+    const CGFloat height = [TCNAllDayViewLayout requiredAllDayViewContentHeightForRowCount:self.rowCount];
     return CGSizeMake(self.collectionView.frame.size.width, height);
 }
 
+- (BOOL)eventItemFramesDependOnItemIndex {
+    // All day events are packed into rows together, so any event can move the others
+    return YES;
+}
+
+- (NSArray *)layoutAttributesForElementsInRect:(CGRect)rect {
+    NSArray *const attributes = [super layoutAttributesForElementsInRect:rect];
+    if (self.overflowAttributes.count == 0) {
+        return attributes;
+    }
+
+    NSMutableArray *const visibleAttributes = [attributes mutableCopy];
+    for (UICollectionViewLayoutAttributes *overflowAttributes in self.overflowAttributes) {
+        if (CGRectIntersectsRect(rect, overflowAttributes.frame)) {
+            [visibleAttributes addObject:overflowAttributes];
+        }
+    }
+    return visibleAttributes;
+}
+
 - (nullable UICollectionViewLayoutAttributes *)layoutAttributesForSupplementaryViewOfKind:(NSString *)elementKind atIndexPath:(NSIndexPath *)indexPath {
+    if ([elementKind isEqualToString:TCNAllDayOverflowView.kind]) {
+        for (UICollectionViewLayoutAttributes *overflowAttributes in self.overflowAttributes) {
+            if ([overflowAttributes.indexPath isEqual:indexPath]) {
+                return overflowAttributes;
+            }
+        }
+        return nil;
+    }
     if (indexPath.row > 0) {
         return nil;
     }
@@ -37,6 +37,12 @@
  */
 - (nonnull instancetype)initWithConfig:(nonnull TCNDatePickerConfig *)config NS_DESIGNATED_INITIALIZER;
 
+/**
+ Moves the selection indicator to the delegate's current @c selectedDateIndexPath, without invalidating the layout of
+ any item.
+ */
+- (void)invalidateSelectionIndicator;
+
 - (nonnull instancetype)initWithCoder:(nonnull NSCoder *)aDecoder NS_UNAVAILABLE;
 
 - (nonnull instancetype)init NS_UNAVAILABLE;
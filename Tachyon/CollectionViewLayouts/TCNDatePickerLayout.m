@@ -12,6 +12,13 @@
 
 @implementation TCNDatePickerLayout
 
+/**
+ There is a single selection indicator, so it keeps the same index path as it moves between items.
+ */
+static NSIndexPath *SelectionIndicatorIndexPath(void) {
+    return [NSIndexPath indexPathForItem:0 inSection:0];
+}
+
 - (instancetype)initWithConfig:(nonnull TCNDatePickerConfig *)config {
     self = [super init];
     if (!self) {
@@ -45,6 +52,22 @@
     return baseLayoutAttributes;
 }
 
+- (nullable UICollectionViewLayoutAttributes *)layoutAttributesForDecorationViewOfKind:(NSString *)elementKind atIndexPath:(NSIndexPath *)indexPath {
+    if ([elementKind isEqualToString:TCNDatePickerSelectionIndicatorView.reuseIdentifier]) {
+        return self.selectedItemAttributesCache;
+    }
+    return [super layoutAttributesForDecorationViewOfKind:elementKind atIndexPath:indexPath];
+}
+
+- (void)invalidateSelectionIndicator {
+    UICollectionViewFlowLayoutInvalidationContext *const context = [[UICollectionViewFlowLayoutInvalidationContext alloc] init];
+    context.invalidateFlowLayoutAttributes = NO;
+    context.invalidateFlowLayoutDelegateMetrics = NO;
+    [context invalidateDecorationElementsOfKind:TCNDatePickerSelectionIndicatorView.reuseIdentifier
+                                   atIndexPaths:@[SelectionIndicatorIndexPath()]];
+    [self invalidateLayoutWithContext:context];
+}
+
 - (void)prepareSelectedDayDecorationViewAttributes {
     NSIndexPath *const indexPath = [self.delegate selectedDateIndexPath];
     if (!indexPath) {
@@ -53,7 +76,7 @@
 
     TCNDecorationViewLayoutAttributes *const decorationAttributes =
     [TCNDecorationViewLayoutAttributes layoutAttributesForDecorationViewOfKind:TCNDatePickerSelectionIndicatorView.reuseIdentifier
-                                                                 withIndexPath:indexPath];
+                                                                 withIndexPath:SelectionIndicatorIndexPath()];
     decorationAttributes.frame = CGRectZero;
     UICollectionViewLayoutAttributes *const itemAttributes = [self layoutAttributesForItemAtIndexPath:indexPath];
     if (itemAttributes) {
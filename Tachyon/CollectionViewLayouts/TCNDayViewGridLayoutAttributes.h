@@ -0,0 +1,21 @@
+#import "TCNDecorationViewLayoutAttributes.h"
+
+/**
+ Layout attributes for a @c TCNDayViewGridView, holding the pre-rendered images of one section's time grid.
+ Frames are in the coordinate space of the grid view.
+ */
+@interface TCNDayViewGridLayoutAttributes : TCNDecorationViewLayoutAttributes
+
+/**
+ The column of hour labels, and where to display it.
+ */
+@property (nonatomic, strong, nullable, readwrite) UIImage *timeColumnImage;
+@property (nonatomic, assign, readwrite) CGRect timeColumnFrame;
+
+/**
+ One hour of gridlines, tiled over @c gridlineFrame starting at its top left corner.
+ */
+@property (nonatomic, strong, nullable, readwrite) UIImage *gridlinePatternImage;
+@property (nonatomic, assign, readwrite) CGRect gridlineFrame;
+
+@end
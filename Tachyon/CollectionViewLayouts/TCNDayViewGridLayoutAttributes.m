@@ -0,0 +1,32 @@
+#import "TCNDayViewGridLayoutAttributes.h"
+
+@implementation TCNDayViewGridLayoutAttributes
+
+- (id)copyWithZone:(NSZone *)zone {
+    TCNDayViewGridLayoutAttributes *const copy = [super copyWithZone:zone];
+    copy.backgroundColor = self.backgroundColor;
+    copy.timeColumnImage = self.timeColumnImage;
+    copy.timeColumnFrame = self.timeColumnFrame;
+    copy.gridlinePatternImage = self.gridlinePatternImage;
+    copy.gridlineFrame = self.gridlineFrame;
+    return copy;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (![object isKindOfClass:TCNDayViewGridLayoutAttributes.class] || ![super isEqual:object]) {
+        return NO;
+    }
+
+    // The images are shared between sections and day views, so comparing them by identity is enough
+    TCNDayViewGridLayoutAttributes *const other = object;
+    return self.timeColumnImage == other.timeColumnImage
+        && CGRectEqualToRect(self.timeColumnFrame, other.timeColumnFrame)
+        && self.gridlinePatternImage == other.gridlinePatternImage
+        && CGRectEqualToRect(self.gridlineFrame, other.gridlineFrame);
+}
+
+- (NSUInteger)hash {
+    return [super hash] ^ self.timeColumnImage.hash ^ self.gridlinePatternImage.hash;
+}
+
+@end
@@ -11,4 +11,11 @@
  */
 - (NSInteger)zIndexForElementKind:(nonnull NSString *)elementKind;
 
+/**
+ Whether an event item's frame depends on its index. If so, inserting or removing an event moves the items after it,
+ and every event is laid out again instead of only the overlap clusters it touches. Events are then laid out item by
+ item on the main thread, rather than from their time ranges by @c TCNEventGeometryEngine. Defaults to @c NO.
+ */
+@property (nonatomic, assign, readonly) BOOL eventItemFramesDependOnItemIndex;
+
 @end
@@ -1,8 +1,35 @@
 #import <UIKit/UIKit.h>
 #import "TCNDayViewConfig.h"
+#import "TCNDayViewLayoutSnapshot.h"
+#import "TCNPassMetrics.h"
 
 @class TCNDayViewLayout;
 
+#pragma mark - TCNDayViewLayoutItemTimeRange
+
+/**
+ The displayed time range of one event item, as returned in bulk by
+ @c collectionView:layout:getTimeRanges:forItemsInSection:count:.
+ */
+typedef struct {
+
+    /**
+     The displayed start time, in minutes since the start of the day view's day.
+     */
+    NSInteger startMinute;
+
+    /**
+     The displayed end time, in minutes since the start of the day view's day.
+     */
+    NSInteger endMinute;
+
+    /**
+     Equivalent to @c collectionView:layout:shouldAdjustLayoutForItemAtIndexPath: for this item.
+     */
+    BOOL shouldAdjustLayout;
+
+} TCNDayViewLayoutItemTimeRange;
+
 #pragma mark - TCNDayViewLayoutDelegate
 
 /**
@@ -49,6 +76,64 @@
                                 layout:(nonnull TCNDayViewLayout *)collectionViewLayout
   shouldAdjustLayoutForItemAtIndexPath:(nonnull NSIndexPath *)indexPath;
 
+@optional
+
+/**
+ Asks for the time ranges of every event in a section at once. When implemented, the layout reads its input for a full
+ layout pass from this method instead of asking for each item's start time, end time and adjustment separately.
+
+ @param collectionView The calling collection view.
+ @param collectionViewLayout The calling layout.
+ @param timeRanges A buffer with room for @c count time ranges, one per item, to be filled in item order.
+ @param section The section whose items are being laid out.
+ @param count The number of items in @c section.
+ @return YES if @c timeRanges was filled, or NO to have the layout ask for each item separately instead.
+ */
+- (BOOL)collectionView:(nullable UICollectionView *)collectionView
+                layout:(nonnull TCNDayViewLayout *)collectionViewLayout
+         getTimeRanges:(nonnull TCNDayViewLayoutItemTimeRange *)timeRanges
+     forItemsInSection:(NSInteger)section
+                 count:(NSInteger)count;
+
+/**
+ Asks for the days the all day event at the given index path covers, as indexes of the days shown by a
+ @c TCNAllDayViewLayout. Events that share no day can share a row. Only asked by @c TCNAllDayViewLayout, which treats
+ every event as covering every day if this isn't implemented.
+
+ @param collectionView The calling collection view.
+ @param collectionViewLayout The calling layout.
+ @param indexPath The index path for which to return information.
+ @return The range of days the event covers, where a length of 0 covers only the first day.
+ */
+- (NSRange)collectionView:(nullable UICollectionView *)collectionView
+                   layout:(nonnull TCNDayViewLayout *)collectionViewLayout
+   daysForItemAtIndexPath:(nonnull NSIndexPath *)indexPath;
+
+/**
+ Asks for an identifier of the event at the given index path that stays the same across launches. Layout snapshots
+ record it, so that a snapshot isn't mistaken for current when its events were replaced by others at the same times.
+
+ @param collectionView The calling collection view.
+ @param collectionViewLayout The calling layout.
+ @param indexPath The index path for which to return information.
+ @return A string identifying the event.
+ */
+- (nonnull NSString *)collectionView:(nullable UICollectionView *)collectionView
+                              layout:(nonnull TCNDayViewLayout *)collectionViewLayout
+        identifierForItemAtIndexPath:(nonnull NSIndexPath *)indexPath;
+
+/**
+ Called after each @c prepareLayout, overlap adjustment and @c layoutAttributesForElementsInRect: pass while
+ @c measuresPasses is YES.
+
+ @param collectionView The calling collection view.
+ @param collectionViewLayout The calling layout.
+ @param metrics The measurements of the pass.
+ */
+- (void)collectionView:(nullable UICollectionView *)collectionView
+                layout:(nonnull TCNDayViewLayout *)collectionViewLayout
+        didMeasurePass:(nonnull TCNPassMetrics *)metrics;
+
 @end
 
 #pragma mark - TCNDayViewLayout
@@ -70,6 +155,45 @@
  */
 @property (nonatomic, weak, nullable, readwrite) id<TCNDayViewLayoutDelegate> delegate;
 
+/**
+ The width of each section. Defaults to 0, which makes each section as wide as the collection view.
+
+ Only the sections in or next to the visible area are laid out, so many narrow sections can be scrolled horizontally
+ without laying out the ones off screen.
+ */
+@property (nonatomic, assign, readwrite) CGFloat columnWidth;
+
+/**
+ Whether each section's hour labels and gridlines are shown by a single @c TCNDayViewGridView decoration view, drawn
+ from images shared by every layout with the same config, instead of a @c TCNDayViewTimeView supplementary view per hour
+ and a @c TCNDayViewGridlineView decoration view per gridline. Defaults to NO.
+
+ The collection view must register @c TCNDayViewGridView for the decoration view kind @c TCNDayViewGridView.kind.
+ */
+@property (nonatomic, assign, readwrite) BOOL rendersStaticGrid;
+
+/**
+ The width of an event item that doesn't share its section's width with any overlapping event, or 0 before the
+ collection view has a width. Content can be prepared for this width ahead of layout.
+ */
+@property (nonatomic, assign, readonly) CGFloat fullEventItemWidth;
+
+/**
+ The factor the height of an hour is scaled by, clamped to the config's @c minimumTimeScale and @c maximumTimeScale.
+ Defaults to 1.
+
+ Attributes are laid out and cached at a scale of 1, in which a minute is always the same height, and scaled only when
+ they are returned, so changing the scale on every frame of a pinch lays nothing out again. Light gridlines are hidden
+ while an hour is too short to show them apart from the dark ones. A static grid is stretched rather than drawn again.
+ */
+@property (nonatomic, assign, readwrite) CGFloat timeScale;
+
+/**
+ Whether the layout reports the measurements of its passes to @c collectionView:layout:didMeasurePass:. Defaults to NO,
+ so that no metrics are created when nobody reads them. Passes are traced with @c TCNTrace either way.
+ */
+@property (nonatomic, assign, readwrite) BOOL measuresPasses;
+
 /**
  A new day view layout with the specified @c config.
 
@@ -82,6 +206,81 @@
 
 - (nonnull instancetype)init NS_UNAVAILABLE;
 
+/**
+ Computes the event frames of the sections on or next to the screen on a background queue, and installs them on the
+ main thread when they are ready. Until then those sections show no events, so a @c reloadData with many events doesn't
+ block the main thread.
+
+ Call this right after @c reloadData. Calling it again, or changing the events in any other way before it finishes,
+ cancels the previous computation.
+
+ @param completion Called on the main thread with YES once the frames are installed, or NO if the computation was
+ cancelled or the layout places its events by index, in which case they are laid out on the main thread as usual.
+ */
+- (void)prepareEventLayoutInBackgroundWithCompletion:(nullable void (^)(BOOL finished))completion;
+
+/**
+ Cancels an event layout started by @c prepareEventLayoutInBackgroundWithCompletion:, and lays the events out on the
+ main thread instead.
+ */
+- (void)cancelBackgroundEventLayout;
+
+/**
+ The key of a snapshot of this layout's events on the day of @c date.
+
+ @param date A time on the laid out day.
+ @param dataVersion A version of the day's events that changes whenever they change.
+ @return A key that also covers the layout's measurements and the current time zone.
+ */
+- (TCNLayoutSnapshotKey)layoutSnapshotKeyForDate:(nonnull NSDate *)date dataVersion:(uint64_t)dataVersion;
+
+/**
+ Shows the events of @c section from @c snapshot right away if it was taken with @c key of the same number of events,
+ and lays them out again on a background queue after the snapshot is drawn, to verify it. Events whose frames differ
+ from the snapshot move to their verified frames.
+
+ The snapshot is shown at any section width, and until the events change. Call this right after @c reloadData. Calling
+ it again, or changing the events in any other way before the verification reads them, cancels the previous one.
+
+ @param section The section to show from @c snapshot.
+ @param snapshot A snapshot saved from an earlier completion, or nil to only take a new snapshot.
+ @param key The key of the current events, from @c layoutSnapshotKeyForDate:dataVersion:.
+ @param completion Called on the main thread with a snapshot of the verified layout, and whether @c snapshot matched it,
+ so that a snapshot that didn't can be replaced. The snapshot is nil if the verification was cancelled or the layout
+ places its events by index.
+ */
+- (void)prepareEventLayoutInSection:(NSInteger)section
+                       fromSnapshot:(nullable TCNDayViewLayoutSnapshot *)snapshot
+                                key:(TCNLayoutSnapshotKey)key
+                         completion:(nullable void (^)(TCNDayViewLayoutSnapshot *_Nullable currentSnapshot, BOOL snapshotWasCurrent))completion;
+
+/**
+ The event item at @c point, found through the same spatial index as rect queries rather than by checking every item.
+ Where items overlap, the one drawn on top is returned.
+
+ @param point A point in the collection view, at the current @c timeScale.
+ @return The index path of the topmost item at @c point, or nil if there is none.
+ */
+- (nullable NSIndexPath *)indexPathForEventItemAtPoint:(CGPoint)point;
+
+/**
+ Shows the event item at @c indexPath from @c startMinute to @c endMinute instead of its own times, e.g. while it is
+ dragged, without asking the delegate for its times. Only the overlap clusters the item leaves and joins are adjusted
+ again, and the spatial index is kept until the drag ends, so this can be called for every touch of a drag.
+
+ Each call starts again from the item's own times. Changing the events ends the drag.
+
+ @param indexPath An item in a section that is laid out.
+ @param startMinute The minute of the day the item is shown to start at.
+ @param endMinute The minute of the day the item is shown to end at.
+ */
+- (void)dragEventItemAtIndexPath:(nonnull NSIndexPath *)indexPath toStartMinute:(NSInteger)startMinute endMinute:(NSInteger)endMinute;
+
+/**
+ Shows the item dragged by @c dragEventItemAtIndexPath:toStartMinute:endMinute: at its own times again.
+ */
+- (void)endEventItemDrag;
+
 /**
  The offset for the top of the time slot specified by @c indexPath.
 
@@ -91,6 +290,23 @@
  */
 + (CGFloat)offsetForIndexPath:(nonnull NSIndexPath *)indexPath minY:(CGFloat)minY;
 
+/**
+ The y offset that @c offset in the collection view has at a time scale of 1, as used by @c offsetForIndexPath:minY: and
+ @c timeForYOffset:.
+
+ @param offset A y offset in the collection view at the current @c timeScale.
+ @return The offset at a time scale of 1.
+ */
+- (CGFloat)unscaledYOffsetForYOffset:(CGFloat)offset;
+
+/**
+ The y offset in the collection view, at the current @c timeScale, of an offset at a time scale of 1.
+
+ @param offset A y offset at a time scale of 1, e.g. from @c offsetForIndexPath:minY:.
+ @return The offset at the current @c timeScale.
+ */
+- (CGFloat)yOffsetForUnscaledYOffset:(CGFloat)offset;
+
 /**
  An NSDate with nil date components, with the hour and minute set according to the provided collection view offset.
 
@@ -1,10 +1,23 @@
+#import "TCNCalendarContext.h"
 #import "TCNDateUtil.h"
 #import "TCNDayViewLayout.h"
+#import "TCNDayViewLayout+Protected.h"
+#import "TCNDayViewLayoutInvalidationContext.h"
+#import "TCNDayViewGridLayoutAttributes.h"
+#import "TCNDayViewGridRenderer.h"
+#import "TCNDayViewGridView.h"
 #import "TCNDayViewGridlineView.h"
 #import "TCNDayViewTimeView.h"
 #import "TCNEventCell.h"
+#import "TCNEventCellLayoutAttributes.h"
 #import "TCNDecorationViewLayoutAttributes.h"
+#import "TCNEventGeometryEngine.h"
+#import "TCNLayoutSnapshot.h"
+#import "TCNMacros.h"
 #import "TCNNumberHelper.h"
+#import "TCNOverlapEngine.h"
+#import "TCNRectIndex.h"
+#import "TCNTrace.h"
 
 typedef NS_ENUM(NSInteger, TCNDayViewLayoutZIndex) {
 
@@ -14,6 +27,30 @@ typedef NS_ENUM(NSInteger, TCNDayViewLayoutZIndex) {
 
 };
 
+/**
+ The vertical extent of an adjustable item, for finding a section's overlap clusters without boxing.
+ */
+typedef struct {
+    CGFloat minY;
+    CGFloat maxY;
+    NSUInteger item;
+} TCNDayViewLayoutItemExtent;
+
+/**
+ Orders extents the way @c TCNOverlapEngine sweeps intervals: by start, then by item.
+ */
+static int TCNDayViewLayoutItemExtentCompare(const void *lhs, const void *rhs) {
+    const TCNDayViewLayoutItemExtent *const a = lhs;
+    const TCNDayViewLayoutItemExtent *const b = rhs;
+    if (a->minY != b->minY) {
+        return a->minY < b->minY ? -1 : 1;
+    }
+    if (a->item != b->item) {
+        return a->item < b->item ? -1 : 1;
+    }
+    return 0;
+}
+
 @interface TCNDayViewLayout ()
 
 /**
@@ -24,8 +61,87 @@ typedef NS_ENUM(NSInteger, TCNDayViewLayoutZIndex) {
 @property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *timeViewAttributes;
 @property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *darkGridlineAttributes;
 @property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *lightGridlineAttributes;
+@property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *gridAttributes;
 @property (nonatomic, strong, nonnull, readonly) TCNDayViewConfig *config;
 
+/**
+ The sections currently in the attributes caches. Only sections in or next to the visible area are laid out.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSMutableIndexSet *preparedSections;
+
+/**
+ The section geometry the caches were built for. Time views and gridlines are kept until it changes.
+ */
+@property (nonatomic, assign, readwrite) NSInteger preparedSectionCount;
+@property (nonatomic, assign, readwrite) CGFloat preparedSectionWidth;
+
+/**
+ Event updates described by @c TCNDayViewLayoutInvalidationContext since the last @c prepareLayout.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSMutableArray<NSIndexPath *> *pendingInsertedEventIndexPaths;
+@property (nonatomic, strong, nonnull, readonly) NSMutableArray<NSIndexPath *> *pendingDeletedEventIndexPaths;
+
+/**
+ Set when the layout was invalidated in a way that the pending event updates don't describe, e.g. by @c reloadData.
+ */
+@property (nonatomic, assign, readwrite) BOOL needsFullEventLayout;
+
+/**
+ Whether the caches are still current after the last @c prepareLayout, i.e. every invalidation since only changed
+ @c timeScale. The next @c prepareLayout then has nothing to do.
+ */
+@property (nonatomic, assign, readwrite) BOOL preparedLayoutIsCurrent;
+
+/**
+ Attributes that differ from @c eventCellAttributes while an item is dragged: the dragged item and the items of the
+ overlap clusters it left and joined. They are shown instead of the cached ones, outside of the spatial index.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *draggedEventCellAttributes;
+
+/**
+ Spatial index over the frames in @c allAttributes, used to answer rect queries without a linear scan.
+ */
+@property (nonatomic, assign, nullable, readwrite) TCNRectIndex *allAttributesIndex;
+
+/**
+ Room for every identifier in @c allAttributesIndex, allocated with the index and reused by each query of it.
+ */
+@property (nonatomic, assign, nullable, readwrite) uint32_t *allAttributesIndexResults;
+
+/**
+ The queue event frames are computed on by @c prepareEventLayoutInBackgroundWithCompletion:, and the computation in
+ flight. Events in @c backgroundLayoutSections aren't laid out on the main thread while it runs.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSOperationQueue *backgroundLayoutQueue;
+@property (nonatomic, strong, nullable, readwrite) NSOperation *backgroundLayoutOperation;
+@property (nonatomic, copy, nullable, readwrite) void (^backgroundLayoutCompletion)(BOOL finished);
+@property (nonatomic, strong, nonnull, readwrite) NSIndexSet *backgroundLayoutSections;
+
+/**
+ Finished background results by section, as arrays of @c TCNEventGeometryInput and @c TCNEventGeometryFrame. They are
+ installed by the next @c prepareLayout.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSNumber *, NSData *> *backgroundEventInputs;
+@property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSNumber *, NSData *> *backgroundEventFrames;
+
+/**
+ The snapshots events are shown from by section, until the events change.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSDictionary<NSNumber *, TCNDayViewLayoutSnapshot *> *eventSnapshots;
+
+/**
+ The verification of the latest snapshot, its section, and whether it has read the events it verifies against.
+ */
+@property (nonatomic, strong, nullable, readwrite) NSBlockOperation *snapshotVerificationOperation;
+@property (nonatomic, copy, nullable, readwrite) void (^snapshotVerificationCompletion)(TCNDayViewLayoutSnapshot *_Nullable currentSnapshot, BOOL snapshotWasCurrent);
+@property (nonatomic, assign, readwrite) NSInteger snapshotVerificationSection;
+@property (nonatomic, assign, readwrite) BOOL snapshotVerificationReadEvents;
+
+/**
+ Observes @c TCNCalendarContextDidInvalidateNotification, after which the prepared layout is redone.
+ */
+@property (nonatomic, strong, nonnull, readonly) id<NSObject> calendarContextObserver;
+
 @end
 
 @implementation TCNDayViewLayout
@@ -39,6 +155,8 @@ static const CGFloat SectionHeight = HourHeight * HoursInDay;
 static const UIEdgeInsets CellMargin = {2.0f, 0.0f, 2.0f, 2.0f};
 static const CGFloat EventRightInset = 2.0f;
 static const CGFloat MinuteHeight = HourHeight / 60.0f;
+static const NSInteger UnadjustedEventItemZIndex = NSIntegerMax;
+static const CGFloat MinimumLightGridlineHourHeight = 44.0f;
 
 #pragma mark - Initialization
 
@@ -51,13 +169,72 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
     _config = config;
     _allAttributes = [[NSArray alloc] init];
     _eventCellAttributes = [[NSDictionary alloc] init];
+    _draggedEventCellAttributes = [[NSDictionary alloc] init];
     _timeViewAttributes = [[NSDictionary alloc] init];
     _darkGridlineAttributes = [[NSDictionary alloc] init];
     _lightGridlineAttributes = [[NSDictionary alloc] init];
+    _gridAttributes = [[NSDictionary alloc] init];
+    _preparedSections = [[NSMutableIndexSet alloc] init];
+    _preparedSectionCount = -1;
+    _pendingInsertedEventIndexPaths = [[NSMutableArray alloc] init];
+    _pendingDeletedEventIndexPaths = [[NSMutableArray alloc] init];
+    _needsFullEventLayout = YES;
+    _timeScale = 1;
+    _backgroundLayoutQueue = [[NSOperationQueue alloc] init];
+    _backgroundLayoutQueue.maxConcurrentOperationCount = 1;
+    _backgroundLayoutQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+    _backgroundLayoutSections = [[NSIndexSet alloc] init];
+    _backgroundEventInputs = [[NSDictionary alloc] init];
+    _backgroundEventFrames = [[NSDictionary alloc] init];
+    _eventSnapshots = [[NSDictionary alloc] init];
+
+    __weak typeof(self) weakSelf = self;
+    _calendarContextObserver = [NSNotificationCenter.defaultCenter addObserverForName:TCNCalendarContextDidInvalidateNotification
+                                                                               object:TCNCalendarContext.sharedContext
+                                                                                queue:NSOperationQueue.mainQueue
+                                                                           usingBlock:^(__unused NSNotification *notification) {
+        [weakSelf invalidateLayoutForCalendarChange];
+    }];
 
     return self;
 }
 
+- (void)setColumnWidth:(CGFloat)columnWidth {
+    _columnWidth = columnWidth;
+
+    TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+    context.invalidateSectionWidth = YES;
+    [self invalidateLayoutWithContext:context];
+}
+
+- (void)setRendersStaticGrid:(BOOL)rendersStaticGrid {
+    _rendersStaticGrid = rendersStaticGrid;
+
+    // Time views and gridlines are otherwise kept until the section geometry changes
+    self.preparedSectionCount = -1;
+    [self invalidateLayout];
+}
+
+- (void)setTimeScale:(CGFloat)timeScale {
+    const CGFloat clampedTimeScale = MIN(MAX(timeScale, self.config.minimumTimeScale), self.config.maximumTimeScale);
+    if (clampedTimeScale == _timeScale) {
+        return;
+    }
+    _timeScale = clampedTimeScale;
+
+    TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+    context.invalidateTimeScale = YES;
+    [self invalidateLayoutWithContext:context];
+}
+
+- (void)dealloc {
+    [_backgroundLayoutOperation cancel];
+    [_snapshotVerificationOperation cancel];
+    [NSNotificationCenter.defaultCenter removeObserver:_calendarContextObserver];
+    TCNRectIndexDestroy(_allAttributesIndex);
+    free(_allAttributesIndexResults);
+}
+
 #pragma mark - Class helpers
 
 + (CGFloat)topInsetMargin {
@@ -74,38 +251,267 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
     return [TCNDateUtil dateWithDate:[NSDate date] atHour:hour andMinute:minute];
 }
 
+- (CGFloat)unscaledYOffsetForYOffset:(CGFloat)offset {
+    return ContentMargin.top + (offset - ContentMargin.top) / self.timeScale;
+}
+
+- (CGFloat)yOffsetForUnscaledYOffset:(CGFloat)offset {
+    return ContentMargin.top + (offset - ContentMargin.top) * self.timeScale;
+}
+
 #pragma mark - UICollectionViewLayout
 
++ (Class)invalidationContextClass {
+    return TCNDayViewLayoutInvalidationContext.class;
+}
+
+- (void)invalidateLayoutWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+    TCNDayViewLayoutInvalidationContext *const dayViewContext = TCN_CAST_OR_NIL(context, TCNDayViewLayoutInvalidationContext);
+    if (dayViewContext) {
+        [self.pendingInsertedEventIndexPaths addObjectsFromArray:dayViewContext.insertedEventIndexPaths];
+        [self.pendingDeletedEventIndexPaths addObjectsFromArray:dayViewContext.deletedEventIndexPaths];
+    }
+
+    // A change in item counts can only be applied incrementally if a TCNDayViewLayoutInvalidationContext described it,
+    // and scrolling new sections into range doesn't change the sections already laid out
+    const BOOL hasPendingEventUpdates = self.pendingInsertedEventIndexPaths.count > 0 || self.pendingDeletedEventIndexPaths.count > 0;
+    const BOOL describesEventUpdates = dayViewContext.insertedEventIndexPaths.count > 0 || dayViewContext.deletedEventIndexPaths.count > 0;
+    if (context.invalidateEverything
+        || (context.invalidateDataSourceCounts && !hasPendingEventUpdates)
+        || (!context.invalidateDataSourceCounts
+            && !describesEventUpdates
+            && !dayViewContext.invalidateVisibleSections
+            && !dayViewContext.invalidateTimeScale
+            && !dayViewContext.invalidateSectionWidth
+            && !dayViewContext.invalidateDraggedEvent)) {
+        self.needsFullEventLayout = YES;
+    }
+
+    // Attributes are cached at a time scale of 1, and dragged items are shown beside the caches, so neither a new scale
+    // nor a drag leaves them stale
+    const BOOL keepsPreparedLayout = (dayViewContext.invalidateTimeScale || dayViewContext.invalidateDraggedEvent)
+        && !context.invalidateEverything
+        && !context.invalidateDataSourceCounts
+        && !describesEventUpdates
+        && !dayViewContext.invalidateVisibleSections
+        && !dayViewContext.invalidateSectionWidth;
+    if (!keepsPreparedLayout) {
+        self.preparedLayoutIsCurrent = NO;
+    }
+
+    // Background results, and a drag in progress, would describe the events from before this change
+    if (context.invalidateEverything || context.invalidateDataSourceCounts || describesEventUpdates) {
+        self.draggedEventCellAttributes = [[NSDictionary alloc] init];
+    }
+    if (context.invalidateDataSourceCounts || describesEventUpdates) {
+        [self discardBackgroundEventLayout];
+        [self discardEventSnapshots];
+    }
+
+    [super invalidateLayoutWithContext:context];
+}
+
+- (BOOL)shouldInvalidateLayoutForBoundsChange:(CGRect)newBounds {
+    // Vertical scrolling never changes the layout, but horizontal scrolling may bring other sections into range, and
+    // sections that fill the collection view are resized with it
+    return [self boundsChangeResizesSections:newBounds]
+        || ![[self sectionIndexesNearRect:newBounds] isEqualToIndexSet:self.preparedSections];
+}
+
+- (UICollectionViewLayoutInvalidationContext *)invalidationContextForBoundsChange:(CGRect)newBounds {
+    UICollectionViewLayoutInvalidationContext *const context = [super invalidationContextForBoundsChange:newBounds];
+    TCNDayViewLayoutInvalidationContext *const dayViewContext = TCN_CAST_OR_NIL(context, TCNDayViewLayoutInvalidationContext);
+    dayViewContext.invalidateVisibleSections = YES;
+    dayViewContext.invalidateSectionWidth = [self boundsChangeResizesSections:newBounds];
+    return context;
+}
+
+/**
+ Whether sections are as wide as the collection view, and @c newBounds has a different width than they were laid out at.
+ */
+- (BOOL)boundsChangeResizesSections:(CGRect)newBounds {
+    return self.columnWidth <= 0 && self.preparedSectionCount >= 0 && CGRectGetWidth(newBounds) != self.preparedSectionWidth;
+}
+
 - (void)prepareLayout {
     [super prepareLayout];
+    if (self.preparedLayoutIsCurrent) {
+        return;
+    }
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNamePrepareLayout);
+
+    // Time views and gridlines only depend on the section geometry, so they are kept across data reloads, and a new
+    // section width only moves what is already laid out
+    const NSInteger numberOfSections = self.collectionView.numberOfSections;
+    const CGFloat sectionWidth = [self sectionWidth];
+    if (numberOfSections != self.preparedSectionCount) {
+        [self invalidateLayoutCache];
+        [self discardBackgroundEventLayout];
+        self.preparedSectionCount = numberOfSections;
+        self.preparedSectionWidth = sectionWidth;
+        self.needsFullEventLayout = YES;
+    } else if (sectionWidth != self.preparedSectionWidth) {
+        [self reprojectLayoutForSectionWidth:sectionWidth];
+    }
+
+    // Sections that scrolled out of range are dropped, so memory stays proportional to what is on screen
+    NSIndexSet *const sectionsInRange = [self sectionIndexesNearRect:self.collectionView.bounds];
+    NSMutableIndexSet *const sectionsToDiscard = [self.preparedSections mutableCopy];
+    [sectionsToDiscard removeIndexes:sectionsInRange];
+    [self discardLayoutForSections:sectionsToDiscard];
+
+    const BOOL hasPendingEventUpdates = self.pendingInsertedEventIndexPaths.count > 0 || self.pendingDeletedEventIndexPaths.count > 0;
+    if (!self.needsFullEventLayout && hasPendingEventUpdates && ![self prepareEventLayoutForPendingUpdates]) {
+        self.needsFullEventLayout = YES;
+    }
+
+    // Sections in range whose layout is kept from the previous pass count as cache hits
+    const NSInteger reusedSectionCount = self.needsFullEventLayout ? 0 : (NSInteger)self.preparedSections.count;
+    if (self.needsFullEventLayout) {
+        self.eventCellAttributes = [[NSDictionary alloc] init];
+        [self prepareEventLayoutForSections:self.preparedSections];
+    }
+    [self.pendingInsertedEventIndexPaths removeAllObjects];
+    [self.pendingDeletedEventIndexPaths removeAllObjects];
+    self.needsFullEventLayout = NO;
 
-    [self invalidateLayoutCache];
-    [self prepareSectionLayoutForSections:[NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, (NSUInteger)self.collectionView.numberOfSections)]];
+    NSMutableIndexSet *const sectionsToPrepare = [sectionsInRange mutableCopy];
+    [sectionsToPrepare removeIndexes:self.preparedSections];
+    [self prepareSectionLayoutForSections:sectionsToPrepare];
+    self.backgroundEventInputs = [[NSDictionary alloc] init];
+    self.backgroundEventFrames = [[NSDictionary alloc] init];
 
     NSMutableArray *const allAttributes = [[NSMutableArray alloc] init];
     [allAttributes addObjectsFromArray:[self.timeViewAttributes allValues]];
     [allAttributes addObjectsFromArray:[self.darkGridlineAttributes allValues]];
     [allAttributes addObjectsFromArray:[self.lightGridlineAttributes allValues]];
+    [allAttributes addObjectsFromArray:[self.gridAttributes allValues]];
     [allAttributes addObjectsFromArray:[self.eventCellAttributes allValues]];
     self.allAttributes = allAttributes;
+    [self prepareAllAttributesIndex];
+    self.preparedLayoutIsCurrent = YES;
+
+    [self finishPass:traceInterval
+        elementCount:(NSInteger)allAttributes.count
+       cacheHitCount:reusedSectionCount
+    cacheLookupCount:(NSInteger)sectionsInRange.count];
 }
 
+/**
+ The sections intersecting @c rect, plus one more on each side so that a section is ready before it scrolls into view.
+ */
+- (nonnull NSIndexSet *)sectionIndexesNearRect:(CGRect)rect {
+    const NSInteger numberOfSections = self.collectionView.numberOfSections;
+    const CGFloat sectionWidth = [self sectionWidth];
+    if (numberOfSections <= 0) {
+        return [[NSIndexSet alloc] init];
+    }
+    if (sectionWidth <= 0) {
+        return [NSIndexSet indexSetWithIndex:0];
+    }
+
+    const NSInteger firstSection = MAX(0, (NSInteger)[TCNNumberHelper floor:CGRectGetMinX(rect) / sectionWidth] - 1);
+    const NSInteger lastSection = MIN(numberOfSections - 1, (NSInteger)[TCNNumberHelper floor:CGRectGetMaxX(rect) / sectionWidth] + 1);
+    if (lastSection < firstSection) {
+        return [[NSIndexSet alloc] init];
+    }
+    return [NSIndexSet indexSetWithIndexesInRange:NSMakeRange((NSUInteger)firstSection, (NSUInteger)(lastSection - firstSection + 1))];
+}
+
+/**
+ Lays out the time views, gridlines and events of @c sectionIndexes and adds them to the caches.
+ */
 - (void)prepareSectionLayoutForSections:(nonnull NSIndexSet *)sectionIndexes {
+    if (sectionIndexes.count == 0) {
+        return;
+    }
+
+    [self prepareStaticLayoutForSections:sectionIndexes];
+    [self prepareEventLayoutForSections:sectionIndexes];
+    [self.preparedSections addIndexes:sectionIndexes];
+}
+
+- (void)discardLayoutForSections:(nonnull NSIndexSet *)sectionIndexes {
+    if (sectionIndexes.count == 0) {
+        return;
+    }
+
+    BOOL (^const isInSections)(NSIndexPath *, UICollectionViewLayoutAttributes *, BOOL *) =
+    ^BOOL(NSIndexPath *indexPath, __unused UICollectionViewLayoutAttributes *attributes, __unused BOOL *stop) {
+        return [sectionIndexes containsIndex:(NSUInteger)indexPath.section];
+    };
+    self.timeViewAttributes = [TCNDayViewLayout attributes:self.timeViewAttributes removingKeysPassingTest:isInSections];
+    self.darkGridlineAttributes = [TCNDayViewLayout attributes:self.darkGridlineAttributes removingKeysPassingTest:isInSections];
+    self.lightGridlineAttributes = [TCNDayViewLayout attributes:self.lightGridlineAttributes removingKeysPassingTest:isInSections];
+    self.gridAttributes = [TCNDayViewLayout attributes:self.gridAttributes removingKeysPassingTest:isInSections];
+    self.eventCellAttributes = [TCNDayViewLayout attributes:self.eventCellAttributes removingKeysPassingTest:isInSections];
+    [self.preparedSections removeIndexes:sectionIndexes];
+}
+
++ (nonnull NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)attributes:(nonnull NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)attributes
+                                                                removingKeysPassingTest:(BOOL (^_Nonnull)(NSIndexPath *, UICollectionViewLayoutAttributes *, BOOL *))predicate {
+    NSMutableDictionary *const remainingAttributes = [attributes mutableCopy];
+    [remainingAttributes removeObjectsForKeys:[[attributes keysOfEntriesPassingTest:predicate] allObjects]];
+    return remainingAttributes;
+}
+
+- (void)prepareAllAttributesIndex {
+    [self destroyAllAttributesIndex];
+
+    const NSUInteger attributesCount = self.allAttributes.count;
+    if (attributesCount == 0) {
+        return;
+    }
+
+    TCNRectIndexRect *const rects = malloc(attributesCount * sizeof(TCNRectIndexRect));
+    if (!rects) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate rect index buffer for %lu attributes", (unsigned long)attributesCount);
+        return;
+    }
+
+    for (NSUInteger index = 0; index < attributesCount; index++) {
+        const CGRect frame = self.allAttributes[index].frame;
+        rects[index] = (TCNRectIndexRect){CGRectGetMinX(frame), CGRectGetMinY(frame), CGRectGetMaxX(frame), CGRectGetMaxY(frame)};
+    }
+
+    self.allAttributesIndex = TCNRectIndexCreate(rects, attributesCount);
+    free(rects);
+    if (!self.allAttributesIndex) {
+        return;
+    }
+
+    self.allAttributesIndexResults = malloc(attributesCount * sizeof(uint32_t));
+    if (!self.allAttributesIndexResults) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate rect query buffer for %lu attributes", (unsigned long)attributesCount);
+        [self destroyAllAttributesIndex];
+    }
+}
+
+- (void)destroyAllAttributesIndex {
+    TCNRectIndexDestroy(self.allAttributesIndex);
+    self.allAttributesIndex = NULL;
+    free(self.allAttributesIndexResults);
+    self.allAttributesIndexResults = NULL;
+}
+
+- (void)prepareStaticLayoutForSections:(nonnull NSIndexSet *)sectionIndexes {
     if (self.collectionView.numberOfSections == 0) {
         return;
     }
+    if (self.rendersStaticGrid) {
+        [self prepareGridLayoutForSections:sectionIndexes];
+        return;
+    }
 
-    NSMutableDictionary *const timeViewAttributesCache = [[NSMutableDictionary alloc] init];
-    NSMutableDictionary *const darkGridlineViewAttributesCache = [[NSMutableDictionary alloc] init];
-    NSMutableDictionary *const lightGridlineViewAttributesCache = [[NSMutableDictionary alloc] init];
-    NSMutableDictionary *const eventCellAttributeCache = [[NSMutableDictionary alloc] init];
+    NSMutableDictionary *const timeViewAttributesCache = [self.timeViewAttributes mutableCopy];
+    NSMutableDictionary *const darkGridlineViewAttributesCache = [self.darkGridlineAttributes mutableCopy];
+    NSMutableDictionary *const lightGridlineViewAttributesCache = [self.lightGridlineAttributes mutableCopy];
 
     [sectionIndexes enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
         const NSInteger section = (NSInteger)index;
 
         const CGFloat calendarGridMinY = ContentMargin.top;
-        const CGFloat eventMaxX = [self sectionWidth] - EventRightInset;
-        const CGFloat sectionMinX =  [self stackedSectionWidthUpToSection:section];
+        const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
         const CGFloat calendarGridMinX = sectionMinX + TimeViewWidth + ContentMargin.left;
         const CGFloat calendarGridWidth = [self sectionWidth] - TimeViewWidth - ContentMargin.right - ContentMargin.left;
 
@@ -132,40 +538,376 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
                                                                                           calendarGridMinX:calendarGridMinX
                                                                                           calendarGridMinY:calendarGridMinY];
         }
+    }];
+
+    self.timeViewAttributes = timeViewAttributesCache;
+    self.darkGridlineAttributes = darkGridlineViewAttributesCache;
+    self.lightGridlineAttributes = lightGridlineViewAttributesCache;
+}
+
+- (void)prepareGridLayoutForSections:(nonnull NSIndexSet *)sectionIndexes {
+    const TCNDayViewGridMetrics metrics = {TimeViewWidth, HourHeight, HorizontalGridlineHeight, HoursInDay};
+    const CGFloat displayScale = self.collectionView.traitCollection.displayScale;
+    const CGFloat scale = displayScale > 0 ? displayScale : [UIScreen mainScreen].scale;
+    UIImage *const timeColumnImage = [TCNDayViewGridRenderer timeColumnImageForConfig:self.config metrics:metrics scale:scale];
+    UIImage *const gridlinePatternImage = [TCNDayViewGridRenderer gridlinePatternImageForConfig:self.config metrics:metrics scale:scale];
+
+    NSMutableDictionary *const gridAttributesCache = [self.gridAttributes mutableCopy];
+    [sectionIndexes enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
+        const NSInteger section = (NSInteger)index;
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:0 inSection:section];
+
+        // The grid starts at the top of the first time view, which is centered on the first hour
+        const CGFloat calendarGridMinY = ContentMargin.top;
+        const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
+        const CGFloat gridMinY = calendarGridMinY - ceilf(HourHeight / 2.0);
+        const CGFloat gridHeight = HourHeight * (HoursInDay + 1);
+        const CGFloat calendarGridWidth = [self sectionWidth] - TimeViewWidth - ContentMargin.right - ContentMargin.left;
+        const CGFloat firstGridlineMinY = [TCNDayViewLayout offsetForIndexPath:indexPath minY:calendarGridMinY];
+
+        TCNDayViewGridLayoutAttributes *const gridAttributes = [TCNDayViewGridLayoutAttributes layoutAttributesForDecorationViewOfKind:TCNDayViewGridView.kind
+                                                                                                                     withIndexPath:indexPath];
+        gridAttributes.frame = CGRectMake(sectionMinX, gridMinY, [self sectionWidth], gridHeight);
+        gridAttributes.zIndex = [self zIndexForElementKind:TCNDayViewGridView.kind];
+        gridAttributes.timeColumnImage = timeColumnImage;
+        gridAttributes.timeColumnFrame = CGRectMake(0, 0, TimeViewWidth, gridHeight);
+        gridAttributes.gridlinePatternImage = gridlinePatternImage;
+        gridAttributes.gridlineFrame = CGRectMake(TimeViewWidth + ContentMargin.left,
+                                                  firstGridlineMinY - gridMinY,
+                                                  calendarGridWidth,
+                                                  (HourHeight * HoursInDay) + HorizontalGridlineHeight);
+        gridAttributesCache[indexPath] = gridAttributes;
+    }];
+    self.gridAttributes = gridAttributesCache;
+}
+
+- (void)prepareEventLayoutForSections:(nonnull NSIndexSet *)sectionIndexes {
+    if (self.collectionView.numberOfSections == 0) {
+        return;
+    }
+
+    NSMutableDictionary *const eventCellAttributeCache = [self.eventCellAttributes mutableCopy];
+
+    [sectionIndexes enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
+        const NSInteger section = (NSInteger)index;
+
+        const CGFloat calendarGridMinY = ContentMargin.top;
+        const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
+        const CGFloat eventMaxX = sectionMinX + [self sectionWidth] - EventRightInset;
+        const CGFloat calendarGridMinX = sectionMinX + TimeViewWidth + ContentMargin.left;
 
         const NSInteger numberOfItemsInSection = [self.collectionView numberOfItemsInSection:section];
 
+        // Events computed in the background are installed when they are ready, and snapshots are shown until then
+        if ([self installBackgroundEventLayoutInSection:section
+                                          numberOfItems:numberOfItemsInSection
+                                    eventCellAttributes:eventCellAttributeCache]) {
+            return;
+        }
+        if ([self installSnapshotEventLayoutInSection:section
+                                        numberOfItems:numberOfItemsInSection
+                                  eventCellAttributes:eventCellAttributeCache]) {
+            return;
+        }
+        if ([self.backgroundLayoutSections containsIndex:index]) {
+            return;
+        }
+
+        // Events placed by time are laid out by the same engine as the background and snapshot passes
+        if (!self.eventItemFramesDependOnItemIndex
+            && [self prepareEngineEventLayoutInSection:section
+                                         numberOfItems:numberOfItemsInSection
+                                   eventCellAttributes:eventCellAttributeCache]) {
+            return;
+        }
+
+        // Read every item's times in one call if the delegate supports it
+        TCNDayViewLayoutItemTimeRange *const timeRanges = [self timeRangesBufferForItemsInSection:section count:numberOfItemsInSection];
+
         // We add items into another set if they need overlap adjustment. This allows us to
         // enforce a stable layout ordering on these items during overlap adjustment, whether or not any
         // non-adjusting items are added to the day view.
         NSMutableArray *const itemsToAdjust = [[NSMutableArray alloc] init];
         for (NSInteger item = 0; item < numberOfItemsInSection; item++) {
             NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
-            UICollectionViewLayoutAttributes *const attributes = [self prepareLayoutForEventItemsAtIndexPath:indexPath
-                                                                                            calendarGridMinX:calendarGridMinX
-                                                                                            calendarGridMinY:calendarGridMinY
-                                                                                            calendarGridMaxX:eventMaxX];
+            UICollectionViewLayoutAttributes *attributes;
+            BOOL shouldAdjustLayout;
+            if (timeRanges) {
+                attributes = [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                                               timeRange:timeRanges[item]
+                                                        calendarGridMinX:calendarGridMinX
+                                                        calendarGridMinY:calendarGridMinY
+                                                        calendarGridMaxX:eventMaxX];
+                shouldAdjustLayout = timeRanges[item].shouldAdjustLayout;
+            } else {
+                attributes = [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                                        calendarGridMinX:calendarGridMinX
+                                                        calendarGridMinY:calendarGridMinY
+                                                        calendarGridMaxX:eventMaxX];
+                shouldAdjustLayout = [self.delegate collectionView:self.collectionView layout:self shouldAdjustLayoutForItemAtIndexPath:indexPath];
+            }
+
             eventCellAttributeCache[indexPath] = attributes;
-            if ([self.delegate collectionView:self.collectionView layout:self shouldAdjustLayoutForItemAtIndexPath:indexPath]) {
+            if (shouldAdjustLayout) {
                 [itemsToAdjust addObject:attributes];
             } else {
-                attributes.zIndex = NSIntegerMax;
+                attributes.zIndex = UnadjustedEventItemZIndex;
             }
         }
+        free(timeRanges);
 
         [self adjustItemsForOverlap:itemsToAdjust
                           inSection:section
                         sectionMinX:sectionMinX
                    calendarGridMinX:calendarGridMinX
-                   calendarGridMaxX:eventMaxX];
+                   calendarGridMaxX:eventMaxX
+                    firstStackOrder:0];
     }];
 
-    self.timeViewAttributes = timeViewAttributesCache;
-    self.darkGridlineAttributes = darkGridlineViewAttributesCache;
-    self.lightGridlineAttributes = lightGridlineViewAttributesCache;
     self.eventCellAttributes = eventCellAttributeCache;
 }
 
+/**
+ Applies the pending event insertions and deletions to the cached event attributes. Every other item keeps its frame,
+ and only the overlap clusters that gained or lost an item are adjusted again.
+
+ @return NO if the pending updates can't be applied incrementally, in which case all events should be laid out again.
+ */
+- (BOOL)prepareEventLayoutForPendingUpdates {
+    NSArray<NSIndexPath *> *const insertedIndexPaths = [self.pendingInsertedEventIndexPaths copy];
+    NSArray<NSIndexPath *> *const deletedIndexPaths = [self.pendingDeletedEventIndexPaths copy];
+    if ((insertedIndexPaths.count == 0 && deletedIndexPaths.count == 0) || self.eventItemFramesDependOnItemIndex) {
+        return NO;
+    }
+
+    const NSInteger numberOfSections = self.collectionView.numberOfSections;
+    NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *const insertedItemsBySection = [[NSMutableDictionary alloc] init];
+    NSMutableDictionary<NSNumber *, NSMutableIndexSet *> *const deletedItemsBySection = [[NSMutableDictionary alloc] init];
+    for (NSIndexPath *indexPath in insertedIndexPaths) {
+        if (indexPath.section < 0 || indexPath.section >= numberOfSections || indexPath.item < 0) {
+            return NO;
+        }
+        NSMutableIndexSet *const items = insertedItemsBySection[@(indexPath.section)] ?: [[NSMutableIndexSet alloc] init];
+        [items addIndex:(NSUInteger)indexPath.item];
+        insertedItemsBySection[@(indexPath.section)] = items;
+    }
+    for (NSIndexPath *indexPath in deletedIndexPaths) {
+        if (indexPath.section < 0 || indexPath.section >= numberOfSections || indexPath.item < 0) {
+            return NO;
+        }
+        NSMutableIndexSet *const items = deletedItemsBySection[@(indexPath.section)] ?: [[NSMutableIndexSet alloc] init];
+        [items addIndex:(NSUInteger)indexPath.item];
+        deletedItemsBySection[@(indexPath.section)] = items;
+    }
+
+    NSMutableSet<NSNumber *> *const sections = [[NSMutableSet alloc] initWithArray:insertedItemsBySection.allKeys];
+    [sections addObjectsFromArray:deletedItemsBySection.allKeys];
+
+    NSMutableDictionary *const eventCellAttributeCache = [self.eventCellAttributes mutableCopy];
+    for (NSNumber *section in sections) {
+        // Sections that aren't laid out yet will read the new data when they are
+        if (![self.preparedSections containsIndex:section.unsignedIntegerValue]) {
+            continue;
+        }
+        if (![self updateEventLayoutInSection:section.integerValue
+                                insertedItems:insertedItemsBySection[section] ?: [[NSIndexSet alloc] init]
+                                 deletedItems:deletedItemsBySection[section] ?: [[NSIndexSet alloc] init]
+                          eventCellAttributes:eventCellAttributeCache]) {
+            return NO;
+        }
+    }
+
+    self.eventCellAttributes = eventCellAttributeCache;
+    return YES;
+}
+
+- (BOOL)updateEventLayoutInSection:(NSInteger)section
+                     insertedItems:(nonnull NSIndexSet *)insertedItems
+                      deletedItems:(nonnull NSIndexSet *)deletedItems
+               eventCellAttributes:(nonnull NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)eventCellAttributes {
+    NSInteger previousNumberOfItems = 0;
+    while (eventCellAttributes[[NSIndexPath indexPathForItem:previousNumberOfItems inSection:section]]) {
+        previousNumberOfItems++;
+    }
+
+    // The updates must account for exactly the change in item count, otherwise they don't describe the new data
+    const NSInteger numberOfItems = [self.collectionView numberOfItemsInSection:section];
+    if (numberOfItems != previousNumberOfItems + (NSInteger)insertedItems.count - (NSInteger)deletedItems.count
+        || (deletedItems.count > 0 && deletedItems.lastIndex >= (NSUInteger)previousNumberOfItems)
+        || (insertedItems.count > 0 && insertedItems.lastIndex >= (NSUInteger)numberOfItems)) {
+        return NO;
+    }
+
+    const CGFloat calendarGridMinY = ContentMargin.top;
+    const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
+    const CGFloat eventMaxX = sectionMinX + [self sectionWidth] - EventRightInset;
+    const CGFloat calendarGridMinX = sectionMinX + TimeViewWidth + ContentMargin.left;
+
+    // Frames of adjustable items that appeared or disappeared. Any overlap cluster touching one of these needs adjusting.
+    NSMutableArray<NSValue *> *const changedFrames = [[NSMutableArray alloc] init];
+    [deletedItems enumerateIndexesUsingBlock:^(NSUInteger item, __unused BOOL *stop) {
+        UICollectionViewLayoutAttributes *const attributes = eventCellAttributes[[NSIndexPath indexPathForItem:(NSInteger)item inSection:section]];
+        if (attributes.zIndex != UnadjustedEventItemZIndex) {
+            [changedFrames addObject:[NSValue valueWithCGRect:attributes.frame]];
+        }
+    }];
+
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const sectionItemAttributes = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)numberOfItems];
+    NSInteger previousItem = 0;
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+        if ([insertedItems containsIndex:(NSUInteger)item]) {
+            UICollectionViewLayoutAttributes *const attributes = [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                                                                            calendarGridMinX:calendarGridMinX
+                                                                                            calendarGridMinY:calendarGridMinY
+                                                                                            calendarGridMaxX:eventMaxX];
+            if ([self.delegate collectionView:self.collectionView layout:self shouldAdjustLayoutForItemAtIndexPath:indexPath]) {
+                [changedFrames addObject:[NSValue valueWithCGRect:attributes.frame]];
+            } else {
+                attributes.zIndex = UnadjustedEventItemZIndex;
+            }
+            [sectionItemAttributes addObject:attributes];
+            continue;
+        }
+
+        while ([deletedItems containsIndex:(NSUInteger)previousItem]) {
+            previousItem++;
+        }
+        UICollectionViewLayoutAttributes *const previousAttributes = eventCellAttributes[[NSIndexPath indexPathForItem:previousItem inSection:section]];
+        previousItem++;
+        if (!previousAttributes) {
+            return NO;
+        }
+
+        if (previousAttributes.indexPath.item == item) {
+            [sectionItemAttributes addObject:previousAttributes];
+        } else {
+            // Attributes may still be in use by the collection view, so items that moved get a copy
+            UICollectionViewLayoutAttributes *const movedAttributes = [previousAttributes copy];
+            movedAttributes.indexPath = indexPath;
+            [sectionItemAttributes addObject:movedAttributes];
+        }
+    }
+
+    [self readjustOverlapClustersInItemAttributes:sectionItemAttributes
+                                    changedFrames:changedFrames
+                                        inSection:section
+                                      sectionMinX:sectionMinX
+                                 calendarGridMinX:calendarGridMinX
+                                 calendarGridMaxX:eventMaxX];
+
+    for (NSInteger item = numberOfItems; item < previousNumberOfItems; item++) {
+        [eventCellAttributes removeObjectForKey:[NSIndexPath indexPathForItem:item inSection:section]];
+    }
+    for (UICollectionViewLayoutAttributes *attributes in sectionItemAttributes) {
+        eventCellAttributes[attributes.indexPath] = attributes;
+    }
+    return YES;
+}
+
+/**
+ Runs overlap adjustment again on the clusters of adjustable items in @c sectionItemAttributes that intersect any of
+ @c changedFrames, and moves the stack orders of the clusters after them to follow on. Clusters are found and numbered
+ the same way as @c TCNOverlapEngine does, so the result matches a full layout. Items whose attributes change are
+ replaced with copies.
+ */
+- (void)readjustOverlapClustersInItemAttributes:(nonnull NSMutableArray<UICollectionViewLayoutAttributes *> *)sectionItemAttributes
+                                  changedFrames:(nonnull NSArray<NSValue *> *)changedFrames
+                                      inSection:(NSInteger)section
+                                    sectionMinX:(CGFloat)sectionMinX
+                               calendarGridMinX:(CGFloat)calendarGridMinX
+                               calendarGridMaxX:(CGFloat)calendarGridMaxX {
+    const NSUInteger itemCount = sectionItemAttributes.count;
+    if (changedFrames.count == 0 || itemCount == 0) {
+        return;
+    }
+
+    TCNDayViewLayoutItemExtent *const extents = malloc(itemCount * sizeof(TCNDayViewLayoutItemExtent));
+    if (!extents) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate overlap cluster buffers for %lu items", (unsigned long)itemCount);
+        return;
+    }
+
+    // Only adjustable items with a height take part in overlap adjustment
+    NSUInteger extentCount = 0;
+    for (NSUInteger item = 0; item < itemCount; item++) {
+        UICollectionViewLayoutAttributes *const attributes = sectionItemAttributes[item];
+        const CGRect frame = attributes.frame;
+        if (attributes.zIndex != UnadjustedEventItemZIndex && CGRectGetHeight(frame) > 0) {
+            extents[extentCount++] = (TCNDayViewLayoutItemExtent){CGRectGetMinY(frame), CGRectGetMaxY(frame), item};
+        }
+    }
+    qsort(extents, extentCount, sizeof(TCNDayViewLayoutItemExtent), TCNDayViewLayoutItemExtentCompare);
+
+    uint32_t stackOrder = 0;
+    NSUInteger clusterStart = 0;
+    while (clusterStart < extentCount) {
+        const CGFloat clusterMinY = extents[clusterStart].minY;
+        CGFloat clusterMaxY = extents[clusterStart].maxY;
+        NSUInteger clusterEnd = clusterStart + 1;
+        while (clusterEnd < extentCount && extents[clusterEnd].minY < clusterMaxY) {
+            clusterMaxY = MAX(clusterMaxY, extents[clusterEnd].maxY);
+            clusterEnd++;
+        }
+        const NSUInteger clusterCount = clusterEnd - clusterStart;
+
+        BOOL isClusterChanged = NO;
+        for (NSValue *changedFrame in changedFrames) {
+            const CGRect frame = changedFrame.CGRectValue;
+            if (CGRectGetMinY(frame) < clusterMaxY && clusterMinY < CGRectGetMaxY(frame)) {
+                isClusterChanged = YES;
+                break;
+            }
+        }
+
+        if (isClusterChanged) {
+            // Start again from the full-width frame, in the order the engine sweeps them, just like a full layout pass
+            NSMutableArray<UICollectionViewLayoutAttributes *> *const clusterItems = [[NSMutableArray alloc] initWithCapacity:clusterCount];
+            for (NSUInteger index = clusterStart; index < clusterEnd; index++) {
+                UICollectionViewLayoutAttributes *const clusterAttributes = [sectionItemAttributes[extents[index].item] copy];
+                CGRect frame = clusterAttributes.frame;
+                frame.origin.x = [TCNNumberHelper ceil:(calendarGridMinX + CellMargin.left)];
+                frame.size.width = [TCNNumberHelper ceil:(calendarGridMaxX - CellMargin.right)] - frame.origin.x;
+                clusterAttributes.frame = frame;
+                TCN_CAST_OR_NIL(clusterAttributes, TCNEventCellLayoutAttributes).placement = (TCNOverlapPlacement){0, 1, 0};
+                clusterAttributes.zIndex = [self zIndexForElementKind:TCNEventCell.reuseIdentifier];
+                sectionItemAttributes[extents[index].item] = clusterAttributes;
+                [clusterItems addObject:clusterAttributes];
+            }
+
+            [self adjustItemsForOverlap:clusterItems
+                              inSection:section
+                            sectionMinX:sectionMinX
+                       calendarGridMinX:calendarGridMinX
+                       calendarGridMaxX:calendarGridMaxX
+                        firstStackOrder:stackOrder];
+        } else if (clusterCount > 1
+                   && sectionItemAttributes[extents[clusterStart].item].zIndex != TCNDayViewLayoutZIndexEventItem + (NSInteger)stackOrder) {
+            // A cluster before this one gained or lost items, so this one stacks from a different order
+            for (NSUInteger index = clusterStart; index < clusterEnd; index++) {
+                UICollectionViewLayoutAttributes *const clusterAttributes = [sectionItemAttributes[extents[index].item] copy];
+                const uint32_t itemStackOrder = stackOrder + (uint32_t)(index - clusterStart);
+                clusterAttributes.zIndex = TCNDayViewLayoutZIndexEventItem + (NSInteger)itemStackOrder;
+                TCNEventCellLayoutAttributes *const eventAttributes = TCN_CAST_OR_NIL(clusterAttributes, TCNEventCellLayoutAttributes);
+                if (eventAttributes) {
+                    TCNOverlapPlacement placement = eventAttributes.placement;
+                    placement.stackOrder = itemStackOrder;
+                    eventAttributes.placement = placement;
+                }
+                sectionItemAttributes[extents[index].item] = clusterAttributes;
+            }
+        }
+
+        // Only clusters of more than one item are stacked
+        if (clusterCount > 1) {
+            stackOrder += (uint32_t)clusterCount;
+        }
+        clusterStart = clusterEnd;
+    }
+
+    free(extents);
+}
+
 - (nonnull UICollectionViewLayoutAttributes *)prepareLayoutForDarkGridlineWithIndexPath:(nonnull NSIndexPath *)indexPath
                                                                       calendarGridWidth:(CGFloat)calendarGridWidth
                                                                        calendarGridMinX:(CGFloat)calendarGridMinX
@@ -217,25 +959,38 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
                                                                    calendarGridMinX:(CGFloat)calendarGridMinX
                                                                    calendarGridMinY:(CGFloat)calendarGridMinY
                                                                    calendarGridMaxX:(CGFloat)calendarGridMaxX {
-    UICollectionViewLayoutAttributes *const itemAttributes = [UICollectionViewLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
+    const NSInteger itemStartMinute = [self startMinuteForIndexPath:indexPath];
+    const NSInteger itemEndMinute = [self endMinuteForIndexPath:indexPath];
+    if (itemStartMinute == NSNotFound || itemEndMinute == NSNotFound) {
+        return [TCNEventCellLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
+    }
 
-    NSDateComponents *const itemStartTime = [self startTimeForIndexPath:indexPath];
-    NSDateComponents *const itemEndTime = [self endTimeForIndexPath:indexPath];
-    if (!itemStartTime || !itemEndTime) {
-        return itemAttributes;
-    }
+    const TCNDayViewLayoutItemTimeRange timeRange = {itemStartMinute, itemEndMinute, YES};
+    return [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                             timeRange:timeRange
+                                      calendarGridMinX:calendarGridMinX
+                                      calendarGridMinY:calendarGridMinY
+                                      calendarGridMaxX:calendarGridMaxX];
+}
+
+- (nonnull UICollectionViewLayoutAttributes *)prepareLayoutForEventItemsAtIndexPath:(nonnull NSIndexPath *)indexPath
+                                                                          timeRange:(TCNDayViewLayoutItemTimeRange)timeRange
+                                                                   calendarGridMinX:(CGFloat)calendarGridMinX
+                                                                   calendarGridMinY:(CGFloat)calendarGridMinY
+                                                                   calendarGridMaxX:(CGFloat)calendarGridMaxX {
+    UICollectionViewLayoutAttributes *const itemAttributes = [TCNEventCellLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
 
     // Don't lay out something that has the same start and end time.
-    if ([itemStartTime isEqual:itemEndTime]) {
+    if (timeRange.startMinute == timeRange.endMinute) {
         itemAttributes.frame = CGRectZero;
         return itemAttributes;
     }
 
-    const CGFloat startHourY = itemStartTime.hour * HourHeight;
-    const CGFloat startMinuteY = itemStartTime.minute * MinuteHeight;
+    const CGFloat startHourY = (timeRange.startMinute / 60) * HourHeight;
+    const CGFloat startMinuteY = (timeRange.startMinute % 60) * MinuteHeight;
 
-    const CGFloat endHourY = itemEndTime.hour * HourHeight;
-    const CGFloat endMinuteY = itemEndTime.minute * MinuteHeight;
+    const CGFloat endHourY = (timeRange.endMinute / 60) * HourHeight;
+    const CGFloat endMinuteY = (timeRange.endMinute % 60) * MinuteHeight;
 
     const CGFloat itemMinY = [TCNNumberHelper ceil:(startHourY + startMinuteY + calendarGridMinY + CellMargin.top)];
     const CGFloat itemMaxY = [TCNNumberHelper ceil:(endHourY + endMinuteY + calendarGridMinY - CellMargin.bottom)];
@@ -247,167 +1002,221 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
     return itemAttributes;
 }
 
-- (nullable NSDateComponents *)startTimeForIndexPath:(nonnull NSIndexPath *)indexPath {
+/**
+ Asks the delegate for the time ranges of every item in @c section in one call.
+
+ @return A buffer of @c count time ranges that the caller must free, or @c NULL if the delegate doesn't provide them.
+ */
+- (nullable TCNDayViewLayoutItemTimeRange *)timeRangesBufferForItemsInSection:(NSInteger)section count:(NSInteger)count {
+    id<TCNDayViewLayoutDelegate> const delegate = self.delegate;
+    if (count <= 0 || ![delegate respondsToSelector:@selector(collectionView:layout:getTimeRanges:forItemsInSection:count:)]) {
+        return NULL;
+    }
+
+    TCNDayViewLayoutItemTimeRange *const timeRanges = calloc((size_t)count, sizeof(TCNDayViewLayoutItemTimeRange));
+    if (!timeRanges) {
+        return NULL;
+    }
+    if (![delegate collectionView:self.collectionView layout:self getTimeRanges:timeRanges forItemsInSection:section count:count]) {
+        free(timeRanges);
+        return NULL;
+    }
+    return timeRanges;
+}
+
+/**
+ The minute of the day at which the item at @c indexPath starts, or @c NSNotFound if it has no start time.
+ */
+- (NSInteger)startMinuteForIndexPath:(nonnull NSIndexPath *)indexPath {
     NSDate *const date = [self.delegate collectionView:self.collectionView layout:self startTimeForItemAtIndexPath:indexPath];
     if (!date) {
-        return nil;
+        return NSNotFound;
     }
-    NSDateComponents *const itemStartTimeDateComponents =
-    [[NSCalendar currentCalendar] componentsInTimeZone:[NSTimeZone localTimeZone]
-                                              fromDate:date];
-    return itemStartTimeDateComponents;
+    return [TCNCalendarContext.sharedContext minuteOfDayForDate:date];
 }
 
-- (nullable NSDateComponents *)endTimeForIndexPath:(nonnull NSIndexPath *)indexPath {
+/**
+ The minute of the day at which the item at @c indexPath ends, or @c NSNotFound if it has no end time.
+ */
+- (NSInteger)endMinuteForIndexPath:(nonnull NSIndexPath *)indexPath {
     NSDate *const date = [self.delegate collectionView:self.collectionView layout:self endTimeForItemAtIndexPath:indexPath];
     if (!date) {
-        return nil;
+        return NSNotFound;
     }
-
-    NSDateComponents *const itemEndTimeComponents =
-    [[NSCalendar currentCalendar] componentsInTimeZone:[NSTimeZone localTimeZone] fromDate:date];
-    return itemEndTimeComponents;
+    return [TCNCalendarContext.sharedContext minuteOfDayForDate:date];
 }
 
 - (void)adjustItemsForOverlap:(nonnull NSArray<UICollectionViewLayoutAttributes *> *)sectionItemAttributes
                     inSection:(__unused NSInteger)section
                   sectionMinX:(__unused CGFloat)sectionMinX
              calendarGridMinX:(CGFloat)calendarGridMinX
-             calendarGridMaxX:(CGFloat)calendarGridMaxX {
-    NSMutableSet<UICollectionViewLayoutAttributes *> *const adjustedAttributes = [[NSMutableSet alloc] init];
-    NSInteger sectionZ = TCNDayViewLayoutZIndexEventItem;
-
-    for (UICollectionViewLayoutAttributes *itemAttributes in sectionItemAttributes) {
-        // If an item's already been adjusted, move on to the next one
-        if ([adjustedAttributes containsObject:itemAttributes]) {
-            continue;
-        }
+             calendarGridMaxX:(CGFloat)calendarGridMaxX
+              firstStackOrder:(uint32_t)firstStackOrder {
+    const NSUInteger itemCount = sectionItemAttributes.count;
+    if (itemCount < 2) {
+        return;
+    }
 
-        // Find the other items that overlap with this item
-        NSMutableArray<UICollectionViewLayoutAttributes *> *const overlappingItems = [[NSMutableArray alloc] init];
-        const CGRect itemFrame = itemAttributes.frame;
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameOverlapAdjustment);
+    TCNOverlapInterval *const intervals = malloc(itemCount * sizeof(TCNOverlapInterval));
+    TCNOverlapPlacement *const placements = malloc(itemCount * sizeof(TCNOverlapPlacement));
+    if (!intervals || !placements) {
+        free(intervals);
+        free(placements);
+        TCNTraceEnd(traceInterval);
+        TCN_ASSERT_FAILURE(@"Unable to allocate overlap adjustment buffers for %lu items", (unsigned long)itemCount);
+        return;
+    }
 
-        NSPredicate *const predicate =
-        [NSPredicate predicateWithBlock:^BOOL(UICollectionViewLayoutAttributes *layoutAttributes, __unused NSDictionary *bindings) {
-            return ([self.delegate collectionView:self.collectionView layout:self shouldAdjustLayoutForItemAtIndexPath:layoutAttributes.indexPath]
-                    && layoutAttributes != itemAttributes)
-            ? CGRectIntersectsRect(itemFrame, layoutAttributes.frame)
-            : NO;
-        }];
-        NSArray<UICollectionViewLayoutAttributes *> *const filteredItemAttributes = [sectionItemAttributes filteredArrayUsingPredicate:predicate];
-        [overlappingItems addObjectsFromArray:filteredItemAttributes];
+    for (NSUInteger index = 0; index < itemCount; index++) {
+        const CGRect itemFrame = sectionItemAttributes[index].frame;
+        intervals[index] = (TCNOverlapInterval){CGRectGetMinY(itemFrame), CGRectGetMaxY(itemFrame)};
+    }
 
-        // If there are items overlapping, we need to adjust them
-        if (!overlappingItems.count) {
-            continue;
-        }
+    if (TCNOverlapEngineComputePlacementsFromStackOrder(intervals, itemCount, firstStackOrder, placements) != 0) {
+        free(intervals);
+        free(placements);
+        TCNTraceEnd(traceInterval);
+        TCN_ASSERT_FAILURE(@"Unable to compute overlap placements for %lu items", (unsigned long)itemCount);
+        return;
+    }
 
-        // Add the item we're adjusting to the overlap set
-        [overlappingItems insertObject:itemAttributes atIndex:0];
+    for (NSUInteger index = 0; index < itemCount; index++) {
+        const TCNOverlapPlacement placement = placements[index];
 
-        // Find the minY and maxY of the set
-        CGFloat minY = CGFLOAT_MAX;
-        CGFloat maxY = CGFLOAT_MIN;
-        for (UICollectionViewLayoutAttributes *overlappingItemAttributes in overlappingItems) {
-            minY = MIN(CGRectGetMinY(overlappingItemAttributes.frame), minY);
-            maxY = MAX(CGRectGetMaxY(overlappingItemAttributes.frame), maxY);
-        }
-
-        // Determine the number of divisions needed (maximum number of currently overlapping items)
-        NSInteger divisions = 1;
-        for (NSInteger currentY = lround(minY); currentY <= maxY; currentY ++) {
-            NSInteger numberItemsForCurrentY = 0;
-            for (UICollectionViewLayoutAttributes *overlappingItemAttributes in overlappingItems) {
-                if ((currentY >= CGRectGetMinY(overlappingItemAttributes.frame)) && (currentY < CGRectGetMaxY(overlappingItemAttributes.frame))) {
-                    numberItemsForCurrentY++;
-                }
-            }
-            divisions = MAX(numberItemsForCurrentY, divisions);
+        // Items that don't overlap anything keep their full width and default zIndex
+        if (placement.columnCount < 2) {
+            continue;
         }
 
-        // Adjust the items to have a width of the section size divided by the number of divisions needed
-        const CGFloat divisionWidth = (calendarGridMaxX - calendarGridMinX) / divisions;
-
-        NSMutableArray *const dividedAttributes = [[NSMutableArray alloc] init];
-        for (UICollectionViewLayoutAttributes *divisionAttributes in overlappingItems) {
-            const CGFloat itemWidth = (divisionWidth - CellMargin.left - CellMargin.right);
-
-            // It it hasn't yet been adjusted, perform adjustment
-            if (![adjustedAttributes containsObject:divisionAttributes]) {
-                CGRect divisionAttributesFrame = divisionAttributes.frame;
-                divisionAttributesFrame.origin.x = (calendarGridMinX + CellMargin.left);
-                divisionAttributesFrame.size.width = itemWidth;
-
-                // Horizontal Layout
-                NSInteger adjustments = 1;
-                for (UICollectionViewLayoutAttributes *dividedItemAttributes in dividedAttributes) {
-                    if (CGRectIntersectsRect(dividedItemAttributes.frame, divisionAttributesFrame)) {
-                        divisionAttributesFrame.origin.x = calendarGridMinX + ((divisionWidth * adjustments) + CellMargin.left);
-                        adjustments++;
-                    }
-                }
-
-                // Stacking (lower items stack above higher items, since the title is at the top)
-                divisionAttributes.zIndex = sectionZ;
-                sectionZ++;
-
-                divisionAttributes.frame = divisionAttributesFrame;
-                [dividedAttributes addObject:divisionAttributes];
-                [adjustedAttributes addObject:divisionAttributes];
-            }
-        }
+        // Adjust the items to have a width of the section size divided by the number of columns in their overlap cluster
+        UICollectionViewLayoutAttributes *const itemAttributes = sectionItemAttributes[index];
+        const CGFloat divisionWidth = (calendarGridMaxX - calendarGridMinX) / placement.columnCount;
+        CGRect itemFrame = itemAttributes.frame;
+        itemFrame.origin.x = calendarGridMinX + (divisionWidth * placement.column) + CellMargin.left;
+        itemFrame.size.width = divisionWidth - CellMargin.left - CellMargin.right;
+        itemAttributes.frame = itemFrame;
+
+        // Stacking (lower items stack above higher items, since the title is at the top)
+        itemAttributes.zIndex = TCNDayViewLayoutZIndexEventItem + (NSInteger)placement.stackOrder;
+        TCN_CAST_OR_NIL(itemAttributes, TCNEventCellLayoutAttributes).placement = placement;
     }
+
+    free(intervals);
+    free(placements);
+    [self finishPass:traceInterval elementCount:(NSInteger)itemCount cacheHitCount:0 cacheLookupCount:0];
 }
 
 - (CGSize)collectionViewContentSize {
-    const CGFloat height = SectionHeight + ContentMargin.top + ContentMargin.bottom;
+    const CGFloat height = (SectionHeight * self.timeScale) + ContentMargin.top + ContentMargin.bottom;
     const CGFloat width = [self stackedSectionWidth];
     return CGSizeMake(width, height);
 }
 
 - (UICollectionViewLayoutAttributes *)layoutAttributesForItemAtIndexPath:(NSIndexPath *)indexPath {
-    return self.eventCellAttributes[indexPath];
+    // Items far from the visible area aren't laid out until asked for, e.g. when scrolling to them
+    if (indexPath.section >= 0
+        && indexPath.section < self.collectionView.numberOfSections
+        && ![self.preparedSections containsIndex:(NSUInteger)indexPath.section]) {
+        [self prepareSectionLayoutForSections:[NSIndexSet indexSetWithIndex:(NSUInteger)indexPath.section]];
+    }
+
+    UICollectionViewLayoutAttributes *const attributes = self.draggedEventCellAttributes[indexPath] ?: self.eventCellAttributes[indexPath];
+    if (!attributes && indexPath.section >= 0 && [self.backgroundLayoutSections containsIndex:(NSUInteger)indexPath.section]) {
+        // The item exists, but its frame is still being computed
+        UICollectionViewLayoutAttributes *const placeholderAttributes = [UICollectionViewLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
+        placeholderAttributes.hidden = YES;
+        return placeholderAttributes;
+    }
+    return [self scaledAttributes:attributes];
 }
 
 - (nullable UICollectionViewLayoutAttributes *)layoutAttributesForSupplementaryViewOfKind:(NSString *)kind atIndexPath:(NSIndexPath *)indexPath {
     if (![kind isEqualToString:TCNDayViewTimeView.reuseIdentifier]) {
         return nil;
     }
-    return self.timeViewAttributes[indexPath];
+    return [self scaledAttributes:self.timeViewAttributes[indexPath]];
 }
 
 - (nullable UICollectionViewLayoutAttributes *)layoutAttributesForDecorationViewOfKind:(NSString *)decorationViewKind atIndexPath:(NSIndexPath *)indexPath {
     if ([decorationViewKind isEqualToString:TCNDayViewGridlineView.darkKind]) {
-        return self.darkGridlineAttributes[indexPath];
+        return [self scaledAttributes:self.darkGridlineAttributes[indexPath]];
     } else if ([decorationViewKind isEqualToString:TCNDayViewGridlineView.lightKind]) {
-        return self.lightGridlineAttributes[indexPath];
+        return [self scaledAttributes:self.lightGridlineAttributes[indexPath]];
+    } else if ([decorationViewKind isEqualToString:TCNDayViewGridView.kind]) {
+        return [self scaledAttributes:self.gridAttributes[indexPath]];
     }
     return nil;
 }
 
 - (NSArray *)layoutAttributesForElementsInRect:(CGRect)rect {
-    // Return the visible attributes (rect intersection)
-    NSPredicate *const predicate =
-    [NSPredicate predicateWithBlock:^BOOL(UICollectionViewLayoutAttributes *layoutAttributes, __unused NSDictionary *bindings) {
-        return CGRectIntersectsRect(rect, layoutAttributes.frame);
-    }];
-    return [self.allAttributes filteredArrayUsingPredicate:predicate];
+    TCNRectIndex *const index = self.allAttributesIndex;
+    const size_t indexCount = TCNRectIndexCount(index);
+    if (indexCount == 0) {
+        return @[];
+    }
+
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameElementsInRect);
+    uint32_t *const candidates = TCN_FORCE_UNWRAP(self.allAttributesIndexResults);
+
+    // The index holds frames at a time scale of 1, so the rect is queried in the same space. Time views and gridlines keep
+    // their height when scaled, so one can reach into the rect from up to half its height away, which is further apart
+    // at a time scale of 1 when zoomed out.
+    const CGFloat unscaledPadding = (MAX(HourHeight, HorizontalGridlineHeight) / 2.0f) / self.timeScale;
+    const CGFloat unscaledMinY = [self unscaledYOffsetForYOffset:CGRectGetMinY(rect)] - unscaledPadding;
+    const CGFloat unscaledMaxY = [self unscaledYOffsetForYOffset:CGRectGetMaxY(rect)] + unscaledPadding;
+    const BOOL showsLightGridlines = [self showsLightGridlines];
+
+    // The index returns every frame near the rect; keep only the ones that truly intersect it once scaled
+    const TCNRectIndexRect queryRect = {CGRectGetMinX(rect), unscaledMinY, CGRectGetMaxX(rect), unscaledMaxY};
+    const size_t candidateCount = TCNRectIndexQuery(index, queryRect, candidates);
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const visibleAttributes = [[NSMutableArray alloc] initWithCapacity:candidateCount];
+    for (size_t candidate = 0; candidate < candidateCount; candidate++) {
+        UICollectionViewLayoutAttributes *const layoutAttributes = self.allAttributes[candidates[candidate]];
+        if (!showsLightGridlines && [layoutAttributes.representedElementKind isEqualToString:TCNDayViewGridlineView.lightKind]) {
+            continue;
+        }
+        if ([self isDraggedEventItem:layoutAttributes]) {
+            continue;
+        }
+        UICollectionViewLayoutAttributes *const scaledAttributes = TCN_FORCE_UNWRAP([self scaledAttributes:layoutAttributes]);
+        if (CGRectIntersectsRect(rect, scaledAttributes.frame)) {
+            [visibleAttributes addObject:scaledAttributes];
+        }
+    }
+
+    // Dragged items aren't in the index at their new frames
+    for (UICollectionViewLayoutAttributes *layoutAttributes in self.draggedEventCellAttributes.allValues) {
+        UICollectionViewLayoutAttributes *const scaledAttributes = TCN_FORCE_UNWRAP([self scaledAttributes:layoutAttributes]);
+        if (CGRectIntersectsRect(rect, scaledAttributes.frame)) {
+            [visibleAttributes addObject:scaledAttributes];
+        }
+    }
+
+    [self finishPass:traceInterval elementCount:(NSInteger)visibleAttributes.count cacheHitCount:0 cacheLookupCount:0];
+    return visibleAttributes;
 }
 
 - (void)invalidateLayoutCache {
     // Invalidate cached item attributes
+    [self destroyAllAttributesIndex];
     self.allAttributes = [[NSArray alloc] init];
+    [self.preparedSections removeAllIndexes];
     self.eventCellAttributes = [[NSDictionary alloc] init];
+    self.draggedEventCellAttributes = [[NSDictionary alloc] init];
     self.timeViewAttributes = [[NSDictionary alloc] init];
     self.darkGridlineAttributes = [[NSDictionary alloc] init];
     self.lightGridlineAttributes = [[NSDictionary alloc] init];
+    self.gridAttributes = [[NSDictionary alloc] init];
 }
 
 - (NSInteger)zIndexForElementKind:(nonnull NSString *)elementKind {
     if ([elementKind isEqualToString:TCNDayViewTimeView.reuseIdentifier]) {
         // Time Row Header
         return TCNDayViewLayoutZIndexTimeView;
-    } else if ([elementKind isEqualToString:TCNDayViewGridlineView.darkKind] || [elementKind isEqualToString:TCNDayViewGridlineView.lightKind]) {
+    } else if ([elementKind isEqualToString:TCNDayViewGridlineView.darkKind]
+               || [elementKind isEqualToString:TCNDayViewGridlineView.lightKind]
+               || [elementKind isEqualToString:TCNDayViewGridView.kind]) {
         // Horizontal Gridline
         return TCNDayViewLayoutZIndexGridline;
     }
@@ -415,15 +1224,753 @@ static const CGFloat MinuteHeight = HourHeight / 60.0f;
     return TCNDayViewLayoutZIndexEventItem;
 }
 
+- (BOOL)eventItemFramesDependOnItemIndex {
+    return NO;
+}
+
+#pragma mark Section Width
+
+/**
+ Moves everything laid out to where it is in sections of @c sectionWidth, without asking the delegate for anything.
+ Time views and gridlines only depend on the section geometry, and events keep their time ranges and overlap placements,
+ so they are placed again the same way as when they are shown from a layout snapshot. Layouts whose events depend on
+ their index lay their events out again instead.
+ */
+- (void)reprojectLayoutForSectionWidth:(CGFloat)sectionWidth {
+    // Background results and dragged items were laid out at the previous width
+    [self discardBackgroundEventLayout];
+    self.draggedEventCellAttributes = [[NSDictionary alloc] init];
+    self.preparedSectionWidth = sectionWidth;
+
+    // Every cached time view and gridline is in a prepared section
+    self.timeViewAttributes = [[NSDictionary alloc] init];
+    self.darkGridlineAttributes = [[NSDictionary alloc] init];
+    self.lightGridlineAttributes = [[NSDictionary alloc] init];
+    self.gridAttributes = [[NSDictionary alloc] init];
+    [self prepareStaticLayoutForSections:self.preparedSections];
+
+    if (self.needsFullEventLayout || self.eventItemFramesDependOnItemIndex) {
+        self.needsFullEventLayout = YES;
+        return;
+    }
+
+    NSMutableDictionary<NSNumber *, NSMutableArray<TCNEventCellLayoutAttributes *> *> *const attributesBySection = [[NSMutableDictionary alloc] init];
+    for (UICollectionViewLayoutAttributes *attributes in self.eventCellAttributes.allValues) {
+        TCNEventCellLayoutAttributes *const eventAttributes = TCN_CAST_OR_NIL(attributes, TCNEventCellLayoutAttributes);
+        if (!eventAttributes) {
+            self.needsFullEventLayout = YES;
+            return;
+        }
+        NSMutableArray<TCNEventCellLayoutAttributes *> *const sectionAttributes = attributesBySection[@(eventAttributes.indexPath.section)] ?: [[NSMutableArray alloc] init];
+        [sectionAttributes addObject:eventAttributes];
+        attributesBySection[@(eventAttributes.indexPath.section)] = sectionAttributes;
+    }
+
+    NSMutableDictionary *const eventCellAttributeCache = [[NSMutableDictionary alloc] initWithCapacity:self.eventCellAttributes.count];
+    for (NSNumber *section in attributesBySection) {
+        NSArray<TCNEventCellLayoutAttributes *> *const sectionAttributes = attributesBySection[section];
+        const size_t count = sectionAttributes.count;
+        TCNLayoutSnapshotRecord *const records = calloc(count, sizeof(TCNLayoutSnapshotRecord));
+        TCNEventGeometryFrame *const frames = malloc(count * sizeof(TCNEventGeometryFrame));
+        if (!records || !frames) {
+            free(records);
+            free(frames);
+            TCN_ASSERT_FAILURE(@"Unable to allocate reprojection buffers for %lu items", (unsigned long)count);
+            self.needsFullEventLayout = YES;
+            return;
+        }
+
+        for (size_t index = 0; index < count; index++) {
+            TCNEventCellLayoutAttributes *const attributes = sectionAttributes[index];
+            const CGRect frame = attributes.frame;
+            const TCNOverlapPlacement placement = attributes.placement;
+            const BOOL isEmpty = CGRectEqualToRect(frame, CGRectZero) && placement.columnCount < 2;
+            records[index] = (TCNLayoutSnapshotRecord){
+                .minY = CGRectGetMinY(frame),
+                .height = CGRectGetHeight(frame),
+                .column = placement.column,
+                .columnCount = placement.columnCount,
+                .stackOrder = placement.stackOrder,
+                .flags = isEmpty ? TCNLayoutSnapshotRecordFlagEmpty : 0u,
+            };
+        }
+
+        const TCNEventGeometryMetrics metrics = [self eventGeometryMetricsForSection:section.integerValue];
+        TCNLayoutSnapshotComputeFrames(&metrics, records, count, frames);
+        for (size_t index = 0; index < count; index++) {
+            // Attributes may still be in use by the collection view, so the moved frames are set on copies
+            TCNEventCellLayoutAttributes *const attributes = [sectionAttributes[index] copy];
+            attributes.frame = CGRectMake((CGFloat)frames[index].minX, (CGFloat)frames[index].minY, (CGFloat)frames[index].width, (CGFloat)frames[index].height);
+            eventCellAttributeCache[attributes.indexPath] = attributes;
+        }
+        free(records);
+        free(frames);
+    }
+    self.eventCellAttributes = eventCellAttributeCache;
+}
+
+#pragma mark Event Dragging
+
+- (nullable NSIndexPath *)indexPathForEventItemAtPoint:(CGPoint)point {
+    const CGPoint unscaledPoint = CGPointMake(point.x, [self unscaledYOffsetForYOffset:point.y]);
+    UICollectionViewLayoutAttributes *topmostAttributes = nil;
+    for (UICollectionViewLayoutAttributes *attributes in self.draggedEventCellAttributes.allValues) {
+        if (CGRectContainsPoint(attributes.frame, unscaledPoint) && (!topmostAttributes || attributes.zIndex > topmostAttributes.zIndex)) {
+            topmostAttributes = attributes;
+        }
+    }
+
+    TCNRectIndex *const index = self.allAttributesIndex;
+    uint32_t *const candidates = self.allAttributesIndexResults;
+    const TCNRectIndexRect queryRect = {unscaledPoint.x, unscaledPoint.y, unscaledPoint.x, unscaledPoint.y};
+    const size_t candidateCount = index && candidates ? TCNRectIndexQuery(index, queryRect, candidates) : 0;
+    for (size_t candidate = 0; candidate < candidateCount; candidate++) {
+        UICollectionViewLayoutAttributes *const attributes = self.allAttributes[candidates[candidate]];
+        if (attributes.representedElementCategory != UICollectionElementCategoryCell || [self isDraggedEventItem:attributes]) {
+            continue;
+        }
+        if (CGRectContainsPoint(attributes.frame, unscaledPoint) && (!topmostAttributes || attributes.zIndex > topmostAttributes.zIndex)) {
+            topmostAttributes = attributes;
+        }
+    }
+
+    return topmostAttributes.indexPath;
+}
+
+- (void)dragEventItemAtIndexPath:(nonnull NSIndexPath *)indexPath toStartMinute:(NSInteger)startMinute endMinute:(NSInteger)endMinute {
+    const NSInteger section = indexPath.section;
+    UICollectionViewLayoutAttributes *const attributes = self.eventCellAttributes[indexPath];
+    if (!attributes || self.eventItemFramesDependOnItemIndex) {
+        return;
+    }
+
+    const CGFloat calendarGridMinY = ContentMargin.top;
+    const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
+    const CGFloat eventMaxX = sectionMinX + [self sectionWidth] - EventRightInset;
+    const CGFloat calendarGridMinX = sectionMinX + TimeViewWidth + ContentMargin.left;
+
+    const TCNDayViewLayoutItemTimeRange timeRange = {startMinute, endMinute, YES};
+    UICollectionViewLayoutAttributes *const draggedAttributes = [self prepareLayoutForEventItemsAtIndexPath:indexPath
+                                                                                                  timeRange:timeRange
+                                                                                           calendarGridMinX:calendarGridMinX
+                                                                                           calendarGridMinY:calendarGridMinY
+                                                                                           calendarGridMaxX:eventMaxX];
+    NSMutableArray<NSValue *> *const changedFrames = [[NSMutableArray alloc] init];
+    if (attributes.zIndex == UnadjustedEventItemZIndex) {
+        draggedAttributes.zIndex = UnadjustedEventItemZIndex;
+    } else {
+        [changedFrames addObject:[NSValue valueWithCGRect:attributes.frame]];
+        [changedFrames addObject:[NSValue valueWithCGRect:draggedAttributes.frame]];
+    }
+
+    // Every drag starts again from the cached layout, so the cluster the item left is adjusted again without it
+    const NSInteger numberOfItems = [self.collectionView numberOfItemsInSection:section];
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const sectionItemAttributes = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)MAX(0, numberOfItems)];
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        UICollectionViewLayoutAttributes *const itemAttributes = item == indexPath.item
+            ? draggedAttributes
+            : self.eventCellAttributes[[NSIndexPath indexPathForItem:item inSection:section]];
+        if (!itemAttributes) {
+            return;
+        }
+        [sectionItemAttributes addObject:itemAttributes];
+    }
+    [self readjustOverlapClustersInItemAttributes:sectionItemAttributes
+                                    changedFrames:changedFrames
+                                        inSection:section
+                                      sectionMinX:sectionMinX
+                                 calendarGridMinX:calendarGridMinX
+                                 calendarGridMaxX:eventMaxX];
+
+    NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *const draggedEventCellAttributes = [[NSMutableDictionary alloc] init];
+    for (UICollectionViewLayoutAttributes *itemAttributes in sectionItemAttributes) {
+        if (itemAttributes != self.eventCellAttributes[itemAttributes.indexPath]) {
+            draggedEventCellAttributes[itemAttributes.indexPath] = itemAttributes;
+        }
+    }
+    [self showDraggedEventCellAttributes:draggedEventCellAttributes];
+}
+
+- (void)endEventItemDrag {
+    [self showDraggedEventCellAttributes:[[NSDictionary alloc] init]];
+}
+
+/**
+ Shows @c draggedEventCellAttributes instead of the cached attributes of their items, and invalidates only the items
+ that change.
+ */
+- (void)showDraggedEventCellAttributes:(nonnull NSDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)draggedEventCellAttributes {
+    NSMutableSet<NSIndexPath *> *const invalidatedIndexPaths = [[NSMutableSet alloc] initWithArray:self.draggedEventCellAttributes.allKeys];
+    [invalidatedIndexPaths addObjectsFromArray:draggedEventCellAttributes.allKeys];
+    self.draggedEventCellAttributes = draggedEventCellAttributes;
+    if (invalidatedIndexPaths.count == 0) {
+        return;
+    }
+
+    TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+    context.invalidateDraggedEvent = YES;
+    [context invalidateItemsAtIndexPaths:invalidatedIndexPaths.allObjects];
+    [self invalidateLayoutWithContext:context];
+}
+
+/**
+ Whether @c attributes are the cached attributes of an item that is shown elsewhere while it, or an item it overlaps,
+ is dragged.
+ */
+- (BOOL)isDraggedEventItem:(nonnull UICollectionViewLayoutAttributes *)attributes {
+    return self.draggedEventCellAttributes.count > 0
+        && attributes.representedElementCategory == UICollectionElementCategoryCell
+        && self.draggedEventCellAttributes[attributes.indexPath] != nil;
+}
+
+#pragma mark Time Scale
+
+/**
+ The attributes as they appear at the current @c timeScale. Event cells stretch with the time they cover, while time
+ views and gridlines keep their height and only move. A static grid is stretched as a whole.
+
+ @param attributes Attributes laid out at a time scale of 1.
+ @return A scaled copy of @c attributes, or @c attributes itself at a time scale of 1.
+ */
+- (nullable UICollectionViewLayoutAttributes *)scaledAttributes:(nullable UICollectionViewLayoutAttributes *)attributes {
+    if (!attributes || self.timeScale == 1) {
+        return attributes;
+    }
+
+    UICollectionViewLayoutAttributes *const scaledAttributes = TCN_CAST_OR_NIL([attributes copy], UICollectionViewLayoutAttributes);
+    if (!scaledAttributes) {
+        return attributes;
+    }
+    const CGRect frame = attributes.frame;
+    NSString *const kind = attributes.representedElementKind;
+    if (attributes.representedElementCategory == UICollectionElementCategoryCell) {
+        const CGFloat minY = [self yOffsetForUnscaledYOffset:CGRectGetMinY(frame)];
+        const CGFloat maxY = [self yOffsetForUnscaledYOffset:CGRectGetMaxY(frame)];
+        scaledAttributes.frame = CGRectMake(CGRectGetMinX(frame), minY, CGRectGetWidth(frame), maxY - minY);
+    } else if ([kind isEqualToString:TCNDayViewGridView.kind]) {
+        // Stretching the rendered grid avoids drawing it again on every frame of a pinch
+        scaledAttributes.center = CGPointMake(attributes.center.x, [self yOffsetForUnscaledYOffset:attributes.center.y]);
+        scaledAttributes.transform = CGAffineTransformMakeScale(1, self.timeScale);
+    } else {
+        scaledAttributes.center = CGPointMake(attributes.center.x, [self yOffsetForUnscaledYOffset:attributes.center.y]);
+        if ([kind isEqualToString:TCNDayViewGridlineView.lightKind] && ![self showsLightGridlines]) {
+            scaledAttributes.hidden = YES;
+        }
+    }
+    return scaledAttributes;
+}
+
+/**
+ Whether half-hour gridlines are shown. They are dropped once an hour is too short to tell them from the hour gridlines.
+ */
+- (BOOL)showsLightGridlines {
+    return HourHeight * self.timeScale >= MinimumLightGridlineHourHeight;
+}
+
+#pragma mark Background Event Layout
+
+- (void)prepareEventLayoutInBackgroundWithCompletion:(nullable void (^)(BOOL finished))completion {
+    [self discardBackgroundEventLayout];
+
+    // Layouts that place events by index rather than by time are laid out on the main thread as usual
+    NSIndexSet *const sections = [self sectionIndexesNearRect:self.collectionView.bounds];
+    if (self.eventItemFramesDependOnItemIndex || sections.count == 0) {
+        if (completion) {
+            completion(NO);
+        }
+        return;
+    }
+
+    // The delegate is only read here, on the main thread. The operation works on copies of its answers.
+    NSMutableDictionary<NSNumber *, NSData *> *const inputsBySection = [[NSMutableDictionary alloc] init];
+    NSMutableDictionary<NSNumber *, NSData *> *const metricsBySection = [[NSMutableDictionary alloc] init];
+    [sections enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
+        const NSInteger section = (NSInteger)index;
+        const TCNEventGeometryMetrics metrics = [self eventGeometryMetricsForSection:section];
+        inputsBySection[@(section)] = [self eventGeometryInputsForSection:section];
+        metricsBySection[@(section)] = [NSData dataWithBytes:&metrics length:sizeof(TCNEventGeometryMetrics)];
+    }];
+
+    NSBlockOperation *const operation = [[NSBlockOperation alloc] init];
+    __weak NSBlockOperation *const weakOperation = operation;
+    __weak typeof(self) weakSelf = self;
+    [operation addExecutionBlock:^{
+        NSBlockOperation *const strongOperation = weakOperation;
+        NSMutableDictionary<NSNumber *, NSData *> *const framesBySection = [[NSMutableDictionary alloc] init];
+        for (NSNumber *section in inputsBySection) {
+            if (strongOperation.isCancelled) {
+                break;
+            }
+
+            NSData *const inputs = inputsBySection[section];
+            const size_t count = inputs.length / sizeof(TCNEventGeometryInput);
+            NSMutableData *const frames = [[NSMutableData alloc] initWithLength:count * sizeof(TCNEventGeometryFrame)];
+            const TCNEventGeometryMetrics *const metrics = metricsBySection[section].bytes;
+            if (TCNEventGeometryEngineComputeFrames(metrics, inputs.bytes, count, frames.mutableBytes) == 0) {
+                framesBySection[section] = frames;
+            }
+        }
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+            // A cancelled operation has already reported that it didn't finish
+            typeof(self) strongSelf = weakSelf;
+            if (!strongSelf || strongOperation.isCancelled || strongSelf.backgroundLayoutOperation != strongOperation) {
+                return;
+            }
+
+            void (^const finishedCompletion)(BOOL) = strongSelf.backgroundLayoutCompletion;
+            strongSelf.backgroundLayoutOperation = nil;
+            strongSelf.backgroundLayoutCompletion = nil;
+            strongSelf.backgroundLayoutSections = [[NSIndexSet alloc] init];
+            strongSelf.backgroundEventInputs = inputsBySection;
+            strongSelf.backgroundEventFrames = framesBySection;
+
+            // A plain context, so that the invalidation isn't mistaken for a data change that makes the results stale
+            [strongSelf invalidateLayoutWithContext:[[TCNDayViewLayoutInvalidationContext alloc] init]];
+            if (finishedCompletion) {
+                finishedCompletion(YES);
+            }
+        });
+    }];
+
+    self.backgroundLayoutOperation = operation;
+    self.backgroundLayoutCompletion = completion;
+    self.backgroundLayoutSections = sections;
+    [self.backgroundLayoutQueue addOperation:operation];
+}
+
+- (void)cancelBackgroundEventLayout {
+    if (!self.backgroundLayoutOperation) {
+        return;
+    }
+    [self discardBackgroundEventLayout];
+    [self invalidateLayout];
+}
+
+/**
+ Cancels any background event layout without invalidating the layout. Sections it skipped are laid out by the next full
+ event layout pass.
+ */
+- (void)discardBackgroundEventLayout {
+    if (self.backgroundLayoutOperation) {
+        void (^const cancelledCompletion)(BOOL) = self.backgroundLayoutCompletion;
+        [self.backgroundLayoutOperation cancel];
+        self.backgroundLayoutOperation = nil;
+        self.backgroundLayoutCompletion = nil;
+        self.needsFullEventLayout = YES;
+        if (cancelledCompletion) {
+            cancelledCompletion(NO);
+        }
+    }
+    self.backgroundLayoutSections = [[NSIndexSet alloc] init];
+    self.backgroundEventInputs = [[NSDictionary alloc] init];
+    self.backgroundEventFrames = [[NSDictionary alloc] init];
+}
+
+/**
+ Lays out the events of @c section on the calling thread with @c TCNEventGeometryEngine, and adds them to
+ @c eventCellAttributes.
+
+ @return NO if the engine couldn't allocate its buffers, in which case the events should be laid out item by item.
+ */
+- (BOOL)prepareEngineEventLayoutInSection:(NSInteger)section
+                            numberOfItems:(NSInteger)numberOfItems
+                      eventCellAttributes:(nonnull NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)eventCellAttributes {
+    NSData *const inputData = [self eventGeometryInputsForSection:section];
+    const size_t count = inputData.length / sizeof(TCNEventGeometryInput);
+    if (count != (size_t)MAX(0, numberOfItems)) {
+        return NO;
+    }
+
+    NSMutableData *const frameData = [[NSMutableData alloc] initWithLength:count * sizeof(TCNEventGeometryFrame)];
+    const TCNEventGeometryMetrics metrics = [self eventGeometryMetricsForSection:section];
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameOverlapAdjustment);
+    if (TCNEventGeometryEngineComputeFrames(&metrics, inputData.bytes, count, frameData.mutableBytes) != 0) {
+        TCNTraceEnd(traceInterval);
+        TCN_ASSERT_FAILURE(@"Unable to compute event frames for %lu items", (unsigned long)count);
+        return NO;
+    }
+    [self finishPass:traceInterval elementCount:(NSInteger)count cacheHitCount:0 cacheLookupCount:0];
+
+    const TCNEventGeometryInput *const inputs = inputData.bytes;
+    const TCNEventGeometryFrame *const frames = frameData.bytes;
+    for (size_t item = 0; item < count; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:(NSInteger)item inSection:section];
+        eventCellAttributes[indexPath] = [self eventCellAttributesWithIndexPath:indexPath
+                                                                          frame:frames[item]
+                                                             shouldAdjustLayout:inputs[item].shouldAdjustLayout];
+    }
+    return YES;
+}
+
+/**
+ Adds the background results for @c section to @c eventCellAttributes.
+
+ @return NO if there are no results for @c section, or they were computed for a different number of items.
+ */
+- (BOOL)installBackgroundEventLayoutInSection:(NSInteger)section
+                                numberOfItems:(NSInteger)numberOfItems
+                          eventCellAttributes:(nonnull NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)eventCellAttributes {
+    NSData *const inputData = self.backgroundEventInputs[@(section)];
+    NSData *const frameData = self.backgroundEventFrames[@(section)];
+    if (!inputData || !frameData
+        || numberOfItems < 0
+        || inputData.length != (NSUInteger)numberOfItems * sizeof(TCNEventGeometryInput)
+        || frameData.length != (NSUInteger)numberOfItems * sizeof(TCNEventGeometryFrame)) {
+        return NO;
+    }
+
+    const TCNEventGeometryInput *const inputs = inputData.bytes;
+    const TCNEventGeometryFrame *const frames = frameData.bytes;
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+        eventCellAttributes[indexPath] = [self eventCellAttributesWithIndexPath:indexPath
+                                                                          frame:frames[item]
+                                                             shouldAdjustLayout:inputs[item].shouldAdjustLayout];
+    }
+    return YES;
+}
+
+/**
+ The attributes of an event item with a frame computed by @c TCNEventGeometryEngine, with the same zIndex as an item
+ laid out by @c prepareLayoutForEventItemsAtIndexPath: and @c adjustItemsForOverlap:.
+ */
+- (nonnull UICollectionViewLayoutAttributes *)eventCellAttributesWithIndexPath:(nonnull NSIndexPath *)indexPath
+                                                                         frame:(TCNEventGeometryFrame)frame
+                                                            shouldAdjustLayout:(BOOL)shouldAdjustLayout {
+    TCNEventCellLayoutAttributes *const attributes = [TCNEventCellLayoutAttributes layoutAttributesForCellWithIndexPath:indexPath];
+    attributes.frame = CGRectMake((CGFloat)frame.minX, (CGFloat)frame.minY, (CGFloat)frame.width, (CGFloat)frame.height);
+    attributes.placement = frame.placement;
+    if (!shouldAdjustLayout) {
+        attributes.zIndex = UnadjustedEventItemZIndex;
+    } else if (frame.placement.columnCount > 1) {
+        attributes.zIndex = TCNDayViewLayoutZIndexEventItem + (NSInteger)frame.placement.stackOrder;
+    } else {
+        attributes.zIndex = [self zIndexForElementKind:TCNEventCell.reuseIdentifier];
+    }
+    return attributes;
+}
+
+- (TCNEventGeometryMetrics)eventGeometryMetricsForSection:(NSInteger)section {
+    const CGFloat sectionMinX = [self stackedSectionWidthUpToSection:section];
+    return (TCNEventGeometryMetrics){
+        .calendarGridMinX = sectionMinX + TimeViewWidth + ContentMargin.left,
+        .calendarGridMaxX = sectionMinX + [self sectionWidth] - EventRightInset,
+        .calendarGridMinY = ContentMargin.top,
+        .hourHeight = HourHeight,
+        .minuteHeight = MinuteHeight,
+        .marginTop = CellMargin.top,
+        .marginLeft = CellMargin.left,
+        .marginBottom = CellMargin.bottom,
+        .marginRight = CellMargin.right,
+    };
+}
+
+/**
+ Reads the time range of every item in @c section from the delegate, the same way a full layout pass does.
+ */
+- (nonnull NSData *)eventGeometryInputsForSection:(NSInteger)section {
+    const NSInteger numberOfItems = MAX(0, [self.collectionView numberOfItemsInSection:section]);
+    NSMutableData *const inputData = [[NSMutableData alloc] initWithLength:(NSUInteger)numberOfItems * sizeof(TCNEventGeometryInput)];
+    TCNEventGeometryInput *const inputs = inputData.mutableBytes;
+
+    TCNDayViewLayoutItemTimeRange *const timeRanges = [self timeRangesBufferForItemsInSection:section count:numberOfItems];
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        if (timeRanges) {
+            inputs[item] = (TCNEventGeometryInput){timeRanges[item].startMinute, timeRanges[item].endMinute, timeRanges[item].shouldAdjustLayout};
+            continue;
+        }
+
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+        const NSInteger itemStartMinute = [self startMinuteForIndexPath:indexPath];
+        const NSInteger itemEndMinute = [self endMinuteForIndexPath:indexPath];
+        const BOOL shouldAdjustLayout = [self.delegate collectionView:self.collectionView layout:self shouldAdjustLayoutForItemAtIndexPath:indexPath];
+        if (itemStartMinute == NSNotFound || itemEndMinute == NSNotFound) {
+            // Laid out with an empty frame, like a full layout pass does
+            inputs[item] = (TCNEventGeometryInput){0, 0, shouldAdjustLayout};
+            continue;
+        }
+        inputs[item] = (TCNEventGeometryInput){itemStartMinute, itemEndMinute, shouldAdjustLayout};
+    }
+    free(timeRanges);
+
+    return inputData;
+}
+
+#pragma mark Layout Snapshots
+
+- (TCNLayoutSnapshotKey)layoutSnapshotKeyForDate:(nonnull NSDate *)date dataVersion:(uint64_t)dataVersion {
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+
+    // Event frames also depend on the layout's vertical measurements and the time zone their times are shown in
+    const CGFloat measurements[] = {HourHeight, MinuteHeight, ContentMargin.top, CellMargin.top, CellMargin.bottom};
+    uint64_t configHash = TCNLayoutSnapshotHash(measurements, sizeof(measurements), TCNLayoutSnapshotHashSeed);
+    configHash = [TCNDayViewLayout layoutSnapshotHashForString:NSStringFromClass(self.class) hash:configHash];
+    configHash = [TCNDayViewLayout layoutSnapshotHashForString:calendarContext.timeZone.name hash:configHash];
+
+    return (TCNLayoutSnapshotKey){
+        .day = [calendarContext dayMinuteForDate:date].day,
+        .dataVersion = dataVersion,
+        .configHash = configHash,
+    };
+}
+
+- (void)prepareEventLayoutInSection:(NSInteger)section
+                       fromSnapshot:(nullable TCNDayViewLayoutSnapshot *)snapshot
+                                key:(TCNLayoutSnapshotKey)key
+                         completion:(nullable void (^)(TCNDayViewLayoutSnapshot *_Nullable currentSnapshot, BOOL snapshotWasCurrent))completion {
+    [self discardSnapshotVerification];
+
+    // Layouts that place events by index rather than by time can't show a snapshot at another width
+    if (self.eventItemFramesDependOnItemIndex || section < 0 || section >= self.collectionView.numberOfSections) {
+        if (completion) {
+            completion(nil, NO);
+        }
+        return;
+    }
+
+    // Without reading the events, the snapshot's key and event count are all there is to tell that it is current
+    TCNDayViewLayoutSnapshot *const previousSnapshot = self.eventSnapshots[@(section)];
+    NSMutableDictionary<NSNumber *, TCNDayViewLayoutSnapshot *> *const eventSnapshots = [self.eventSnapshots mutableCopy];
+    [eventSnapshots removeObjectForKey:@(section)];
+    if (snapshot && [TCN_FORCE_UNWRAP(snapshot) hasKey:key] && snapshot.count == [self.collectionView numberOfItemsInSection:section]) {
+        eventSnapshots[@(section)] = snapshot;
+    }
+    self.eventSnapshots = eventSnapshots;
+    if (previousSnapshot || eventSnapshots[@(section)]) {
+        [self invalidateLayoutWithContext:[[TCNDayViewLayoutInvalidationContext alloc] init]];
+    }
+
+    NSBlockOperation *const operation = [[NSBlockOperation alloc] init];
+    self.snapshotVerificationOperation = operation;
+    self.snapshotVerificationCompletion = completion;
+    self.snapshotVerificationSection = section;
+    self.snapshotVerificationReadEvents = NO;
+
+    // The events are read once the snapshot is drawn, so that verifying it doesn't delay the first frame
+    __weak typeof(self) weakSelf = self;
+    dispatch_async(dispatch_get_main_queue(), ^{
+        [weakSelf startSnapshotVerification:operation key:key snapshot:snapshot];
+    });
+}
+
+/**
+ Reads the events of the verified section on the main thread, and lays them out on the background queue.
+ */
+- (void)startSnapshotVerification:(nonnull NSBlockOperation *)operation
+                              key:(TCNLayoutSnapshotKey)key
+                         snapshot:(nullable TCNDayViewLayoutSnapshot *)snapshot {
+    if (operation.isCancelled || self.snapshotVerificationOperation != operation) {
+        return;
+    }
+
+    const NSInteger section = self.snapshotVerificationSection;
+    const TCNEventGeometryMetrics metrics = [self eventGeometryMetricsForSection:section];
+    NSData *const inputs = [self eventGeometryInputsForSection:section];
+    NSData *const identifiers = [self eventIdentifiersForSection:section];
+    self.snapshotVerificationReadEvents = YES;
+
+    __weak NSBlockOperation *const weakOperation = operation;
+    __weak typeof(self) weakSelf = self;
+    [operation addExecutionBlock:^{
+        NSBlockOperation *const strongOperation = weakOperation;
+        const size_t count = inputs.length / sizeof(TCNEventGeometryInput);
+        NSMutableData *const frames = [[NSMutableData alloc] initWithLength:count * sizeof(TCNEventGeometryFrame)];
+        NSMutableData *const records = [[NSMutableData alloc] initWithLength:count * sizeof(TCNLayoutSnapshotRecord)];
+        TCNDayViewLayoutSnapshot *currentSnapshot = nil;
+        if (!strongOperation.isCancelled && TCNEventGeometryEngineComputeFrames(&metrics, inputs.bytes, count, frames.mutableBytes) == 0) {
+            TCNLayoutSnapshotMakeRecords(inputs.bytes, frames.bytes, identifiers.bytes, count, records.mutableBytes);
+            currentSnapshot = [TCNDayViewLayoutSnapshot snapshotWithKey:key records:records.bytes count:(NSInteger)count];
+        }
+
+        dispatch_async(dispatch_get_main_queue(), ^{
+            // A cancelled verification has already reported that it didn't finish
+            typeof(self) strongSelf = weakSelf;
+            if (!strongSelf || strongOperation.isCancelled || strongSelf.snapshotVerificationOperation != strongOperation) {
+                return;
+            }
+            [strongSelf finishSnapshotVerificationInSection:section snapshot:snapshot currentSnapshot:currentSnapshot];
+        });
+    }];
+    [self.backgroundLayoutQueue addOperation:operation];
+}
+
+- (void)finishSnapshotVerificationInSection:(NSInteger)section
+                                   snapshot:(nullable TCNDayViewLayoutSnapshot *)snapshot
+                            currentSnapshot:(nullable TCNDayViewLayoutSnapshot *)currentSnapshot {
+    void (^const finishedCompletion)(TCNDayViewLayoutSnapshot *_Nullable, BOOL) = self.snapshotVerificationCompletion;
+    self.snapshotVerificationOperation = nil;
+    self.snapshotVerificationCompletion = nil;
+
+    BOOL snapshotWasCurrent = NO;
+    if (snapshot && currentSnapshot && [TCN_FORCE_UNWRAP(snapshot) hasKey:currentSnapshot.key] && snapshot.count == currentSnapshot.count) {
+        snapshotWasCurrent = TCNLayoutSnapshotRecordsEqual(snapshot.records, currentSnapshot.records, (size_t)currentSnapshot.count);
+    }
+
+    // Events shown from a snapshot that turned out stale move to their verified frames, without a main thread layout
+    if (self.eventSnapshots[@(section)] && !snapshotWasCurrent) {
+        NSMutableDictionary<NSNumber *, TCNDayViewLayoutSnapshot *> *const eventSnapshots = [self.eventSnapshots mutableCopy];
+        eventSnapshots[@(section)] = currentSnapshot;
+        self.eventSnapshots = eventSnapshots;
+        [self invalidateLayoutWithContext:[[TCNDayViewLayoutInvalidationContext alloc] init]];
+    }
+
+    if (finishedCompletion) {
+        finishedCompletion(currentSnapshot, snapshotWasCurrent);
+    }
+}
+
+/**
+ Cancels the verification of the latest snapshot, which reports that it didn't finish.
+ */
+- (void)discardSnapshotVerification {
+    if (!self.snapshotVerificationOperation) {
+        return;
+    }
+
+    void (^const cancelledCompletion)(TCNDayViewLayoutSnapshot *_Nullable, BOOL) = self.snapshotVerificationCompletion;
+    [self.snapshotVerificationOperation cancel];
+    self.snapshotVerificationOperation = nil;
+    self.snapshotVerificationCompletion = nil;
+    if (cancelledCompletion) {
+        cancelledCompletion(nil, NO);
+    }
+}
+
+/**
+ Stops showing snapshots once the events change. A snapshot whose verification hasn't read the events yet is kept,
+ since it is verified against the changed events.
+ */
+- (void)discardEventSnapshots {
+    if (self.snapshotVerificationOperation && !self.snapshotVerificationReadEvents) {
+        TCNDayViewLayoutSnapshot *const unverifiedSnapshot = self.eventSnapshots[@(self.snapshotVerificationSection)];
+        self.eventSnapshots = unverifiedSnapshot ? @{@(self.snapshotVerificationSection): TCN_FORCE_UNWRAP(unverifiedSnapshot)} : [[NSDictionary alloc] init];
+        return;
+    }
+
+    [self discardSnapshotVerification];
+    self.eventSnapshots = [[NSDictionary alloc] init];
+}
+
+/**
+ Adds the events of @c section to @c eventCellAttributes from its snapshot, at the current section width.
+
+ @return NO if there is no snapshot for @c section, or it was taken of a different number of items.
+ */
+- (BOOL)installSnapshotEventLayoutInSection:(NSInteger)section
+                              numberOfItems:(NSInteger)numberOfItems
+                        eventCellAttributes:(nonnull NSMutableDictionary<NSIndexPath *, UICollectionViewLayoutAttributes *> *)eventCellAttributes {
+    TCNDayViewLayoutSnapshot *const snapshot = self.eventSnapshots[@(section)];
+    if (!snapshot || snapshot.count != numberOfItems) {
+        return NO;
+    }
+
+    TCNEventGeometryFrame *const frames = malloc((size_t)numberOfItems * sizeof(TCNEventGeometryFrame));
+    if (numberOfItems > 0 && !frames) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate snapshot frame buffer for %ld items", (long)numberOfItems);
+        return NO;
+    }
+
+    const TCNEventGeometryMetrics metrics = [self eventGeometryMetricsForSection:section];
+    const TCNLayoutSnapshotRecord *const records = snapshot.records;
+    TCNLayoutSnapshotComputeFrames(&metrics, records, (size_t)numberOfItems, frames);
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+        eventCellAttributes[indexPath] = [self eventCellAttributesWithIndexPath:indexPath
+                                                                          frame:frames[item]
+                                                             shouldAdjustLayout:!(records[item].flags & TCNLayoutSnapshotRecordFlagUnadjusted)];
+    }
+    free(frames);
+    return YES;
+}
+
+/**
+ The hashes of the identifiers of the items in @c section, as an array of @c uint64_t, or nil if the delegate doesn't
+ identify items.
+ */
+- (nullable NSData *)eventIdentifiersForSection:(NSInteger)section {
+    id<TCNDayViewLayoutDelegate> const delegate = self.delegate;
+    if (![delegate respondsToSelector:@selector(collectionView:layout:identifierForItemAtIndexPath:)]) {
+        return nil;
+    }
+
+    const NSInteger numberOfItems = MAX(0, [self.collectionView numberOfItemsInSection:section]);
+    NSMutableData *const identifierData = [[NSMutableData alloc] initWithLength:(NSUInteger)numberOfItems * sizeof(uint64_t)];
+    uint64_t *const identifiers = identifierData.mutableBytes;
+    for (NSInteger item = 0; item < numberOfItems; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:section];
+        NSString *const identifier = [delegate collectionView:self.collectionView layout:self identifierForItemAtIndexPath:indexPath];
+        identifiers[item] = [TCNDayViewLayout layoutSnapshotHashForString:identifier hash:TCNLayoutSnapshotHashSeed];
+    }
+    return identifierData;
+}
+
++ (uint64_t)layoutSnapshotHashForString:(nonnull NSString *)string hash:(uint64_t)hash {
+    const char *const characters = string.UTF8String;
+    return characters ? TCNLayoutSnapshotHash(characters, strlen(characters), hash) : hash;
+}
+
+#pragma mark Calendar Changes
+
+/**
+ Lays everything out again once the calendar context changed, since the cached frames, background results and snapshots
+ were placed at minutes converted with the previous time zone or locale.
+ */
+- (void)invalidateLayoutForCalendarChange {
+    [self discardBackgroundEventLayout];
+    [self discardSnapshotVerification];
+    self.eventSnapshots = [[NSDictionary alloc] init];
+    self.preparedSectionCount = -1;
+    [self invalidateLayout];
+}
+
+#pragma mark Metrics
+
+/**
+ Ends a traced pass, and reports its measurements to the delegate if the layout measures passes.
+ */
+- (void)finishPass:(TCNTraceInterval)traceInterval
+      elementCount:(NSInteger)elementCount
+     cacheHitCount:(NSInteger)cacheHitCount
+  cacheLookupCount:(NSInteger)cacheLookupCount {
+    const NSTimeInterval duration = TCNTraceEnd(traceInterval);
+    id<TCNDayViewLayoutDelegate> const delegate = self.delegate;
+    if (!self.measuresPasses || ![delegate respondsToSelector:@selector(collectionView:layout:didMeasurePass:)]) {
+        return;
+    }
+
+    TCNPassMetrics *const metrics = [[TCNPassMetrics alloc] initWithName:traceInterval.name
+                                                                duration:duration
+                                                            elementCount:elementCount
+                                                           cacheHitCount:cacheHitCount
+                                                        cacheLookupCount:cacheLookupCount];
+    [delegate collectionView:self.collectionView layout:self didMeasurePass:metrics];
+}
+
 #pragma mark Section Sizing
 
 /**
- Returns the width of a particular section. In this case it will be the bound of the collectionView as a section takes up entire screen
+ Returns the width of a particular section. Unless @c columnWidth is set, it will be the bound of the collectionView as a section takes up entire screen
  */
 - (CGFloat)sectionWidth {
+    if (self.columnWidth > 0) {
+        return self.columnWidth;
+    }
     return CGRectGetWidth(self.collectionView.bounds);
 }
 
+- (CGFloat)fullEventItemWidth {
+    const CGFloat sectionWidth = [self sectionWidth];
+    if (sectionWidth <= 0) {
+        return 0;
+    }
+
+    // Matches the frame of an event that isn't overlap adjusted, in the first section
+    const CGFloat calendarGridMinX = TimeViewWidth + ContentMargin.left;
+    const CGFloat calendarGridMaxX = sectionWidth - EventRightInset;
+    return MAX(0, [TCNNumberHelper ceil:(calendarGridMaxX - CellMargin.right)] - [TCNNumberHelper ceil:(calendarGridMinX + CellMargin.left)]);
+}
+
 /**
  Returns the sum of the widths of all sections combined together
  */
@@ -0,0 +1,61 @@
+#import <UIKit/UIKit.h>
+
+/**
+ Describes event items inserted into or deleted from a @c TCNDayViewLayout, so that the layout can update only the
+ overlap clusters those events touch instead of rebuilding every attribute.
+
+ Invalidate the layout with this context inside the @c performBatchUpdates: block that inserts or deletes the items.
+ Deleted index paths refer to the item positions before the update, and inserted index paths to the positions after it,
+ matching @c UICollectionView batch update semantics.
+ */
+@interface TCNDayViewLayoutInvalidationContext : UICollectionViewLayoutInvalidationContext
+
+/**
+ The index paths of event items inserted by this update.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSIndexPath *> *insertedEventIndexPaths;
+
+/**
+ The index paths of event items deleted by this update.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSIndexPath *> *deletedEventIndexPaths;
+
+/**
+ Whether the invalidation only changes which sections are in range of the visible area, e.g. after horizontal scrolling.
+ Sections already laid out keep their attributes.
+ */
+@property (nonatomic, assign, readwrite) BOOL invalidateVisibleSections;
+
+/**
+ Whether the invalidation only changes @c TCNDayViewLayout.timeScale. Nothing is laid out again, as the cached attributes
+ are only scaled when they are returned.
+ */
+@property (nonatomic, assign, readwrite) BOOL invalidateTimeScale;
+
+/**
+ Whether the width of the layout's sections changed, e.g. when the collection view is rotated or resized in split view.
+ What is already laid out is only moved to the new width, without asking the delegate for anything again.
+ */
+@property (nonatomic, assign, readwrite) BOOL invalidateSectionWidth;
+
+/**
+ Whether the invalidation only changes the items shown where a dragged event moved to, which are listed in
+ @c invalidatedItemIndexPaths. Nothing else is laid out again.
+ */
+@property (nonatomic, assign, readwrite) BOOL invalidateDraggedEvent;
+
+/**
+ Marks the event items at @c indexPaths as inserted.
+
+ @param indexPaths The index paths of the new items, after the update.
+ */
+- (void)invalidateInsertedEventsAtIndexPaths:(nonnull NSArray<NSIndexPath *> *)indexPaths;
+
+/**
+ Marks the event items at @c indexPaths as deleted.
+
+ @param indexPaths The index paths of the removed items, before the update.
+ */
+- (void)invalidateDeletedEventsAtIndexPaths:(nonnull NSArray<NSIndexPath *> *)indexPaths;
+
+@end
@@ -0,0 +1,25 @@
+#import "TCNDayViewLayoutInvalidationContext.h"
+
+@implementation TCNDayViewLayoutInvalidationContext
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _insertedEventIndexPaths = @[];
+    _deletedEventIndexPaths = @[];
+
+    return self;
+}
+
+- (void)invalidateInsertedEventsAtIndexPaths:(nonnull NSArray<NSIndexPath *> *)indexPaths {
+    _insertedEventIndexPaths = [self.insertedEventIndexPaths arrayByAddingObjectsFromArray:indexPaths];
+}
+
+- (void)invalidateDeletedEventsAtIndexPaths:(nonnull NSArray<NSIndexPath *> *)indexPaths {
+    _deletedEventIndexPaths = [self.deletedEventIndexPaths arrayByAddingObjectsFromArray:indexPaths];
+}
+
+@end
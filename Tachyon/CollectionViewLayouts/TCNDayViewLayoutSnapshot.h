@@ -0,0 +1,78 @@
+#import <Foundation/Foundation.h>
+#import "TCNLayoutSnapshot.h"
+
+/**
+ The event layout of one @c TCNDayViewLayout section in a compact binary format, saved so that a day can be drawn on the
+ next launch before its events are read and laid out.
+
+ Frames are kept in units that don't depend on the section's width, with each event's identifier and z-order, and the
+ snapshot is keyed by the day, the version of its events and the layout's configuration. A snapshot only holds its
+ encoded bytes, so one read from a file is memory-mapped and paged in as its records are read.
+ */
+@interface TCNDayViewLayoutSnapshot : NSObject
+
+/**
+ The encoded snapshot, in the format of @c TCNLayoutSnapshotEncode.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSData *data;
+
+/**
+ The key of the layout the snapshot was taken of.
+ */
+@property (nonatomic, assign, readonly) TCNLayoutSnapshotKey key;
+
+/**
+ The number of events in the snapshot.
+ */
+@property (nonatomic, assign, readonly) NSInteger count;
+
+/**
+ The events' records in item order, which point into @c data.
+ */
+@property (nonatomic, assign, nonnull, readonly) const TCNLayoutSnapshotRecord *records;
+
+/**
+ A snapshot of @c count records with @c key.
+
+ @param key The key of the layout the records were taken of.
+ @param records The records, in item order. May be @c NULL if @c count is 0.
+ @param count The number of records.
+ @return A @c TCNDayViewLayoutSnapshot instance, or nil if it couldn't be encoded.
+ */
++ (nullable instancetype)snapshotWithKey:(TCNLayoutSnapshotKey)key
+                                 records:(nullable const TCNLayoutSnapshotRecord *)records
+                                   count:(NSInteger)count;
+
+/**
+ Reads a snapshot saved by @c writeToURL:error:, memory-mapping the file when possible.
+
+ @param url The file URL of the snapshot.
+ @return A @c TCNDayViewLayoutSnapshot instance, or nil if there is no file or it isn't a snapshot in the current format.
+ */
++ (nullable instancetype)snapshotWithContentsOfURL:(nonnull NSURL *)url;
+
+/**
+ A snapshot of encoded bytes.
+
+ @param data A snapshot encoded by @c TCNLayoutSnapshotEncode.
+ @return A @c TCNDayViewLayoutSnapshot instance, or nil if @c data isn't a snapshot in the current format.
+ */
+- (nullable instancetype)initWithData:(nonnull NSData *)data NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ Whether the snapshot was taken of the layout with @c key.
+ */
+- (BOOL)hasKey:(TCNLayoutSnapshotKey)key;
+
+/**
+ Saves the snapshot to a file atomically, so that a snapshot being read is never partially overwritten.
+
+ @param url The file URL to save the snapshot to.
+ @param error Set to the reason the file couldn't be written.
+ @return YES if the snapshot was saved.
+ */
+- (BOOL)writeToURL:(nonnull NSURL *)url error:(NSError *_Nullable *_Nullable)error;
+
+@end
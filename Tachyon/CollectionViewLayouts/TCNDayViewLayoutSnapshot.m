@@ -0,0 +1,65 @@
+#import "TCNDayViewLayoutSnapshot.h"
+#import "TCNMacros.h"
+
+@implementation TCNDayViewLayoutSnapshot
+
+#pragma mark - Initialization
+
++ (nullable instancetype)snapshotWithKey:(TCNLayoutSnapshotKey)key
+                                 records:(nullable const TCNLayoutSnapshotRecord *)records
+                                   count:(NSInteger)count {
+    if (count < 0) {
+        TCN_ASSERT_FAILURE(@"Invalid layout snapshot record count %ld", (long)count);
+        return nil;
+    }
+
+    // NSMutableData's bytes are allocated with malloc, so they are aligned for the records
+    const size_t length = TCNLayoutSnapshotEncodedLength((size_t)count);
+    NSMutableData *const data = [[NSMutableData alloc] initWithLength:length];
+    if (TCNLayoutSnapshotEncode(&key, records, (size_t)count, data.mutableBytes, length) != 0) {
+        TCN_ASSERT_FAILURE(@"Unable to encode layout snapshot of %ld records", (long)count);
+        return nil;
+    }
+    return [[self alloc] initWithData:data];
+}
+
++ (nullable instancetype)snapshotWithContentsOfURL:(nonnull NSURL *)url {
+    NSData *const data = [NSData dataWithContentsOfURL:url options:NSDataReadingMappedIfSafe error:NULL];
+    if (!data) {
+        return nil;
+    }
+    return [[self alloc] initWithData:TCN_FORCE_UNWRAP(data)];
+}
+
+- (nullable instancetype)initWithData:(nonnull NSData *)data {
+    TCNLayoutSnapshotKey key;
+    const TCNLayoutSnapshotRecord *records;
+    size_t count;
+    if (TCNLayoutSnapshotDecode(data.bytes, data.length, &key, &records, &count) != 0) {
+        return nil;
+    }
+
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _data = data;
+    _key = key;
+    _records = records;
+    _count = (NSInteger)count;
+
+    return self;
+}
+
+#pragma mark - Methods
+
+- (BOOL)hasKey:(TCNLayoutSnapshotKey)key {
+    return self.key.day == key.day && self.key.dataVersion == key.dataVersion && self.key.configHash == key.configHash;
+}
+
+- (BOOL)writeToURL:(nonnull NSURL *)url error:(NSError *_Nullable *_Nullable)error {
+    return [self.data writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+@end
@@ -0,0 +1,17 @@
+#import <UIKit/UIKit.h>
+#import "TCNOverlapEngine.h"
+
+/**
+ Layout attributes for a @c TCNEventCell, holding the event's placement among the events it overlaps. Together with the
+ vertical part of the frame, which only depends on the event's times, this describes the event independently of the
+ width of its section, so that its frame can be computed again for another width without asking for its times.
+ */
+@interface TCNEventCellLayoutAttributes : UICollectionViewLayoutAttributes
+
+/**
+ The event's column and the number of columns its overlap cluster is divided into. Events shown at the full width of
+ their section have a column count of 1.
+ */
+@property (nonatomic, assign, readwrite) TCNOverlapPlacement placement;
+
+@end
@@ -0,0 +1,32 @@
+#import "TCNEventCellLayoutAttributes.h"
+
+@implementation TCNEventCellLayoutAttributes
+
++ (instancetype)layoutAttributesForCellWithIndexPath:(NSIndexPath *)indexPath {
+    TCNEventCellLayoutAttributes *const attributes = [super layoutAttributesForCellWithIndexPath:indexPath];
+    attributes.placement = (TCNOverlapPlacement){0, 1, 0};
+    return attributes;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    TCNEventCellLayoutAttributes *const copy = [super copyWithZone:zone];
+    copy.placement = self.placement;
+    return copy;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (![object isKindOfClass:TCNEventCellLayoutAttributes.class] || ![super isEqual:object]) {
+        return NO;
+    }
+
+    TCNEventCellLayoutAttributes *const other = object;
+    return self.placement.column == other.placement.column
+        && self.placement.columnCount == other.placement.columnCount
+        && self.placement.stackOrder == other.placement.stackOrder;
+}
+
+- (NSUInteger)hash {
+    return [super hash] ^ self.placement.column ^ ((NSUInteger)self.placement.columnCount << 16);
+}
+
+@end
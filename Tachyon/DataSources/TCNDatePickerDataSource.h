@@ -1,6 +1,7 @@
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
 #import "TCNDatePickerConfig.h"
+#import "TCNDayDensityCache.h"
 
 /**
  The default data source for @c TCNDatePickerView.
@@ -11,18 +12,19 @@
 
 /**
  The days of the previous week. The previous week is the week chronologically prior
- to the currently visible week.
+ to the currently visible week. Not used when the config scrolls continuously.
  */
 @property (nonatomic, strong, nonnull, readonly) NSArray<NSDate *> *previousWeekDates;
 
 /**
- The days of the current week. The current week is the currently visible week.
+ The days of the current week. The current week is the currently visible week. Not used when the config scrolls
+ continuously.
  */
 @property (nonatomic, strong, nonnull, readonly) NSArray<NSDate *> *activeWeekDates;
 
 /**
  The days of the next week. The next week is the week chronologically after
- the currently visible week.
+ the currently visible week. Not used when the config scrolls continuously.
  */
 @property (nonatomic, strong, nonnull, readonly) NSArray<NSDate *> *nextWeekDates;
 
@@ -46,14 +48,42 @@
  */
 @property (nonatomic, assign, class, readonly) NSInteger datePickerSectionNextWeek;
 
+/**
+ The cache of how busy each day is, shown on each day's cell. No density is shown if this is @c nil.
+ */
+@property (nonatomic, strong, nullable, readwrite) TCNDayDensityCache *densityCache;
+
+/**
+ The section of the currently visible week. This is @c datePickerSectionActiveWeek, unless the config scrolls
+ continuously, where each week has its own section.
+ */
+@property (nonatomic, assign, readwrite) NSInteger activeWeekSection;
+
 /**
  Sets up the data source's previous week, active week and next week dates given a reference date.
  The reference date will be in the active week's dates.
 
+ When the config scrolls continuously, this instead centers the range of weeks on the week of the reference date, and
+ makes it the active week section.
+
  @param date The reference date.
  */
 - (void)setupWeekDatesWithCurrentlyVisibleDate:(nonnull NSDate *)date;
 
+/**
+ Prepares the shared calendar context for the days of the weeks around @c section, so that looking up their dates is
+ plain arithmetic. Only needed when the config scrolls continuously.
+
+ @param section The section of a week about to be displayed.
+ */
+- (void)prepareDaysNearWeekSection:(NSInteger)section;
+
+/**
+ Computes the densities of the days in the active week and the weeks around it in one batch, so that displaying their
+ cells doesn't query events. Called automatically when the week dates are set up.
+ */
+- (void)prepareEventDensities;
+
 /**
  Requests a date's @c indexPath relative to previous, active, or next weeks' dates.
 
@@ -1,4 +1,5 @@
 #import "TCNDatePickerDataSource.h"
+#import "TCNCalendarContext.h"
 #import "TCNDatePickerDayView.h"
 #import "TCNMacros.h"
 #import "TCNDateUtil.h"
@@ -12,6 +13,13 @@
 
 @property (nonatomic, strong, nonnull, readonly) TCNDatePickerConfig *config;
 
+/**
+ When the config scrolls continuously, the first day of the chronologically first week, counted like
+ @c TCNCalendarDayMinute.day, and the number of weeks. Each week is a section.
+ */
+@property (nonatomic, assign, readwrite) NSInteger firstDay;
+@property (nonatomic, assign, readwrite) NSInteger weekCount;
+
 @end
 
 @implementation TCNDatePickerDataSource
@@ -31,6 +39,9 @@ static const int DaysInAWeek = 7;
     _activeWeekDates = @[];
     _nextWeekDates = @[];
     _previousWeekDates = @[];
+    _activeWeekSection = TCNDatePickerDataSource.datePickerSectionActiveWeek;
+    _firstDay = 0;
+    _weekCount = 0;
     return self;
 }
 
@@ -51,6 +62,12 @@ static const int DaysInAWeek = 7;
 #pragma mark - Methods
 
 - (void)setupWeekDatesWithCurrentlyVisibleDate:(nonnull NSDate *)date {
+    if (self.config.scrollsContinuously) {
+        [self setupContinuousWeeksWithCurrentlyVisibleDate:date];
+        [self prepareEventDensities];
+        return;
+    }
+
     NSDate *const activeWeekDate = [TCNDateUtil dateByAddingWeeks:0 toDate:date];
     self.activeWeekDates = [TCNDateUtil daysOfWeekFromDate:activeWeekDate];
 
@@ -59,9 +76,15 @@ static const int DaysInAWeek = 7;
 
     NSDate *const previousWeekDate = [TCNDateUtil dateByAddingWeeks:-1 toDate:date];
     self.previousWeekDates = [TCNDateUtil daysOfWeekFromDate:previousWeekDate];
+
+    [self prepareEventDensities];
 }
 
 - (nullable NSIndexPath *)indexPathForDate:(nonnull NSDate *)date {
+    if (self.config.scrollsContinuously) {
+        return [self continuousIndexPathForDate:date];
+    }
+
     if (self.previousWeekDates.count != DaysInAWeek || self.activeWeekDates.count != DaysInAWeek || self.nextWeekDates.count != DaysInAWeek) {
         TCN_ASSERT_FAILURE(@"selectedDateIndexPath is called before dates are setup for past, active and next week");
         return nil;
@@ -91,6 +114,10 @@ static const int DaysInAWeek = 7;
 }
 
 - (nullable NSDate *)dateForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    if (self.config.scrollsContinuously) {
+        return [self continuousDateForItemAtIndexPath:indexPath];
+    }
+
     if (indexPath.section == TCNDatePickerDataSource.datePickerSectionPreviousWeek) {
         return [self.previousWeekDates objectAtIndex:(NSUInteger)indexPath.row];
     } else if (indexPath.section == TCNDatePickerDataSource.datePickerSectionActiveWeek) {
@@ -103,6 +130,94 @@ static const int DaysInAWeek = 7;
     }
 }
 
+- (void)prepareDaysNearWeekSection:(NSInteger)section {
+    if (!self.config.scrollsContinuously || self.weekCount == 0) {
+        return;
+    }
+
+    NSDate *startDate;
+    NSDate *endDate;
+    [self getStartDate:&startDate endDate:&endDate nearWeekSection:section];
+    [TCNCalendarContext.sharedContext prepareDaysFromDate:startDate toDate:endDate];
+}
+
+- (void)prepareEventDensities {
+    if (!self.densityCache) {
+        return;
+    }
+
+    if (self.config.scrollsContinuously) {
+        if (self.weekCount == 0) {
+            return;
+        }
+        NSDate *startDate;
+        NSDate *endDate;
+        [self getStartDate:&startDate endDate:&endDate nearWeekSection:self.activeWeekSection];
+        [self.densityCache prepareDensitiesFromDate:startDate toDate:endDate];
+        return;
+    }
+
+    NSDate *const startDate = self.previousWeekDates.firstObject;
+    NSDate *const endDate = self.nextWeekDates.lastObject;
+    if (startDate && endDate) {
+        [self.densityCache prepareDensitiesFromDate:TCN_FORCE_UNWRAP(startDate) toDate:TCN_FORCE_UNWRAP(endDate)];
+    }
+}
+
+#pragma mark - Continuous scrolling
+
+- (void)setupContinuousWeeksWithCurrentlyVisibleDate:(nonnull NSDate *)date {
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    const NSInteger day = [calendarContext dayMinuteForDate:date].day;
+    const NSInteger daysIntoWeek = ([calendarContext weekdayOfDay:day] - (NSInteger)calendarContext.firstWeekday + DaysInAWeek) % DaysInAWeek;
+    const NSInteger weekRange = MAX(self.config.continuousScrollingWeekRange, 0);
+
+    self.firstDay = day - daysIntoWeek - (weekRange * DaysInAWeek);
+    self.weekCount = (2 * weekRange) + 1;
+    self.activeWeekSection = [self sectionForWeekIndex:weekRange];
+    [self prepareDaysNearWeekSection:self.activeWeekSection];
+}
+
+/**
+ Weeks are in chronological order, reversed in right-to-left layouts like the paging sections.
+ */
+- (NSInteger)weekIndexForSection:(NSInteger)section {
+    return [TCNViewUtils isLayoutDirectionRTL] ? self.weekCount - 1 - section : section;
+}
+
+- (NSInteger)sectionForWeekIndex:(NSInteger)weekIndex {
+    return [TCNViewUtils isLayoutDirectionRTL] ? self.weekCount - 1 - weekIndex : weekIndex;
+}
+
+/**
+ The first day of the week before the week of @c section, and the last day of the week after it, within the range.
+ */
+- (void)getStartDate:(NSDate *_Nonnull *_Nonnull)startDate endDate:(NSDate *_Nonnull *_Nonnull)endDate nearWeekSection:(NSInteger)section {
+    const NSInteger weekIndex = [self weekIndexForSection:section];
+    const NSInteger firstWeekIndex = MIN(MAX(weekIndex - 1, 0), self.weekCount - 1);
+    const NSInteger lastWeekIndex = MAX(MIN(weekIndex + 1, self.weekCount - 1), 0);
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    *startDate = [calendarContext startOfDay:self.firstDay + (firstWeekIndex * DaysInAWeek)];
+    *endDate = [calendarContext startOfDay:self.firstDay + (lastWeekIndex * DaysInAWeek) + DaysInAWeek - 1];
+}
+
+- (nullable NSIndexPath *)continuousIndexPathForDate:(nonnull NSDate *)date {
+    const NSInteger dayOffset = [TCNCalendarContext.sharedContext dayMinuteForDate:date].day - self.firstDay;
+    if (dayOffset < 0 || dayOffset >= self.weekCount * DaysInAWeek) {
+        return nil;
+    }
+    return [NSIndexPath indexPathForRow:dayOffset % DaysInAWeek inSection:[self sectionForWeekIndex:dayOffset / DaysInAWeek]];
+}
+
+- (nullable NSDate *)continuousDateForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    if (indexPath.section < 0 || indexPath.section >= self.weekCount || indexPath.row < 0 || indexPath.row >= DaysInAWeek) {
+        TCN_ASSERT_FAILURE(@"%@ is not a valid index path for %ld weeks", indexPath, (long)self.weekCount);
+        return nil;
+    }
+    const NSInteger day = self.firstDay + ([self weekIndexForSection:indexPath.section] * DaysInAWeek) + indexPath.row;
+    return [TCNCalendarContext.sharedContext startOfDay:day];
+}
+
 #pragma mark - UICollectionViewDataSource
 
 - (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView cellForItemAtIndexPath:(NSIndexPath *)indexPath {
@@ -120,6 +235,7 @@ static const int DaysInAWeek = 7;
         return nil;
     }
     dayViewCell.date = date;
+    dayViewCell.eventDensity = self.densityCache ? [self.densityCache densityForDate:date] : (TCNDayDensity){0, 0};
     if ([TCNDateUtil isDate:dayViewCell.date inSameDayAsDate:self.selectedDate]) {
         [dayViewCell applyStylingFromConfig:self.config selected:YES];
         dayViewCell.selected = YES;
@@ -132,6 +248,10 @@ static const int DaysInAWeek = 7;
 }
 
 - (NSInteger)numberOfSectionsInCollectionView:(__unused UICollectionView *)collectionView {
+    if (self.config.scrollsContinuously) {
+        return self.weekCount;
+    }
+
     // Returns 3 for TCNDatePickerSectionPreviousWeek, TCNDatePickerSectionCurrentWeek, and TCNDatePickerSectionNextWeek
     return 3;
 }
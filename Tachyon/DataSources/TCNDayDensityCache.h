@@ -0,0 +1,76 @@
+#import <Foundation/Foundation.h>
+#import "TCNEvent.h"
+
+/**
+ How busy a single day is.
+ */
+typedef struct {
+    /**
+     The number of events on the day, including all-day events.
+     */
+    NSInteger eventCount;
+
+    /**
+     The number of minutes of the day covered by at least one event that isn't all-day.
+     */
+    NSInteger busyMinutes;
+} TCNDayDensity;
+
+/**
+ Returns the events overlapping the half-open range from @c startDate to @c endDate.
+ */
+typedef NSArray<TCNEvent *> *_Nonnull (^TCNDayDensityEventsProvider)(NSDate *_Nonnull startDate, NSDate *_Nonnull endDate);
+
+/**
+ Computes and caches a @c TCNDayDensity for each day, by week.
+
+ Preparing a range of dates fetches the events of every day in it that isn't cached with a single call to the events
+ provider, and aggregates them in one pass. Invalidating days only discards those days, so weeks whose events didn't
+ change are never fetched again. This should only be used on the main thread.
+ */
+@interface TCNDayDensityCache : NSObject
+
+/**
+ The number of days looked up by @c prepareDensitiesFromDate:toDate: and @c densityForDate:, and how many of them were
+ already cached, since the cache was created.
+ */
+@property (nonatomic, assign, readonly) NSInteger lookupCount;
+@property (nonatomic, assign, readonly) NSInteger hitCount;
+
+/**
+ A cache that fetches events with @c eventsProvider.
+
+ @param eventsProvider Called whenever days that aren't cached are prepared.
+ @return A @c TCNDayDensityCache instance.
+ */
+- (nonnull instancetype)initWithEventsProvider:(nonnull TCNDayDensityEventsProvider)eventsProvider NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ Computes the densities of the days from @c startDate to @c endDate that aren't cached.
+
+ @param startDate A time on the first day to prepare.
+ @param endDate A time on the last day to prepare.
+ */
+- (void)prepareDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate;
+
+/**
+ The density of the day of @c date, computed with the rest of its week if it isn't cached.
+ */
+- (TCNDayDensity)densityForDate:(nonnull NSDate *)date;
+
+/**
+ Discards the densities of the days from @c startDate to @c endDate, e.g. after events on them were added or removed.
+
+ @param startDate A time on the first day to invalidate.
+ @param endDate A time on the last day to invalidate.
+ */
+- (void)invalidateDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate;
+
+/**
+ Discards every density.
+ */
+- (void)invalidateAllDensities;
+
+@end
@@ -0,0 +1,206 @@
+#import "TCNDayDensityCache.h"
+#import "TCNCalendarContext.h"
+#import "TCNDensityEngine.h"
+#import "TCNMacros.h"
+
+static const NSInteger DaysInAWeek = 7;
+
+/**
+ The cached densities of one week. A day's density is only valid if its bit is set in @c validDays.
+ */
+@interface TCNDayDensityWeek : NSObject {
+@public
+    TCNDayDensity days[DaysInAWeek];
+    uint8_t validDays;
+}
+
+@end
+
+@implementation TCNDayDensityWeek
+
+@end
+
+@interface TCNDayDensityCache ()
+
+@property (nonatomic, copy, nonnull, readonly) TCNDayDensityEventsProvider eventsProvider;
+
+/**
+ The cached weeks, by the first day of the week, counted like @c TCNCalendarDayMinute.day.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSMutableDictionary<NSNumber *, TCNDayDensityWeek *> *weeks;
+
+@property (nonatomic, assign, readwrite) NSInteger lookupCount;
+@property (nonatomic, assign, readwrite) NSInteger hitCount;
+
+@end
+
+@implementation TCNDayDensityCache
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithEventsProvider:(nonnull TCNDayDensityEventsProvider)eventsProvider {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _eventsProvider = [eventsProvider copy];
+    _weeks = [[NSMutableDictionary alloc] init];
+
+    return self;
+}
+
+#pragma mark - Class helpers
+
+/**
+ The first day of the week of @c day, in the current calendar.
+ */
++ (NSInteger)weekStartForDay:(NSInteger)day {
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    const NSInteger daysIntoWeek = ([calendarContext weekdayOfDay:day] - (NSInteger)calendarContext.firstWeekday + DaysInAWeek) % DaysInAWeek;
+    return day - daysIntoWeek;
+}
+
++ (NSInteger)dayForDate:(nonnull NSDate *)date {
+    return [TCNCalendarContext.sharedContext dayMinuteForDate:date].day;
+}
+
+#pragma mark - Methods
+
+- (void)prepareDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate {
+    NSInteger firstDay = [TCNDayDensityCache dayForDate:startDate];
+    NSInteger lastDay = [TCNDayDensityCache dayForDate:endDate];
+    if (lastDay < firstDay) {
+        const NSInteger swap = firstDay;
+        firstDay = lastDay;
+        lastDay = swap;
+    }
+
+    self.lookupCount += lastDay - firstDay + 1;
+    for (NSInteger day = firstDay; day <= lastDay; day++) {
+        if ([self isDensityValidForDay:day]) {
+            self.hitCount++;
+        }
+    }
+
+    // Only the days that aren't cached are fetched, so a range that is mostly cached stays cheap
+    while (firstDay <= lastDay && [self isDensityValidForDay:firstDay]) {
+        firstDay++;
+    }
+    while (lastDay >= firstDay && [self isDensityValidForDay:lastDay]) {
+        lastDay--;
+    }
+    if (firstDay > lastDay) {
+        return;
+    }
+    [self computeDensitiesFromDay:firstDay toDay:lastDay];
+}
+
+- (TCNDayDensity)densityForDate:(nonnull NSDate *)date {
+    const NSInteger day = [TCNDayDensityCache dayForDate:date];
+    self.lookupCount++;
+    if ([self isDensityValidForDay:day]) {
+        self.hitCount++;
+    } else {
+        const NSInteger weekStart = [TCNDayDensityCache weekStartForDay:day];
+        [self computeDensitiesFromDay:weekStart toDay:weekStart + DaysInAWeek - 1];
+    }
+
+    TCNDayDensityWeek *const week = self.weeks[@([TCNDayDensityCache weekStartForDay:day])];
+    if (!week) {
+        TCN_ASSERT_FAILURE(@"No densities were computed for %@", date);
+        return (TCNDayDensity){0, 0};
+    }
+    return week->days[day - [TCNDayDensityCache weekStartForDay:day]];
+}
+
+- (void)invalidateDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate {
+    const NSInteger firstDay = [TCNDayDensityCache dayForDate:startDate];
+    const NSInteger lastDay = [TCNDayDensityCache dayForDate:endDate];
+    for (NSInteger day = MIN(firstDay, lastDay); day <= MAX(firstDay, lastDay); day++) {
+        const NSInteger weekStart = [TCNDayDensityCache weekStartForDay:day];
+        TCNDayDensityWeek *const week = self.weeks[@(weekStart)];
+        if (!week) {
+            // Skip to the next week, which may be cached
+            day = weekStart + DaysInAWeek - 1;
+            continue;
+        }
+        week->validDays &= (uint8_t)~(1u << (day - weekStart));
+    }
+}
+
+- (void)invalidateAllDensities {
+    [self.weeks removeAllObjects];
+}
+
+#pragma mark - Computation
+
+- (BOOL)isDensityValidForDay:(NSInteger)day {
+    const NSInteger weekStart = [TCNDayDensityCache weekStartForDay:day];
+    TCNDayDensityWeek *const week = self.weeks[@(weekStart)];
+    return week && (week->validDays & (1u << (day - weekStart))) != 0;
+}
+
+/**
+ Fetches the events of the days from @c firstDay to @c lastDay and computes their densities in one pass.
+ */
+- (void)computeDensitiesFromDay:(NSInteger)firstDay toDay:(NSInteger)lastDay {
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    const size_t dayCount = (size_t)(lastDay - firstDay + 1);
+    double *const dayBoundaries = malloc((dayCount + 1) * sizeof(double));
+    TCNDensityDay *const days = malloc(dayCount * sizeof(TCNDensityDay));
+    if (!dayBoundaries || !days) {
+        free(dayBoundaries);
+        free(days);
+        TCN_ASSERT_FAILURE(@"Unable to allocate densities for %zu days", dayCount);
+        return;
+    }
+
+    [calendarContext prepareDaysFromDate:[calendarContext startOfDay:firstDay] toDate:[calendarContext startOfDay:lastDay]];
+    for (size_t i = 0; i <= dayCount; i++) {
+        dayBoundaries[i] = [calendarContext startOfDay:firstDay + (NSInteger)i].timeIntervalSinceReferenceDate;
+    }
+
+    NSArray<TCNEvent *> *const events = self.eventsProvider([NSDate dateWithTimeIntervalSinceReferenceDate:dayBoundaries[0]],
+                                                            [NSDate dateWithTimeIntervalSinceReferenceDate:dayBoundaries[dayCount]]);
+    TCNDensityInterval *const intervals = malloc((events.count > 0 ? events.count : 1) * sizeof(TCNDensityInterval));
+    if (!intervals) {
+        free(dayBoundaries);
+        free(days);
+        TCN_ASSERT_FAILURE(@"Unable to allocate %lu event intervals", (unsigned long)events.count);
+        return;
+    }
+    for (NSUInteger i = 0; i < events.count; i++) {
+        TCNEvent *const event = events[i];
+        intervals[i] = (TCNDensityInterval){
+            event.startDateTime.timeIntervalSinceReferenceDate,
+            event.endDateTime.timeIntervalSinceReferenceDate,
+            !event.isAllDay
+        };
+    }
+
+    if (TCNDensityEngineComputeDays(intervals, events.count, dayBoundaries, dayCount, days) != 0) {
+        TCN_ASSERT_FAILURE(@"Unable to compute densities for %zu days", dayCount);
+    } else {
+        for (size_t i = 0; i < dayCount; i++) {
+            const NSInteger day = firstDay + (NSInteger)i;
+            const NSInteger weekStart = [TCNDayDensityCache weekStartForDay:day];
+            TCNDayDensityWeek *week = self.weeks[@(weekStart)];
+            if (!week) {
+                week = [[TCNDayDensityWeek alloc] init];
+                self.weeks[@(weekStart)] = week;
+            }
+            week->days[day - weekStart] = (TCNDayDensity){
+                (NSInteger)days[i].eventCount,
+                (NSInteger)round(days[i].busySeconds / 60)
+            };
+            week->validDays |= (uint8_t)(1u << (day - weekStart));
+        }
+    }
+
+    free(intervals);
+    free(dayBoundaries);
+    free(days);
+}
+
+@end
@@ -0,0 +1,50 @@
+#import <Foundation/Foundation.h>
+#import "TCNEvent.h"
+
+/**
+ The changes between two arrays of events, matched by @c TCNEvent.identifier.
+
+ Events that kept their content keep their cells: only those whose position relative to the other kept events changed
+ are moved, chosen so that as few as possible move. Events whose content changed are updated, and every other event is
+ deleted or inserted.
+ */
+@interface TCNEventDiff : NSObject
+
+/**
+ The indexes, in the old events, of the events that aren't in the new events.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSIndexSet *deletedIndexes;
+
+/**
+ The indexes, in the new events, of the events that weren't in the old events.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSIndexSet *insertedIndexes;
+
+/**
+ The old index of each moved event with unchanged content, mapped to its new index.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSDictionary<NSNumber *, NSNumber *> *movedIndexes;
+
+/**
+ The old index of each event whose content changed, mapped to its new index.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSDictionary<NSNumber *, NSNumber *> *updatedIndexes;
+
+/**
+ Whether any event was deleted, inserted, moved or updated.
+ */
+@property (nonatomic, assign, readonly) BOOL hasChanges;
+
+/**
+ Computes the changes from @c oldEvents to @c newEvents in O(n log n).
+
+ @param oldEvents The events before the change.
+ @param newEvents The events after the change.
+ @return A @c TCNEventDiff instance, or @c nil if either array has two events with the same identifier or memory for the
+ diff could not be allocated.
+ */
++ (nullable instancetype)diffFromEvents:(nonnull NSArray<TCNEvent *> *)oldEvents toEvents:(nonnull NSArray<TCNEvent *> *)newEvents;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
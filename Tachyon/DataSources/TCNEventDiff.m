@@ -0,0 +1,163 @@
+#import "TCNEventDiff.h"
+#import "TCNMacros.h"
+
+@implementation TCNEventDiff
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithDeletedIndexes:(nonnull NSIndexSet *)deletedIndexes
+                               insertedIndexes:(nonnull NSIndexSet *)insertedIndexes
+                                  movedIndexes:(nonnull NSDictionary<NSNumber *, NSNumber *> *)movedIndexes
+                                updatedIndexes:(nonnull NSDictionary<NSNumber *, NSNumber *> *)updatedIndexes {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _deletedIndexes = [deletedIndexes copy];
+    _insertedIndexes = [insertedIndexes copy];
+    _movedIndexes = [movedIndexes copy];
+    _updatedIndexes = [updatedIndexes copy];
+
+    return self;
+}
+
++ (nullable instancetype)diffFromEvents:(nonnull NSArray<TCNEvent *> *)oldEvents toEvents:(nonnull NSArray<TCNEvent *> *)newEvents {
+    NSMutableDictionary<NSString *, NSNumber *> *const oldIndexesByIdentifier = [[NSMutableDictionary alloc] initWithCapacity:oldEvents.count];
+    for (NSUInteger oldIndex = 0; oldIndex < oldEvents.count; oldIndex++) {
+        NSString *const identifier = oldEvents[oldIndex].identifier;
+        if (oldIndexesByIdentifier[identifier]) {
+            return nil;
+        }
+        oldIndexesByIdentifier[identifier] = @(oldIndex);
+    }
+
+    NSMutableSet<NSString *> *const newIdentifiers = [[NSMutableSet alloc] initWithCapacity:newEvents.count];
+    NSMutableIndexSet *const keptOldIndexes = [[NSMutableIndexSet alloc] init];
+    NSMutableIndexSet *const insertedIndexes = [[NSMutableIndexSet alloc] init];
+    NSMutableDictionary<NSNumber *, NSNumber *> *const updatedIndexes = [[NSMutableDictionary alloc] init];
+
+    // The events with unchanged content, in their new order, with their old and new indexes
+    NSUInteger *const unchangedOldIndexes = malloc(MAX(newEvents.count, 1u) * sizeof(NSUInteger));
+    NSUInteger *const unchangedNewIndexes = malloc(MAX(newEvents.count, 1u) * sizeof(NSUInteger));
+    if (!unchangedOldIndexes || !unchangedNewIndexes) {
+        free(unchangedOldIndexes);
+        free(unchangedNewIndexes);
+        TCN_ASSERT_FAILURE(@"Unable to allocate diff buffers for %lu events", (unsigned long)newEvents.count);
+        return nil;
+    }
+    NSUInteger unchangedCount = 0;
+
+    for (NSUInteger newIndex = 0; newIndex < newEvents.count; newIndex++) {
+        TCNEvent *const event = newEvents[newIndex];
+        if ([newIdentifiers containsObject:event.identifier]) {
+            free(unchangedOldIndexes);
+            free(unchangedNewIndexes);
+            return nil;
+        }
+        [newIdentifiers addObject:event.identifier];
+
+        NSNumber *const oldIndex = oldIndexesByIdentifier[event.identifier];
+        if (!oldIndex) {
+            [insertedIndexes addIndex:newIndex];
+            continue;
+        }
+        [keptOldIndexes addIndex:oldIndex.unsignedIntegerValue];
+        if (![oldEvents[oldIndex.unsignedIntegerValue] hasSameContentAsEvent:event]) {
+            updatedIndexes[oldIndex] = @(newIndex);
+            continue;
+        }
+        unchangedOldIndexes[unchangedCount] = oldIndex.unsignedIntegerValue;
+        unchangedNewIndexes[unchangedCount] = newIndex;
+        unchangedCount++;
+    }
+
+    NSMutableIndexSet *const deletedIndexes = [[NSMutableIndexSet alloc] initWithIndexesInRange:NSMakeRange(0, oldEvents.count)];
+    [deletedIndexes removeIndexes:keptOldIndexes];
+
+    // The longest run of unchanged events still in their old order stays in place, and every other one moves
+    NSIndexSet *const stationaryIndexes = [TCNEventDiff longestIncreasingSubsequenceOfIndexes:unchangedOldIndexes count:unchangedCount];
+    if (!stationaryIndexes) {
+        free(unchangedOldIndexes);
+        free(unchangedNewIndexes);
+        return nil;
+    }
+    NSMutableDictionary<NSNumber *, NSNumber *> *const movedIndexes = [[NSMutableDictionary alloc] init];
+    for (NSUInteger i = 0; i < unchangedCount; i++) {
+        if (![stationaryIndexes containsIndex:i]) {
+            movedIndexes[@(unchangedOldIndexes[i])] = @(unchangedNewIndexes[i]);
+        }
+    }
+    free(unchangedOldIndexes);
+    free(unchangedNewIndexes);
+
+    return [[TCNEventDiff alloc] initWithDeletedIndexes:deletedIndexes
+                                        insertedIndexes:insertedIndexes
+                                           movedIndexes:movedIndexes
+                                         updatedIndexes:updatedIndexes];
+}
+
+/**
+ The positions in @c indexes of a longest strictly increasing subsequence, found by patience sorting in O(n log n), or
+ @c nil if its buffers could not be allocated.
+ */
++ (nullable NSIndexSet *)longestIncreasingSubsequenceOfIndexes:(nonnull const NSUInteger *)indexes count:(NSUInteger)count {
+    if (count == 0) {
+        return [[NSIndexSet alloc] init];
+    }
+
+    // tails[i] is the position of the smallest last value of an increasing subsequence of length i + 1
+    NSUInteger *const tails = malloc(count * sizeof(NSUInteger));
+    NSUInteger *const predecessors = malloc(count * sizeof(NSUInteger));
+    if (!tails || !predecessors) {
+        free(tails);
+        free(predecessors);
+        TCN_ASSERT_FAILURE(@"Unable to allocate subsequence buffers for %lu indexes", (unsigned long)count);
+        return nil;
+    }
+    NSUInteger length = 0;
+    for (NSUInteger position = 0; position < count; position++) {
+        NSUInteger low = 0;
+        NSUInteger high = length;
+        while (low < high) {
+            const NSUInteger middle = low + (high - low) / 2;
+            if (indexes[tails[middle]] < indexes[position]) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        predecessors[position] = low > 0 ? tails[low - 1] : NSNotFound;
+        tails[low] = position;
+        if (low == length) {
+            length++;
+        }
+    }
+
+    NSMutableIndexSet *const subsequence = [[NSMutableIndexSet alloc] init];
+    for (NSUInteger position = tails[length - 1]; position != NSNotFound; position = predecessors[position]) {
+        [subsequence addIndex:position];
+    }
+    free(tails);
+    free(predecessors);
+    return subsequence;
+}
+
+#pragma mark - Properties
+
+- (BOOL)hasChanges {
+    return self.deletedIndexes.count > 0 || self.insertedIndexes.count > 0 || self.movedIndexes.count > 0 || self.updatedIndexes.count > 0;
+}
+
+#pragma mark - NSObject
+
+- (nonnull NSString *)description {
+    return [NSString stringWithFormat:@"<%@: deleted %@, inserted %@, moved %@, updated %@>",
+            NSStringFromClass(self.class),
+            self.deletedIndexes,
+            self.insertedIndexes,
+            self.movedIndexes,
+            self.updatedIndexes];
+}
+
+@end
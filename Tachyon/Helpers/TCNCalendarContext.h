@@ -0,0 +1,103 @@
+#import <Foundation/Foundation.h>
+
+/**
+ A position in local time: the day, counted from the day of the reference date, and the minute of that day as shown on a
+ clock.
+ */
+typedef struct {
+    NSInteger day;
+    NSInteger minuteOfDay;
+} TCNCalendarDayMinute;
+
+/**
+ Posted by a context after @c invalidate rebuilt it, on the thread that invalidated it. Days and minutes converted
+ before then may be stale.
+ */
+FOUNDATION_EXPORT NSNotificationName const _Nonnull TCNCalendarContextDidInvalidateNotification;
+
+/**
+ Holds the calendar, time zone and first weekday of the current locale, so that they aren't copied from
+ @c +[NSCalendar currentCalendar] by every date calculation.
+
+ Once a range of dates is prepared with @c prepareDaysFromDate:toDate:, the time zone's offset changes and the start of
+ each day in it are kept in tables, and converting an instant in that range to a day and minute is plain arithmetic.
+ Dates outside the prepared range are converted with @c calendar.
+
+ Everything is rebuilt when the current locale or the system time zone changes. Safe to use on any thread.
+ */
+@interface TCNCalendarContext : NSObject
+
+/**
+ The context shared by every Tachyon view.
+ */
+@property (nonatomic, strong, nonnull, class, readonly) TCNCalendarContext *sharedContext;
+
+/**
+ The current calendar, in the local time zone and current locale. It is shared, so it must not be modified.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSCalendar *calendar;
+
+/**
+ The time zone of @c calendar.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSTimeZone *timeZone;
+
+/**
+ The first weekday of @c calendar, where 1 is Sunday.
+ */
+@property (nonatomic, assign, readonly) NSUInteger firstWeekday;
+
+/**
+ Builds the day-boundary and time zone offset tables for the days from @c startDate to @c endDate, and keeps the days
+ already prepared. Call this when the range of displayed dates changes, e.g. on reload.
+
+ @param startDate A time on the first day to prepare.
+ @param endDate A time on the last day to prepare.
+ */
+- (void)prepareDaysFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate;
+
+/**
+ The day and the minute of the day of @c date in the local time zone. The minute of the day matches the hour and
+ minute components of @c calendar.
+ */
+- (TCNCalendarDayMinute)dayMinuteForDate:(nonnull NSDate *)date;
+
+/**
+ The minute of the day of @c date in the local time zone, from 0 to 1439.
+ */
+- (NSInteger)minuteOfDayForDate:(nonnull NSDate *)date;
+
+/**
+ The first moment of the day of @c date, like @c -[NSCalendar startOfDayForDate:].
+ */
+- (nonnull NSDate *)startOfDayForDate:(nonnull NSDate *)date;
+
+/**
+ The first moment of @c day, counted like @c TCNCalendarDayMinute.day.
+ */
+- (nonnull NSDate *)startOfDay:(NSInteger)day;
+
+/**
+ The time shown on the clock at @c minuteOfDay on the day of @c date, where minute 1440 is the start of the next day.
+ Minutes are clock minutes rather than elapsed ones, so they match @c minuteOfDayForDate: on days with a daylight saving
+ change, and a clock time skipped by the change resolves to the same minutes of the following hour.
+
+ @param minuteOfDay The minute of the day, from 0 to 1440.
+ @param date A time on the day.
+ @return The date, or @c nil if @c calendar can't find one.
+ */
+- (nullable NSDate *)dateAtMinuteOfDay:(NSInteger)minuteOfDay ofDate:(nonnull NSDate *)date;
+
+/**
+ The weekday of @c day, counted like @c TCNCalendarDayMinute.day, where 1 is Sunday.
+ */
+- (NSInteger)weekdayOfDay:(NSInteger)day;
+
+/**
+ Rebuilds the calendar and discards every table, e.g. after the locale or time zone changed, then posts
+ @c TCNCalendarContextDidInvalidateNotification. Called automatically on @c NSCurrentLocaleDidChangeNotification and
+ @c NSSystemTimeZoneDidChangeNotification.
+ */
+- (void)invalidate;
+
+@end
@@ -0,0 +1,316 @@
+#import "TCNCalendarContext.h"
+#import "TCNMacros.h"
+#import <os/lock.h>
+
+/**
+ An immutable snapshot of the calendar and the tables built for it. Replaced as a whole, so readers never see a
+ partially built table.
+ */
+@interface TCNCalendarTables : NSObject {
+@public
+    /**
+     The instants at which the time zone's offset from GMT changes within the prepared range, ascending, and the offset
+     that applies from each of them. @c offsets[0] applies from @c rangeStart.
+     */
+    double *transitions;
+    NSInteger *offsets;
+    size_t transitionCount;
+
+    /**
+     The start of each prepared day, in seconds since the reference date. @c dayStarts[0] is the start of @c firstDay.
+     */
+    double *dayStarts;
+    size_t dayCount;
+    NSInteger firstDay;
+
+    /**
+     The prepared range, from the start of @c firstDay to the start of the day after the last one.
+     */
+    double rangeStart;
+    double rangeEnd;
+}
+
+@property (nonatomic, strong, nonnull, readonly) NSCalendar *calendar;
+
+@end
+
+@implementation TCNCalendarTables
+
+- (nonnull instancetype)initWithCalendar:(nonnull NSCalendar *)calendar {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+    _calendar = calendar;
+    return self;
+}
+
+- (void)dealloc {
+    free(transitions);
+    free(offsets);
+    free(dayStarts);
+}
+
+@end
+
+NSNotificationName const TCNCalendarContextDidInvalidateNotification = @"TCNCalendarContextDidInvalidateNotification";
+
+@interface TCNCalendarContext ()
+
+@property (nonatomic, strong, nonnull, readwrite) TCNCalendarTables *tables;
+
+@end
+
+@implementation TCNCalendarContext {
+    os_unfair_lock _lock;
+}
+
+static const NSTimeInterval SecondsPerDay = 86400;
+static const NSInteger MinutesPerDay = 24 * 60;
+
+/**
+ The most days kept in the tables. Preparing days further away than this replaces the tables instead of extending them.
+ */
+static const NSInteger MaximumPreparedDays = 366;
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _lock = OS_UNFAIR_LOCK_INIT;
+    _tables = [[TCNCalendarTables alloc] initWithCalendar:[TCNCalendarContext currentCalendar]];
+
+    NSNotificationCenter *const notificationCenter = [NSNotificationCenter defaultCenter];
+    [notificationCenter addObserver:self selector:@selector(invalidate) name:NSCurrentLocaleDidChangeNotification object:nil];
+    [notificationCenter addObserver:self selector:@selector(invalidate) name:NSSystemTimeZoneDidChangeNotification object:nil];
+
+    return self;
+}
+
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
++ (nonnull TCNCalendarContext *)sharedContext {
+    static TCNCalendarContext *sharedContext;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedContext = [[TCNCalendarContext alloc] init];
+    });
+    return sharedContext;
+}
+
+#pragma mark - Class helpers
+
++ (nonnull NSCalendar *)currentCalendar {
+    NSCalendar *const calendar = [[NSCalendar currentCalendar] copy];
+    calendar.timeZone = [NSTimeZone localTimeZone];
+    calendar.locale = [NSLocale currentLocale];
+    return calendar;
+}
+
+/**
+ The start of @c day in the calendar's time zone, found from the day's local noon.
+ */
++ (nonnull NSDate *)startOfDay:(NSInteger)day calendar:(nonnull NSCalendar *)calendar {
+    // Noon is never skipped or repeated by a time zone transition
+    NSDate *const noon = [NSDate dateWithTimeIntervalSinceReferenceDate:((double)day * SecondsPerDay) + (SecondsPerDay / 2)];
+    NSDate *const localNoon = [noon dateByAddingTimeInterval:-(NSTimeInterval)[calendar.timeZone secondsFromGMTForDate:noon]];
+    return [calendar startOfDayForDate:localNoon];
+}
+
+/**
+ Builds tables for the days from @c firstDay to @c lastDay, inclusive.
+ */
++ (nonnull TCNCalendarTables *)tablesWithCalendar:(nonnull NSCalendar *)calendar firstDay:(NSInteger)firstDay lastDay:(NSInteger)lastDay {
+    TCNCalendarTables *const tables = [[TCNCalendarTables alloc] initWithCalendar:calendar];
+    const size_t dayCount = (size_t)(lastDay - firstDay + 1);
+    tables->dayStarts = malloc(dayCount * sizeof(double));
+    if (!tables->dayStarts) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate day starts for %lu days", (unsigned long)dayCount);
+        return tables;
+    }
+
+    for (size_t i = 0; i < dayCount; i++) {
+        tables->dayStarts[i] = [TCNCalendarContext startOfDay:firstDay + (NSInteger)i calendar:calendar].timeIntervalSinceReferenceDate;
+    }
+    tables->dayCount = dayCount;
+    tables->firstDay = firstDay;
+    tables->rangeStart = tables->dayStarts[0];
+    // The last day isn't 24 hours long when the clocks change on it
+    tables->rangeEnd = [TCNCalendarContext startOfDay:lastDay + 1 calendar:calendar].timeIntervalSinceReferenceDate;
+
+    NSTimeZone *const timeZone = calendar.timeZone;
+
+    NSMutableData *const transitions = [[NSMutableData alloc] init];
+    NSMutableData *const offsets = [[NSMutableData alloc] init];
+    NSDate *transition = [NSDate dateWithTimeIntervalSinceReferenceDate:tables->rangeStart];
+    while (transition && transition.timeIntervalSinceReferenceDate < tables->rangeEnd) {
+        const double instant = transition.timeIntervalSinceReferenceDate;
+        const NSInteger offset = [timeZone secondsFromGMTForDate:TCN_FORCE_UNWRAP(transition)];
+        [transitions appendBytes:&instant length:sizeof(double)];
+        [offsets appendBytes:&offset length:sizeof(NSInteger)];
+        transition = [timeZone nextDaylightSavingTimeTransitionAfterDate:TCN_FORCE_UNWRAP(transition)];
+    }
+
+    const size_t transitionCount = transitions.length / sizeof(double);
+    tables->transitions = malloc(transitionCount * sizeof(double));
+    tables->offsets = malloc(transitionCount * sizeof(NSInteger));
+    if (!tables->transitions || !tables->offsets) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate %lu time zone transitions", (unsigned long)transitionCount);
+        // Offsets are then found with the time zone, without either table
+        free(tables->transitions);
+        free(tables->offsets);
+        tables->transitions = NULL;
+        tables->offsets = NULL;
+        return tables;
+    }
+    memcpy(tables->transitions, transitions.bytes, transitions.length);
+    memcpy(tables->offsets, offsets.bytes, offsets.length);
+    tables->transitionCount = transitionCount;
+    return tables;
+}
+
+#pragma mark - Methods
+
+- (nonnull NSCalendar *)calendar {
+    return [self currentTables].calendar;
+}
+
+- (nonnull NSTimeZone *)timeZone {
+    return self.calendar.timeZone;
+}
+
+- (NSUInteger)firstWeekday {
+    return self.calendar.firstWeekday;
+}
+
+- (void)prepareDaysFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate {
+    TCNCalendarTables *const tables = [self currentTables];
+    NSInteger firstDay = [self dayMinuteForDate:startDate tables:tables].day;
+    NSInteger lastDay = [self dayMinuteForDate:endDate tables:tables].day;
+    if (lastDay < firstDay) {
+        const NSInteger swap = firstDay;
+        firstDay = lastDay;
+        lastDay = swap;
+    }
+    if (tables->dayCount > 0) {
+        const NSInteger preparedLastDay = tables->firstDay + (NSInteger)tables->dayCount - 1;
+        if (firstDay >= tables->firstDay && lastDay <= preparedLastDay) {
+            return;
+        }
+        // Keep the days already prepared, unless the tables would grow without bound while scrolling
+        if (MAX(lastDay, preparedLastDay) - MIN(firstDay, tables->firstDay) < MaximumPreparedDays) {
+            firstDay = MIN(firstDay, tables->firstDay);
+            lastDay = MAX(lastDay, preparedLastDay);
+        }
+    }
+
+    TCNCalendarTables *const newTables = [TCNCalendarContext tablesWithCalendar:tables.calendar firstDay:firstDay lastDay:lastDay];
+    os_unfair_lock_lock(&_lock);
+    // Don't replace tables that were invalidated while these were built
+    if (self.tables == tables) {
+        self.tables = newTables;
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
+- (TCNCalendarDayMinute)dayMinuteForDate:(nonnull NSDate *)date {
+    return [self dayMinuteForDate:date tables:[self currentTables]];
+}
+
+- (NSInteger)minuteOfDayForDate:(nonnull NSDate *)date {
+    return [self dayMinuteForDate:date].minuteOfDay;
+}
+
+- (nonnull NSDate *)startOfDayForDate:(nonnull NSDate *)date {
+    TCNCalendarTables *const tables = [self currentTables];
+    const NSInteger day = [self dayMinuteForDate:date tables:tables].day;
+    if (day >= tables->firstDay && day < tables->firstDay + (NSInteger)tables->dayCount) {
+        return [NSDate dateWithTimeIntervalSinceReferenceDate:tables->dayStarts[day - tables->firstDay]];
+    }
+    return [tables.calendar startOfDayForDate:date];
+}
+
+- (nonnull NSDate *)startOfDay:(NSInteger)day {
+    TCNCalendarTables *const tables = [self currentTables];
+    if (day >= tables->firstDay && day < tables->firstDay + (NSInteger)tables->dayCount) {
+        return [NSDate dateWithTimeIntervalSinceReferenceDate:tables->dayStarts[day - tables->firstDay]];
+    }
+
+    return [TCNCalendarContext startOfDay:day calendar:tables.calendar];
+}
+
+- (nullable NSDate *)dateAtMinuteOfDay:(NSInteger)minuteOfDay ofDate:(nonnull NSDate *)date {
+    if (minuteOfDay >= MinutesPerDay) {
+        return [self startOfDay:[self dayMinuteForDate:date].day + 1];
+    }
+    return [self.calendar dateBySettingHour:minuteOfDay / 60
+                                     minute:minuteOfDay % 60
+                                     second:0
+                                     ofDate:date
+                                    options:NSCalendarMatchNextTimePreservingSmallerUnits];
+}
+
+- (NSInteger)weekdayOfDay:(NSInteger)day {
+    // Day 0, the day of the reference date, is a Monday
+    const NSInteger daysSinceSunday = (((day + 1) % 7) + 7) % 7;
+    return daysSinceSunday + 1;
+}
+
+- (void)invalidate {
+    [NSTimeZone resetSystemTimeZone];
+    TCNCalendarTables *const tables = [[TCNCalendarTables alloc] initWithCalendar:[TCNCalendarContext currentCalendar]];
+    os_unfair_lock_lock(&_lock);
+    self.tables = tables;
+    os_unfair_lock_unlock(&_lock);
+
+    [[NSNotificationCenter defaultCenter] postNotificationName:TCNCalendarContextDidInvalidateNotification object:self];
+}
+
+#pragma mark - Conversion
+
+- (nonnull TCNCalendarTables *)currentTables {
+    os_unfair_lock_lock(&_lock);
+    TCNCalendarTables *const tables = self.tables;
+    os_unfair_lock_unlock(&_lock);
+    return tables;
+}
+
+- (TCNCalendarDayMinute)dayMinuteForDate:(nonnull NSDate *)date tables:(nonnull TCNCalendarTables *)tables {
+    const double instant = date.timeIntervalSinceReferenceDate;
+    const double localTime = instant + (double)[TCNCalendarContext offsetForInstant:instant date:date tables:tables];
+    const double day = floor(localTime / SecondsPerDay);
+    return (TCNCalendarDayMinute){
+        (NSInteger)day,
+        (NSInteger)floor((localTime - (day * SecondsPerDay)) / 60),
+    };
+}
+
+/**
+ The time zone's offset from GMT at @c instant, found in the transition table when it is in the prepared range.
+ */
++ (NSInteger)offsetForInstant:(double)instant date:(nonnull NSDate *)date tables:(nonnull TCNCalendarTables *)tables {
+    if (tables->transitionCount == 0 || instant < tables->rangeStart || instant >= tables->rangeEnd) {
+        return [tables.calendar.timeZone secondsFromGMTForDate:date];
+    }
+
+    // The last transition at or before the instant
+    size_t lo = 0;
+    size_t hi = tables->transitionCount;
+    while (hi - lo > 1) {
+        const size_t mid = lo + ((hi - lo) / 2);
+        if (tables->transitions[mid] <= instant) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return tables->offsets[lo];
+}
+
+@end
@@ -27,6 +27,8 @@
 
 /**
  Ex: 1:00 PM
+
+ Each thread has its own instance, so that times can be formatted off the main thread.
  */
 @property (nonatomic, strong, nonnull, class, readonly) NSDateFormatter *timeFormatter;
 
@@ -1,7 +1,10 @@
 #import "TCNDateFormatter.h"
+#import "TCNMacros.h"
 
 @implementation TCNDateFormatter
 
+static NSString *const TimeFormatterKey = @"com.linkedin.tachyon.time-formatter";
+
 + (nonnull NSDateFormatter *)dayOfWeekFormatter {
     static NSDateFormatter *dayOfWeekFormatter;
     static dispatch_once_t onceToken;
@@ -47,13 +50,16 @@
 }
 
 + (nonnull NSDateFormatter *)timeFormatter {
-    static NSDateFormatter *timeFormatter;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        timeFormatter = [[NSDateFormatter alloc] init];
-        [timeFormatter setLocale:[NSLocale currentLocale]];
-        timeFormatter.timeStyle = NSDateFormatterShortStyle;
-    });
+    NSMutableDictionary *const threadDictionary = NSThread.currentThread.threadDictionary;
+    NSDateFormatter *const cachedTimeFormatter = TCN_CAST_OR_NIL(threadDictionary[TimeFormatterKey], NSDateFormatter);
+    if (cachedTimeFormatter) {
+        return TCN_FORCE_UNWRAP(cachedTimeFormatter);
+    }
+
+    NSDateFormatter *const timeFormatter = [[NSDateFormatter alloc] init];
+    [timeFormatter setLocale:[NSLocale currentLocale]];
+    timeFormatter.timeStyle = NSDateFormatterShortStyle;
+    threadDictionary[TimeFormatterKey] = timeFormatter;
     return timeFormatter;
 }
 
@@ -0,0 +1,27 @@
+#import <Foundation/Foundation.h>
+
+/**
+ Holds the style bundle resolved from each config for each selection state, so that every view shown with the same config
+ shares one bundle instead of resolving its own. Configs are held weakly.
+
+ Safe to use on any thread.
+ */
+@interface TCNStyleCache<StyleType> : NSObject
+
+/**
+ @param config The config the style was resolved from.
+ @param selected Whether the style is for selected views.
+ @return The style last set for @c config and @c selected, or nil if there is none.
+ */
+- (nullable StyleType)styleForConfig:(nonnull id)config selected:(BOOL)selected;
+
+/**
+ Replaces the style resolved from @c config for @c selected.
+
+ @param style The resolved style.
+ @param config The config the style was resolved from.
+ @param selected Whether the style is for selected views.
+ */
+- (void)setStyle:(nonnull StyleType)style forConfig:(nonnull id)config selected:(BOOL)selected;
+
+@end
@@ -0,0 +1,45 @@
+#import "TCNStyleCache.h"
+#import <os/lock.h>
+
+@interface TCNStyleCache ()
+
+@property (nonatomic, strong, nonnull, readonly) NSMapTable<id, id> *unselectedStyles;
+@property (nonatomic, strong, nonnull, readonly) NSMapTable<id, id> *selectedStyles;
+
+@end
+
+@implementation TCNStyleCache {
+    os_unfair_lock _lock;
+}
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _unselectedStyles = [NSMapTable weakToStrongObjectsMapTable];
+    _selectedStyles = [NSMapTable weakToStrongObjectsMapTable];
+    _lock = OS_UNFAIR_LOCK_INIT;
+
+    return self;
+}
+
+#pragma mark - Methods
+
+- (nullable id)styleForConfig:(nonnull id)config selected:(BOOL)selected {
+    os_unfair_lock_lock(&_lock);
+    id const style = [(selected ? self.selectedStyles : self.unselectedStyles) objectForKey:config];
+    os_unfair_lock_unlock(&_lock);
+    return style;
+}
+
+- (void)setStyle:(nonnull id)style forConfig:(nonnull id)config selected:(BOOL)selected {
+    os_unfair_lock_lock(&_lock);
+    [(selected ? self.selectedStyles : self.unselectedStyles) setObject:style forKey:config];
+    os_unfair_lock_unlock(&_lock);
+}
+
+@end
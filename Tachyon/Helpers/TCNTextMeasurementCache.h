@@ -0,0 +1,51 @@
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+/**
+ Caches the size of single-font text laid out at a given width, so that labels showing the same text, e.g. the titles of
+ recurring events, are only measured once.
+
+ Text is measured with Core Text, which is safe to use on any thread, rather than UIKit's string drawing additions.
+ */
+@interface TCNTextMeasurementCache : NSObject
+
+/**
+ The cache shared by every day view.
+ */
+@property (nonatomic, strong, nonnull, class, readonly) TCNTextMeasurementCache *sharedCache;
+
+/**
+ The size @c text takes up when wrapped at @c width, like @c -[UILabel sizeThatFits:]. Measures the text if it isn't
+ cached yet. Safe to call on any thread.
+
+ @param text The text to measure.
+ @param font The font of the text.
+ @param width The maximum width of the text.
+ @param numberOfLines The maximum number of lines, or 0 for no limit.
+ @return The size of the text, no wider than @c width.
+ */
+- (CGSize)sizeForText:(nonnull NSString *)text
+                 font:(nonnull UIFont *)font
+                width:(CGFloat)width
+        numberOfLines:(NSInteger)numberOfLines;
+
+/**
+ Measures every text in @c texts on a background queue, so that later calls to @c sizeForText:font:width:numberOfLines:
+ with the same arguments don't measure on the calling thread.
+
+ @param texts The texts to measure.
+ @param font The font of the texts.
+ @param width The maximum width of the texts.
+ @param numberOfLines The maximum number of lines, or 0 for no limit.
+ */
+- (void)prepareSizesForTexts:(nonnull NSArray<NSString *> *)texts
+                        font:(nonnull UIFont *)font
+                       width:(CGFloat)width
+               numberOfLines:(NSInteger)numberOfLines;
+
+/**
+ Removes every cached size.
+ */
+- (void)removeAllSizes;
+
+@end
@@ -0,0 +1,105 @@
+#import <CoreText/CoreText.h>
+
+#import "TCNTextMeasurementCache.h"
+#import "TCNNumberHelper.h"
+
+@interface TCNTextMeasurementCache ()
+
+@property (nonatomic, strong, nonnull, readonly) NSCache<NSString *, NSValue *> *sizes;
+@property (nonatomic, strong, nonnull, readonly) dispatch_queue_t measurementQueue;
+
+@end
+
+@implementation TCNTextMeasurementCache
+
+static const NSUInteger SizeCountLimit = 2000;
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _sizes = [[NSCache alloc] init];
+    _sizes.countLimit = SizeCountLimit;
+    _measurementQueue = dispatch_queue_create("com.linkedin.tachyon.text-measurement", DISPATCH_QUEUE_SERIAL);
+
+    return self;
+}
+
++ (nonnull TCNTextMeasurementCache *)sharedCache {
+    static TCNTextMeasurementCache *sharedCache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[TCNTextMeasurementCache alloc] init];
+    });
+    return sharedCache;
+}
+
+#pragma mark - Methods
+
+- (CGSize)sizeForText:(nonnull NSString *)text
+                 font:(nonnull UIFont *)font
+                width:(CGFloat)width
+        numberOfLines:(NSInteger)numberOfLines {
+    NSString *const key = [TCNTextMeasurementCache keyForText:text font:font width:width numberOfLines:numberOfLines];
+    NSValue *const cachedSize = [self.sizes objectForKey:key];
+    if (cachedSize) {
+        return cachedSize.CGSizeValue;
+    }
+
+    const CGSize size = [TCNTextMeasurementCache measureText:text font:font width:width numberOfLines:numberOfLines];
+    [self.sizes setObject:[NSValue valueWithCGSize:size] forKey:key];
+    return size;
+}
+
+- (void)prepareSizesForTexts:(nonnull NSArray<NSString *> *)texts
+                        font:(nonnull UIFont *)font
+                       width:(CGFloat)width
+               numberOfLines:(NSInteger)numberOfLines {
+    if (texts.count == 0 || width <= 0) {
+        return;
+    }
+
+    NSArray<NSString *> *const textsToMeasure = [texts copy];
+    dispatch_async(self.measurementQueue, ^{
+        for (NSString *text in textsToMeasure) {
+            [self sizeForText:text font:font width:width numberOfLines:numberOfLines];
+        }
+    });
+}
+
+- (void)removeAllSizes {
+    [self.sizes removeAllObjects];
+}
+
+#pragma mark - Class helpers
+
++ (nonnull NSString *)keyForText:(nonnull NSString *)text font:(nonnull UIFont *)font width:(CGFloat)width numberOfLines:(NSInteger)numberOfLines {
+    return [NSString stringWithFormat:@"%@-%g-%g-%ld-%@", font.fontName, (double)font.pointSize, (double)width, (long)numberOfLines, text];
+}
+
++ (CGSize)measureText:(nonnull NSString *)text font:(nonnull UIFont *)font width:(CGFloat)width numberOfLines:(NSInteger)numberOfLines {
+    const CTFontRef ctFont = CTFontCreateWithName((__bridge CFStringRef)font.fontName, font.pointSize, NULL);
+    NSAttributedString *const attributedText = [[NSAttributedString alloc] initWithString:text
+                                                                               attributes:@{(__bridge NSString *)kCTFontAttributeName: (__bridge id)ctFont}];
+    const CTFramesetterRef framesetter = CTFramesetterCreateWithAttributedString((__bridge CFAttributedStringRef)attributedText);
+    const CGSize suggestedSize = CTFramesetterSuggestFrameSizeWithConstraints(framesetter,
+                                                                              CFRangeMake(0, 0),
+                                                                              NULL,
+                                                                              CGSizeMake(numberOfLines == 1 ? CGFLOAT_MAX : width, CGFLOAT_MAX),
+                                                                              NULL);
+    const CGFloat lineHeight = CTFontGetAscent(ctFont) + CTFontGetDescent(ctFont) + CTFontGetLeading(ctFont);
+    CFRelease(framesetter);
+    CFRelease(ctFont);
+
+    CGFloat height = [TCNNumberHelper ceil:suggestedSize.height];
+    if (numberOfLines > 0) {
+        height = MIN(height, [TCNNumberHelper ceil:lineHeight * numberOfLines]);
+    }
+    return CGSizeMake(MIN(width, [TCNNumberHelper ceil:suggestedSize.width]), height);
+}
+
+@end
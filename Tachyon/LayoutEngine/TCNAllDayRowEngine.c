@@ -0,0 +1,216 @@
+#include "TCNAllDayRowEngine.h"
+
+#include <stdlib.h>
+
+typedef struct {
+    int64_t firstDay;
+    int64_t lastDay;
+    size_t index;
+} TCNAllDayRowSweepItem;
+
+typedef struct {
+    int64_t lastDay;
+    uint32_t row;
+} TCNAllDayRowActiveRow;
+
+#pragma mark - Sorting
+
+static int TCNAllDayRowSweepItemCompare(const void *lhs, const void *rhs) {
+    const TCNAllDayRowSweepItem *const a = lhs;
+    const TCNAllDayRowSweepItem *const b = rhs;
+    if (a->firstDay != b->firstDay) {
+        return a->firstDay < b->firstDay ? -1 : 1;
+    }
+    // Longer events take the upper rows, so the shorter events starting with them don't split them from the top
+    if (a->lastDay != b->lastDay) {
+        return a->lastDay > b->lastDay ? -1 : 1;
+    }
+    if (a->index != b->index) {
+        return a->index < b->index ? -1 : 1;
+    }
+    return 0;
+}
+
+#pragma mark - Heaps
+
+static void TCNAllDayRowActivePush(TCNAllDayRowActiveRow *heap, size_t *count, TCNAllDayRowActiveRow value) {
+    size_t child = (*count)++;
+    while (child > 0) {
+        const size_t parent = (child - 1) / 2;
+        if (heap[parent].lastDay <= value.lastDay) {
+            break;
+        }
+        heap[child] = heap[parent];
+        child = parent;
+    }
+    heap[child] = value;
+}
+
+static TCNAllDayRowActiveRow TCNAllDayRowActivePop(TCNAllDayRowActiveRow *heap, size_t *count) {
+    const TCNAllDayRowActiveRow top = heap[0];
+    const TCNAllDayRowActiveRow last = heap[--(*count)];
+    size_t parent = 0;
+    while (1) {
+        size_t child = (2 * parent) + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && heap[child + 1].lastDay < heap[child].lastDay) {
+            child++;
+        }
+        if (last.lastDay <= heap[child].lastDay) {
+            break;
+        }
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    if (*count > 0) {
+        heap[parent] = last;
+    }
+    return top;
+}
+
+static void TCNAllDayRowFreePush(uint32_t *heap, size_t *count, uint32_t value) {
+    size_t child = (*count)++;
+    while (child > 0) {
+        const size_t parent = (child - 1) / 2;
+        if (heap[parent] <= value) {
+            break;
+        }
+        heap[child] = heap[parent];
+        child = parent;
+    }
+    heap[child] = value;
+}
+
+static uint32_t TCNAllDayRowFreePop(uint32_t *heap, size_t *count) {
+    const uint32_t top = heap[0];
+    const uint32_t last = heap[--(*count)];
+    size_t parent = 0;
+    while (1) {
+        size_t child = (2 * parent) + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && heap[child + 1] < heap[child]) {
+            child++;
+        }
+        if (last <= heap[child]) {
+            break;
+        }
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    if (*count > 0) {
+        heap[parent] = last;
+    }
+    return top;
+}
+
+#pragma mark - Rows
+
+/**
+ Hides the events in the rows from @c visibleRowCount on, and counts them on every day they cover.
+ */
+static int TCNAllDayRowCountOverflow(const TCNAllDayRowSweepItem *items,
+                                     size_t itemCount,
+                                     size_t dayCount,
+                                     uint32_t visibleRowCount,
+                                     uint32_t *rows,
+                                     uint32_t *overflowCounts) {
+    // countChanges[day] is the change in the number of hidden events from the previous day
+    long *const countChanges = overflowCounts ? calloc(dayCount + 1, sizeof(long)) : NULL;
+    if (overflowCounts && !countChanges) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < itemCount; i++) {
+        const TCNAllDayRowSweepItem item = items[i];
+        if (rows[item.index] < visibleRowCount) {
+            continue;
+        }
+        rows[item.index] = TCNAllDayRowNone;
+        if (countChanges) {
+            countChanges[(size_t)item.firstDay]++;
+            countChanges[(size_t)item.lastDay + 1]--;
+        }
+    }
+
+    if (countChanges) {
+        long hiddenCount = 0;
+        for (size_t day = 0; day < dayCount; day++) {
+            hiddenCount += countChanges[day];
+            overflowCounts[day] = (uint32_t)hiddenCount;
+        }
+    }
+    free(countChanges);
+    return 0;
+}
+
+int TCNAllDayRowEngineComputeRows(const TCNAllDayRowSpan *spans,
+                                  size_t count,
+                                  size_t dayCount,
+                                  uint32_t maximumRowCount,
+                                  uint32_t *rows,
+                                  uint32_t *overflowCounts,
+                                  uint32_t *rowCount) {
+    *rowCount = 0;
+    for (size_t day = 0; overflowCounts && day < dayCount; day++) {
+        overflowCounts[day] = 0;
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    TCNAllDayRowSweepItem *const items = malloc(count * sizeof(TCNAllDayRowSweepItem));
+    TCNAllDayRowActiveRow *const active = malloc(count * sizeof(TCNAllDayRowActiveRow));
+    uint32_t *const freeRows = malloc(count * sizeof(uint32_t));
+    if (!items || !active || !freeRows) {
+        free(items);
+        free(active);
+        free(freeRows);
+        return -1;
+    }
+
+    const int64_t lastShownDay = (int64_t)dayCount - 1;
+    size_t itemCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        rows[i] = TCNAllDayRowNone;
+        const int64_t firstDay = spans[i].firstDay;
+        const int64_t lastDay = spans[i].lastDay < firstDay ? firstDay : spans[i].lastDay;
+        if (lastDay < 0 || firstDay > lastShownDay) {
+            continue;
+        }
+        items[itemCount++] = (TCNAllDayRowSweepItem){firstDay < 0 ? 0 : firstDay, lastDay > lastShownDay ? lastShownDay : lastDay, i};
+    }
+    qsort(items, itemCount, sizeof(TCNAllDayRowSweepItem), TCNAllDayRowSweepItemCompare);
+
+    size_t activeCount = 0;
+    size_t freeCount = 0;
+    uint32_t usedRowCount = 0;
+    for (size_t i = 0; i < itemCount; i++) {
+        const TCNAllDayRowSweepItem item = items[i];
+
+        // Release every row whose event ended on an earlier day.
+        while (activeCount > 0 && active[0].lastDay < item.firstDay) {
+            const TCNAllDayRowActiveRow ended = TCNAllDayRowActivePop(active, &activeCount);
+            TCNAllDayRowFreePush(freeRows, &freeCount, ended.row);
+        }
+
+        const uint32_t row = freeCount > 0 ? TCNAllDayRowFreePop(freeRows, &freeCount) : usedRowCount++;
+        rows[item.index] = row;
+        TCNAllDayRowActivePush(active, &activeCount, (TCNAllDayRowActiveRow){item.lastDay, row});
+    }
+
+    int result = 0;
+    if (maximumRowCount > 0 && usedRowCount > maximumRowCount) {
+        result = TCNAllDayRowCountOverflow(items, itemCount, dayCount, maximumRowCount - 1, rows, overflowCounts);
+        usedRowCount = maximumRowCount;
+    }
+    *rowCount = usedRowCount;
+
+    free(items);
+    free(active);
+    free(freeRows);
+    return result;
+}
@@ -0,0 +1,57 @@
+#ifndef TCNAllDayRowEngine_h
+#define TCNAllDayRowEngine_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ The days an all-day event covers, as zero-based indexes of the days shown. Both days are included, so a one-day event
+ has equal @c firstDay and @c lastDay. A span whose @c lastDay is before its @c firstDay covers only its first day.
+ */
+typedef struct {
+    int64_t firstDay;
+    int64_t lastDay;
+} TCNAllDayRowSpan;
+
+/**
+ The row of an event that isn't shown, because it doesn't fit under the row limit or doesn't cover any of the days.
+ */
+static const uint32_t TCNAllDayRowNone = UINT32_MAX;
+
+/**
+ Packs all-day events into the fewest rows so that no two events on the same day share a row.
+
+ Events are swept in ascending first day order, longer events first so they end up above the shorter events they
+ cover, then in input order. Each event takes the lowest row that is free on its first day, which uses as many rows as
+ the most events on any one day. If that is more than @c maximumRowCount, the last row is kept for the number of events
+ on each day that don't fit, counted with a difference array over the days. This runs in O(n log n + d) time for n
+ events and d days, and O(n + d) additional memory.
+
+ @param spans The days each event covers. Spans are clipped to the days shown. May be @c NULL if @c count is 0.
+ @param count The number of events.
+ @param dayCount The number of days shown.
+ @param maximumRowCount The most rows to use, including the row of events that don't fit, or 0 for no limit.
+ @param rows An output buffer with room for @c count rows, written in input order. Events that aren't shown are given
+ @c TCNAllDayRowNone.
+ @param overflowCounts An output buffer with room for @c dayCount counts of the events on each day that don't fit, or
+ @c NULL if they aren't needed.
+ @param rowCount Set to the number of rows used, including the row of events that don't fit if there is one.
+ @return 0 on success, or -1 if scratch memory could not be allocated. The outputs are undefined on failure.
+ */
+int TCNAllDayRowEngineComputeRows(const TCNAllDayRowSpan *spans,
+                                  size_t count,
+                                  size_t dayCount,
+                                  uint32_t maximumRowCount,
+                                  uint32_t *rows,
+                                  uint32_t *overflowCounts,
+                                  uint32_t *rowCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNAllDayRowEngine_h */
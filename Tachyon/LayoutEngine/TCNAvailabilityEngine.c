@@ -0,0 +1,141 @@
+#include "TCNAvailabilityEngine.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/**
+ The next unread interval of one calendar.
+ */
+typedef struct {
+    const TCNAvailabilityCalendar *calendar;
+    size_t position;
+} TCNAvailabilityCursor;
+
+#pragma mark - Heap
+
+static double TCNAvailabilityCursorStart(const TCNAvailabilityCursor *cursor) {
+    return cursor->calendar->intervals[cursor->position].start;
+}
+
+static void TCNAvailabilityHeapSiftDown(TCNAvailabilityCursor *heap, size_t count, size_t i) {
+    while (1) {
+        const size_t left = (2 * i) + 1;
+        const size_t right = left + 1;
+        size_t smallest = i;
+        if (left < count && TCNAvailabilityCursorStart(&heap[left]) < TCNAvailabilityCursorStart(&heap[smallest])) {
+            smallest = left;
+        }
+        if (right < count && TCNAvailabilityCursorStart(&heap[right]) < TCNAvailabilityCursorStart(&heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            return;
+        }
+        const TCNAvailabilityCursor swap = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = swap;
+        i = smallest;
+    }
+}
+
+#pragma mark - Free windows
+
+typedef struct {
+    const TCNAvailabilityInterval *bounds;
+    size_t boundsCount;
+
+    /**
+     The first bound that may still contain a window. Free time is found in ascending order, so bounds that end
+     before it are never looked at again.
+     */
+    size_t boundIndex;
+
+    double minimumDuration;
+    TCNAvailabilityInterval *windows;
+    size_t maximumWindowCount;
+    size_t windowCount;
+} TCNAvailabilitySearch;
+
+/**
+ Clips the free time [start, end) to the bounds, and records the windows that are long enough.
+ */
+static void TCNAvailabilitySearchAddFreeTime(TCNAvailabilitySearch *search, double start, double end) {
+    while (search->boundIndex < search->boundsCount && search->bounds[search->boundIndex].end <= start) {
+        search->boundIndex++;
+    }
+
+    // A bound that extends past the free time may contain more of the next free time, so it isn't skipped.
+    for (size_t i = search->boundIndex; i < search->boundsCount && search->windowCount < search->maximumWindowCount; i++) {
+        const TCNAvailabilityInterval bound = search->bounds[i];
+        if (bound.start >= end) {
+            return;
+        }
+        const double windowStart = fmax(start, bound.start);
+        const double windowEnd = fmin(end, bound.end);
+        if (windowEnd - windowStart >= search->minimumDuration && windowEnd > windowStart) {
+            search->windows[search->windowCount++] = (TCNAvailabilityInterval){windowStart, windowEnd};
+        }
+    }
+}
+
+static int TCNAvailabilitySearchIsFinished(const TCNAvailabilitySearch *search) {
+    return search->windowCount >= search->maximumWindowCount || search->boundIndex >= search->boundsCount;
+}
+
+int TCNAvailabilityEngineFindFreeWindows(const TCNAvailabilityCalendar *calendars,
+                                         size_t calendarCount,
+                                         const TCNAvailabilityInterval *bounds,
+                                         size_t boundsCount,
+                                         double minimumDuration,
+                                         TCNAvailabilityInterval *windows,
+                                         size_t maximumWindowCount,
+                                         size_t *windowCount) {
+    *windowCount = 0;
+    if (boundsCount == 0 || maximumWindowCount == 0) {
+        return 0;
+    }
+
+    TCNAvailabilityCursor *const heap = malloc((calendarCount > 0 ? calendarCount : 1) * sizeof(TCNAvailabilityCursor));
+    if (!heap) {
+        return -1;
+    }
+    size_t heapCount = 0;
+    for (size_t i = 0; i < calendarCount; i++) {
+        if (calendars[i].count > 0) {
+            heap[heapCount++] = (TCNAvailabilityCursor){&calendars[i], 0};
+        }
+    }
+    for (size_t i = heapCount / 2; i-- > 0;) {
+        TCNAvailabilityHeapSiftDown(heap, heapCount, i);
+    }
+
+    TCNAvailabilitySearch search = {bounds, boundsCount, 0, minimumDuration, windows, maximumWindowCount, 0};
+
+    // Everything before the first bound is irrelevant, so the free time starts there.
+    double freeStart = bounds[0].start;
+    while (heapCount > 0 && !TCNAvailabilitySearchIsFinished(&search)) {
+        TCNAvailabilityCursor *const next = &heap[0];
+        const TCNAvailabilityInterval busy = next->calendar->intervals[next->position];
+
+        if (busy.end > busy.start) {
+            if (busy.start > freeStart) {
+                TCNAvailabilitySearchAddFreeTime(&search, freeStart, busy.start);
+            }
+            freeStart = fmax(freeStart, busy.end);
+        }
+
+        next->position++;
+        if (next->position == next->calendar->count) {
+            heap[0] = heap[--heapCount];
+        }
+        TCNAvailabilityHeapSiftDown(heap, heapCount, 0);
+    }
+
+    if (!TCNAvailabilitySearchIsFinished(&search)) {
+        TCNAvailabilitySearchAddFreeTime(&search, freeStart, INFINITY);
+    }
+
+    free(heap);
+    *windowCount = search.windowCount;
+    return 0;
+}
@@ -0,0 +1,61 @@
+#ifndef TCNAvailabilityEngine_h
+#define TCNAvailabilityEngine_h
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ A half-open interval of time [start, end), in seconds. Intervals with @c end less than or equal to @c start are empty.
+ */
+typedef struct {
+    double start;
+    double end;
+} TCNAvailabilityInterval;
+
+/**
+ One attendee's busy time.
+ */
+typedef struct {
+    /**
+     The busy intervals, sorted by ascending start. They may overlap each other. May be @c NULL if @c count is 0.
+     */
+    const TCNAvailabilityInterval *intervals;
+    size_t count;
+} TCNAvailabilityCalendar;
+
+/**
+ Finds the earliest windows of time in which no attendee is busy.
+
+ The busy intervals of all calendars are merged with a k-way merge, in ascending start order, and each gap between them
+ is clipped to the bounds. The search stops as soon as @c maximumWindowCount windows are found, so only the intervals
+ before the last window are read. This runs in O(m log k) time for the m intervals read from k calendars, and O(k)
+ additional memory.
+
+ @param calendars The attendees' calendars. May be @c NULL if @c calendarCount is 0.
+ @param calendarCount The number of calendars.
+ @param bounds The intervals windows may fall in, e.g. working hours, sorted by ascending start and not overlapping.
+ @param boundsCount The number of bounds.
+ @param minimumDuration The shortest window to return.
+ @param windows An output buffer with room for @c maximumWindowCount windows, written in ascending order. Each window is
+ as long as the free time within its bound allows.
+ @param maximumWindowCount The number of windows to find.
+ @param windowCount On success, the number of windows written to @c windows.
+ @return 0 on success, or -1 if scratch memory could not be allocated.
+ */
+int TCNAvailabilityEngineFindFreeWindows(const TCNAvailabilityCalendar *calendars,
+                                         size_t calendarCount,
+                                         const TCNAvailabilityInterval *bounds,
+                                         size_t boundsCount,
+                                         double minimumDuration,
+                                         TCNAvailabilityInterval *windows,
+                                         size_t maximumWindowCount,
+                                         size_t *windowCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNAvailabilityEngine_h */
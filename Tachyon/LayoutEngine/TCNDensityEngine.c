@@ -0,0 +1,125 @@
+#include "TCNDensityEngine.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#pragma mark - Days
+
+/**
+ The day containing @c instant: the last day starting at or before it. Instants before the first day return 0, and
+ the caller checks them against the range.
+ */
+static size_t TCNDensityDayContaining(const double *dayBoundaries, size_t dayCount, double instant) {
+    size_t lo = 0;
+    size_t hi = dayCount;
+    while (hi - lo > 1) {
+        const size_t mid = lo + ((hi - lo) / 2);
+        if (dayBoundaries[mid] <= instant) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static int TCNDensityCompareStarts(const void *a, const void *b) {
+    const double startA = ((const TCNDensityInterval *)a)->start;
+    const double startB = ((const TCNDensityInterval *)b)->start;
+    return (startA > startB) - (startA < startB);
+}
+
+#pragma mark - Busy time
+
+/**
+ Adds the merged busy range [start, end) to the days it covers, from @c *dayCursor onwards. Merged ranges are added in
+ ascending order, so the cursor only moves forward.
+ */
+static void TCNDensityAddBusyRange(const double *dayBoundaries,
+                                   size_t dayCount,
+                                   TCNDensityDay *days,
+                                   size_t *dayCursor,
+                                   double start,
+                                   double end) {
+    while (*dayCursor < dayCount && dayBoundaries[*dayCursor + 1] <= start) {
+        (*dayCursor)++;
+    }
+    for (size_t day = *dayCursor; day < dayCount && dayBoundaries[day] < end; day++) {
+        const double overlap = fmin(end, dayBoundaries[day + 1]) - fmax(start, dayBoundaries[day]);
+        if (overlap > 0) {
+            days[day].busySeconds += overlap;
+        }
+    }
+}
+
+#pragma mark - Aggregates
+
+int TCNDensityEngineComputeDays(const TCNDensityInterval *intervals,
+                                size_t count,
+                                const double *dayBoundaries,
+                                size_t dayCount,
+                                TCNDensityDay *days) {
+    if (dayCount == 0) {
+        return 0;
+    }
+
+    // countChanges[day] is the change in the number of events from the previous day
+    long *const countChanges = calloc(dayCount + 1, sizeof(long));
+    TCNDensityInterval *const busyIntervals = malloc((count > 0 ? count : 1) * sizeof(TCNDensityInterval));
+    if (!countChanges || !busyIntervals) {
+        free(countChanges);
+        free(busyIntervals);
+        return -1;
+    }
+
+    const double rangeStart = dayBoundaries[0];
+    const double rangeEnd = dayBoundaries[dayCount];
+    size_t busyCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        const TCNDensityInterval interval = intervals[i];
+        const bool isEmpty = interval.end <= interval.start;
+        const bool overlapsRange = isEmpty
+        ? (interval.start >= rangeStart && interval.start < rangeEnd)
+        : (interval.start < rangeEnd && interval.end > rangeStart);
+        if (!overlapsRange) {
+            continue;
+        }
+
+        const size_t firstDay = interval.start < rangeStart ? 0 : TCNDensityDayContaining(dayBoundaries, dayCount, interval.start);
+        size_t lastDay = firstDay;
+        if (!isEmpty) {
+            // The day containing the last instant of the range, so an event ending at midnight isn't on the next day
+            lastDay = interval.end >= rangeEnd ? dayCount - 1 : TCNDensityDayContaining(dayBoundaries, dayCount, interval.end);
+            if (lastDay > firstDay && dayBoundaries[lastDay] >= interval.end) {
+                lastDay--;
+            }
+        }
+        countChanges[firstDay]++;
+        countChanges[lastDay + 1]--;
+
+        if (interval.isBusy && !isEmpty) {
+            busyIntervals[busyCount++] = interval;
+        }
+    }
+
+    long eventCount = 0;
+    for (size_t day = 0; day < dayCount; day++) {
+        eventCount += countChanges[day];
+        days[day] = (TCNDensityDay){(size_t)eventCount, 0};
+    }
+
+    qsort(busyIntervals, busyCount, sizeof(TCNDensityInterval), TCNDensityCompareStarts);
+    size_t dayCursor = 0;
+    for (size_t i = 0; i < busyCount;) {
+        const double start = busyIntervals[i].start;
+        double end = busyIntervals[i].end;
+        for (i++; i < busyCount && busyIntervals[i].start < end; i++) {
+            end = fmax(end, busyIntervals[i].end);
+        }
+        TCNDensityAddBusyRange(dayBoundaries, dayCount, days, &dayCursor, start, end);
+    }
+
+    free(countChanges);
+    free(busyIntervals);
+    return 0;
+}
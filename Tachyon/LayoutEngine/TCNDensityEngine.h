@@ -0,0 +1,64 @@
+#ifndef TCNDensityEngine_h
+#define TCNDensityEngine_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ One event's time range [start, end), in seconds. An event with @c end less than or equal to @c start occupies only the
+ instant at @c start.
+ */
+typedef struct {
+    double start;
+    double end;
+
+    /**
+     Whether the event adds to busy time. Events that don't, e.g. all-day events, are only counted.
+     */
+    bool isBusy;
+} TCNDensityInterval;
+
+/**
+ The aggregate of the events on one day.
+ */
+typedef struct {
+    /**
+     The number of events that overlap the day.
+     */
+    size_t eventCount;
+
+    /**
+     The length of the union of the busy events' time ranges within the day, so overlapping events aren't counted twice.
+     */
+    double busySeconds;
+} TCNDensityDay;
+
+/**
+ Computes the event count and busy time of consecutive days in one pass.
+
+ Each event is counted on the days its range overlaps by adding it to a difference array over the days, found by binary
+ search. Busy events are sorted by start and swept once, merging overlapping ranges and splitting each merged range
+ across the days it covers. This runs in O(m log m + n) time for m events and n days, and O(m + n) additional memory.
+
+ @param intervals The events' time ranges, in any order. May be @c NULL if @c count is 0.
+ @param count The number of events.
+ @param dayBoundaries The start of each day and the end of the last one, in ascending order: @c dayCount + 1 values.
+ @param dayCount The number of days.
+ @param days An output buffer with room for @c dayCount days. Events outside of the days are ignored.
+ @return 0 on success, or -1 if scratch memory could not be allocated. @c days is undefined on failure.
+ */
+int TCNDensityEngineComputeDays(const TCNDensityInterval *intervals,
+                                size_t count,
+                                const double *dayBoundaries,
+                                size_t dayCount,
+                                TCNDensityDay *days);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNDensityEngine_h */
@@ -0,0 +1,87 @@
+#include "TCNEventGeometryEngine.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#pragma mark - Frames
+
+/**
+ Lays out an event at the full width of the calendar grid, from its start time to its end time.
+ */
+static TCNEventGeometryFrame TCNEventGeometryFullWidthFrame(const TCNEventGeometryMetrics *metrics, TCNEventGeometryInput input) {
+    // Don't lay out something that has the same start and end time.
+    if (input.startMinute == input.endMinute) {
+        return (TCNEventGeometryFrame){0, 0, 0, 0, {0, 1, 0}};
+    }
+
+    const double startHourY = (double)(input.startMinute / 60) * metrics->hourHeight;
+    const double startMinuteY = (double)(input.startMinute % 60) * metrics->minuteHeight;
+    const double endHourY = (double)(input.endMinute / 60) * metrics->hourHeight;
+    const double endMinuteY = (double)(input.endMinute % 60) * metrics->minuteHeight;
+
+    const double minY = ceil(startHourY + startMinuteY + metrics->calendarGridMinY + metrics->marginTop);
+    const double maxY = ceil(endHourY + endMinuteY + metrics->calendarGridMinY - metrics->marginBottom);
+    const double minX = ceil(metrics->calendarGridMinX + metrics->marginLeft);
+    const double maxX = ceil(metrics->calendarGridMaxX - metrics->marginRight);
+    return (TCNEventGeometryFrame){minX, minY, maxX - minX, maxY - minY, {0, 1, 0}};
+}
+
+#pragma mark - Overlap adjustment
+
+int TCNEventGeometryEngineComputeFrames(const TCNEventGeometryMetrics *metrics,
+                                        const TCNEventGeometryInput *inputs,
+                                        size_t count,
+                                        TCNEventGeometryFrame *frames) {
+    if (count == 0) {
+        return 0;
+    }
+
+    TCNOverlapInterval *const intervals = malloc(count * sizeof(TCNOverlapInterval));
+    TCNOverlapPlacement *const placements = malloc(count * sizeof(TCNOverlapPlacement));
+    size_t *const adjustedItems = malloc(count * sizeof(size_t));
+    if (!intervals || !placements || !adjustedItems) {
+        free(intervals);
+        free(placements);
+        free(adjustedItems);
+        return -1;
+    }
+
+    // Only adjustable events are placed into columns, in item order, so other events never change their placement.
+    size_t adjustedCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        frames[i] = TCNEventGeometryFullWidthFrame(metrics, inputs[i]);
+        if (inputs[i].shouldAdjustLayout) {
+            const double edgeY = frames[i].minY + frames[i].height;
+            intervals[adjustedCount] = (TCNOverlapInterval){fmin(frames[i].minY, edgeY), fmax(frames[i].minY, edgeY)};
+            adjustedItems[adjustedCount++] = i;
+        }
+    }
+
+    if (TCNOverlapEngineComputePlacements(intervals, adjustedCount, placements) != 0) {
+        free(intervals);
+        free(placements);
+        free(adjustedItems);
+        return -1;
+    }
+
+    for (size_t i = 0; i < adjustedCount; i++) {
+        const TCNOverlapPlacement placement = placements[i];
+        TCNEventGeometryFrame *const frame = &frames[adjustedItems[i]];
+        frame->placement = placement;
+
+        // Events that don't overlap anything keep their full width.
+        if (placement.columnCount < 2) {
+            continue;
+        }
+
+        // Divide the calendar grid between the columns of the event's overlap cluster.
+        const double divisionWidth = (metrics->calendarGridMaxX - metrics->calendarGridMinX) / placement.columnCount;
+        frame->minX = metrics->calendarGridMinX + (divisionWidth * placement.column) + metrics->marginLeft;
+        frame->width = divisionWidth - metrics->marginLeft - metrics->marginRight;
+    }
+
+    free(intervals);
+    free(placements);
+    free(adjustedItems);
+    return 0;
+}
@@ -0,0 +1,90 @@
+#ifndef TCNEventGeometryEngine_h
+#define TCNEventGeometryEngine_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TCNOverlapEngine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ The time range of a single day view event, in minutes since the start of its day.
+ */
+typedef struct {
+    int64_t startMinute;
+    int64_t endMinute;
+
+    /**
+     Whether the event takes part in overlap adjustment. Events that don't keep their full width.
+     */
+    bool shouldAdjustLayout;
+} TCNEventGeometryInput;
+
+/**
+ The measurements of one day view section that event frames are computed from.
+ */
+typedef struct {
+    /**
+     The left edge of the calendar grid and the right edge of the area events may extend to.
+     */
+    double calendarGridMinX;
+    double calendarGridMaxX;
+
+    /**
+     The top of the first hour of the calendar grid.
+     */
+    double calendarGridMinY;
+
+    double hourHeight;
+    double minuteHeight;
+
+    /**
+     The space left around each event, clockwise from the top.
+     */
+    double marginTop;
+    double marginLeft;
+    double marginBottom;
+    double marginRight;
+} TCNEventGeometryMetrics;
+
+/**
+ The computed frame of a single day view event.
+ */
+typedef struct {
+    double minX;
+    double minY;
+    double width;
+    double height;
+
+    /**
+     The event's placement among the events it overlaps. Events that don't overlap anything, or don't take part in
+     overlap adjustment, have a column count of 1.
+     */
+    TCNOverlapPlacement placement;
+} TCNEventGeometryFrame;
+
+/**
+ Computes the frames of a section's events, including overlap adjustment, exactly as @c TCNDayViewLayout does.
+
+ This only reads its arguments, so it is safe to call on any thread.
+
+ @param metrics The measurements of the section.
+ @param inputs The events' time ranges, in item order. May be @c NULL if @c count is 0.
+ @param count The number of events.
+ @param frames An output buffer with room for @c count frames, written in item order.
+ @return 0 on success, or -1 if scratch memory could not be allocated. @c frames is undefined on failure.
+ */
+int TCNEventGeometryEngineComputeFrames(const TCNEventGeometryMetrics *metrics,
+                                        const TCNEventGeometryInput *inputs,
+                                        size_t count,
+                                        TCNEventGeometryFrame *frames);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNEventGeometryEngine_h */
@@ -0,0 +1,169 @@
+#include "TCNLayoutSnapshot.h"
+
+#include <math.h>
+#include <string.h>
+
+#pragma mark - Format
+
+/**
+ The start of an encoded snapshot. The records follow it directly.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t formatVersion;
+
+    /**
+     The size of a record when the snapshot was written, so that a snapshot written by a build with a different record
+     layout is rejected.
+     */
+    uint32_t recordSize;
+    uint32_t reserved;
+
+    TCNLayoutSnapshotKey key;
+    uint64_t count;
+} TCNLayoutSnapshotHeader;
+
+static const uint32_t TCNLayoutSnapshotMagic = 0x534c4354; // "TCLS"
+static const uint32_t TCNLayoutSnapshotFormatVersion = 1;
+
+static bool TCNLayoutSnapshotIsAligned(const void *bytes) {
+    return ((uintptr_t)bytes % sizeof(uint64_t)) == 0;
+}
+
+#pragma mark - Hashing
+
+uint64_t TCNLayoutSnapshotHash(const void *bytes, size_t length, uint64_t hash) {
+    const unsigned char *const characters = bytes;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= characters[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+#pragma mark - Encoding
+
+size_t TCNLayoutSnapshotEncodedLength(size_t count) {
+    return sizeof(TCNLayoutSnapshotHeader) + (count * sizeof(TCNLayoutSnapshotRecord));
+}
+
+int TCNLayoutSnapshotEncode(const TCNLayoutSnapshotKey *key,
+                            const TCNLayoutSnapshotRecord *records,
+                            size_t count,
+                            void *buffer,
+                            size_t length) {
+    if (length < TCNLayoutSnapshotEncodedLength(count) || !TCNLayoutSnapshotIsAligned(buffer)) {
+        return -1;
+    }
+
+    TCNLayoutSnapshotHeader *const header = buffer;
+    *header = (TCNLayoutSnapshotHeader){
+        .magic = TCNLayoutSnapshotMagic,
+        .formatVersion = TCNLayoutSnapshotFormatVersion,
+        .recordSize = sizeof(TCNLayoutSnapshotRecord),
+        .reserved = 0,
+        .key = *key,
+        .count = count,
+    };
+    if (count > 0) {
+        memcpy(header + 1, records, count * sizeof(TCNLayoutSnapshotRecord));
+    }
+    return 0;
+}
+
+int TCNLayoutSnapshotDecode(const void *bytes,
+                            size_t length,
+                            TCNLayoutSnapshotKey *key,
+                            const TCNLayoutSnapshotRecord **records,
+                            size_t *count) {
+    if (!bytes || length < sizeof(TCNLayoutSnapshotHeader) || !TCNLayoutSnapshotIsAligned(bytes)) {
+        return -1;
+    }
+
+    const TCNLayoutSnapshotHeader *const header = bytes;
+    if (header->magic != TCNLayoutSnapshotMagic
+        || header->formatVersion != TCNLayoutSnapshotFormatVersion
+        || header->recordSize != sizeof(TCNLayoutSnapshotRecord)) {
+        return -1;
+    }
+
+    // A truncated file, or one with trailing bytes, isn't a snapshot that was written completely
+    const size_t maximumCount = (length - sizeof(TCNLayoutSnapshotHeader)) / sizeof(TCNLayoutSnapshotRecord);
+    if (header->count > maximumCount || TCNLayoutSnapshotEncodedLength((size_t)header->count) != length) {
+        return -1;
+    }
+
+    *key = header->key;
+    *records = (const TCNLayoutSnapshotRecord *)(header + 1);
+    *count = (size_t)header->count;
+    return 0;
+}
+
+#pragma mark - Records
+
+void TCNLayoutSnapshotMakeRecords(const TCNEventGeometryInput *inputs,
+                                  const TCNEventGeometryFrame *frames,
+                                  const uint64_t *identifiers,
+                                  size_t count,
+                                  TCNLayoutSnapshotRecord *records) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t flags = 0;
+        if (inputs[i].startMinute == inputs[i].endMinute) {
+            flags |= TCNLayoutSnapshotRecordFlagEmpty;
+        }
+        if (!inputs[i].shouldAdjustLayout) {
+            flags |= TCNLayoutSnapshotRecordFlagUnadjusted;
+        }
+
+        records[i] = (TCNLayoutSnapshotRecord){
+            .identifier = identifiers ? identifiers[i] : 0,
+            .minY = frames[i].minY,
+            .height = frames[i].height,
+            .column = frames[i].placement.column,
+            .columnCount = frames[i].placement.columnCount,
+            .stackOrder = frames[i].placement.stackOrder,
+            .flags = flags,
+        };
+    }
+}
+
+void TCNLayoutSnapshotComputeFrames(const TCNEventGeometryMetrics *metrics,
+                                    const TCNLayoutSnapshotRecord *records,
+                                    size_t count,
+                                    TCNEventGeometryFrame *frames) {
+    // The same horizontal geometry as TCNEventGeometryEngineComputeFrames, which is all that depends on the width
+    const double fullWidthMinX = ceil(metrics->calendarGridMinX + metrics->marginLeft);
+    const double fullWidthMaxX = ceil(metrics->calendarGridMaxX - metrics->marginRight);
+    for (size_t i = 0; i < count; i++) {
+        const TCNLayoutSnapshotRecord record = records[i];
+        TCNEventGeometryFrame frame = {0, record.minY, 0, record.height, {record.column, record.columnCount, record.stackOrder}};
+        if (record.columnCount >= 2) {
+            const double divisionWidth = (metrics->calendarGridMaxX - metrics->calendarGridMinX) / record.columnCount;
+            frame.minX = metrics->calendarGridMinX + (divisionWidth * record.column) + metrics->marginLeft;
+            frame.width = divisionWidth - metrics->marginLeft - metrics->marginRight;
+        } else if (!(record.flags & TCNLayoutSnapshotRecordFlagEmpty)) {
+            frame.minX = fullWidthMinX;
+            frame.width = fullWidthMaxX - fullWidthMinX;
+        }
+        frames[i] = frame;
+    }
+}
+
+bool TCNLayoutSnapshotRecordsEqual(const TCNLayoutSnapshotRecord *records,
+                                   const TCNLayoutSnapshotRecord *otherRecords,
+                                   size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        const TCNLayoutSnapshotRecord record = records[i];
+        const TCNLayoutSnapshotRecord otherRecord = otherRecords[i];
+        if (record.identifier != otherRecord.identifier
+            || record.minY != otherRecord.minY
+            || record.height != otherRecord.height
+            || record.column != otherRecord.column
+            || record.columnCount != otherRecord.columnCount
+            || record.stackOrder != otherRecord.stackOrder
+            || record.flags != otherRecord.flags) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,175 @@
+#ifndef TCNLayoutSnapshot_h
+#define TCNLayoutSnapshot_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TCNEventGeometryEngine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ Identifies the layout a snapshot was taken of. A snapshot is only used for a layout with an equal key.
+ */
+typedef struct {
+    /**
+     The laid out day, as a number of local days since the reference date.
+     */
+    int64_t day;
+
+    /**
+     A version of the day's events, chosen by the app, that changes whenever they change.
+     */
+    uint64_t dataVersion;
+
+    /**
+     A hash of everything else that the layout depends on, e.g. its measurements and time zone.
+     */
+    uint64_t configHash;
+} TCNLayoutSnapshotKey;
+
+/**
+ Properties of a snapshot record that its frame doesn't show.
+ */
+enum {
+    /**
+     The event's time range was empty, and it was laid out with an empty frame.
+     */
+    TCNLayoutSnapshotRecordFlagEmpty = 1u << 0,
+
+    /**
+     The event didn't take part in overlap adjustment, and is drawn above the others.
+     */
+    TCNLayoutSnapshotRecordFlagUnadjusted = 1u << 1,
+};
+
+/**
+ The laid out frame of one event, in units that don't depend on the section's width. The horizontal position is kept as
+ the event's column in its overlap cluster and is turned back into points for the width the snapshot is shown at.
+ */
+typedef struct {
+    /**
+     A hash of the event's identifier, or 0 if events have no identifiers.
+     */
+    uint64_t identifier;
+
+    /**
+     The vertical position and size, in points. The hour height doesn't change with the width.
+     */
+    double minY;
+    double height;
+
+    /**
+     The event's placement among the events it overlaps, which also gives its z-order.
+     */
+    uint32_t column;
+    uint32_t columnCount;
+    uint32_t stackOrder;
+
+    /**
+     A combination of @c TCNLayoutSnapshotRecordFlagEmpty and @c TCNLayoutSnapshotRecordFlagUnadjusted.
+     */
+    uint32_t flags;
+} TCNLayoutSnapshotRecord;
+
+/**
+ The seed of @c TCNLayoutSnapshotHash, for hashes that don't continue an earlier one.
+ */
+static const uint64_t TCNLayoutSnapshotHashSeed = 14695981039346656037ull;
+
+/**
+ Continues a 64-bit FNV-1a hash over @c length bytes. The result is the same on every launch, unlike @c NSObject.hash,
+ so it can be stored in a snapshot.
+
+ @param bytes The bytes to hash. May be @c NULL if @c length is 0.
+ @param length The number of bytes.
+ @param hash @c TCNLayoutSnapshotHashSeed, or the result of an earlier call to continue.
+ @return The hash.
+ */
+uint64_t TCNLayoutSnapshotHash(const void *bytes, size_t length, uint64_t hash);
+
+/**
+ The length of an encoded snapshot of @c count records.
+ */
+size_t TCNLayoutSnapshotEncodedLength(size_t count);
+
+/**
+ Writes a snapshot of @c count records into @c buffer, in the format read by @c TCNLayoutSnapshotDecode.
+
+ The format is a fixed size header followed by the records as stored in memory, in the byte order of the device. It is
+ meant for a cache on the device that wrote it, not for exchange.
+
+ @param key The key of the snapshot.
+ @param records The records, in item order. May be @c NULL if @c count is 0.
+ @param count The number of records.
+ @param buffer An output buffer of at least @c TCNLayoutSnapshotEncodedLength(count) bytes, aligned to 8 bytes.
+ @param length The length of @c buffer.
+ @return 0 on success, or -1 if @c buffer is too short or misaligned.
+ */
+int TCNLayoutSnapshotEncode(const TCNLayoutSnapshotKey *key,
+                            const TCNLayoutSnapshotRecord *records,
+                            size_t count,
+                            void *buffer,
+                            size_t length);
+
+/**
+ Reads a snapshot written by @c TCNLayoutSnapshotEncode without copying its records, so that a memory-mapped file is only
+ paged in as far as its records are read.
+
+ @param bytes The encoded snapshot, aligned to 8 bytes.
+ @param length The length of @c bytes.
+ @param key Set to the key of the snapshot.
+ @param records Set to the records, which point into @c bytes and are only valid as long as it is.
+ @param count Set to the number of records.
+ @return 0 on success, or -1 if @c bytes isn't a snapshot in the current format.
+ */
+int TCNLayoutSnapshotDecode(const void *bytes,
+                            size_t length,
+                            TCNLayoutSnapshotKey *key,
+                            const TCNLayoutSnapshotRecord **records,
+                            size_t *count);
+
+/**
+ Makes the records of events laid out by @c TCNEventGeometryEngineComputeFrames.
+
+ @param inputs The events' time ranges, in item order. May be @c NULL if @c count is 0.
+ @param frames The frames computed from @c inputs.
+ @param identifiers The hashes of the events' identifiers, or @c NULL if events have no identifiers.
+ @param count The number of events.
+ @param records An output buffer with room for @c count records, written in item order.
+ */
+void TCNLayoutSnapshotMakeRecords(const TCNEventGeometryInput *inputs,
+                                  const TCNEventGeometryFrame *frames,
+                                  const uint64_t *identifiers,
+                                  size_t count,
+                                  TCNLayoutSnapshotRecord *records);
+
+/**
+ Computes the frames of snapshot records for a section with @c metrics. They are the frames that
+ @c TCNEventGeometryEngineComputeFrames computed for the same events and @c metrics.
+
+ @param metrics The measurements of the section the snapshot is shown in.
+ @param records The records, in item order. May be @c NULL if @c count is 0.
+ @param count The number of records.
+ @param frames An output buffer with room for @c count frames, written in item order.
+ */
+void TCNLayoutSnapshotComputeFrames(const TCNEventGeometryMetrics *metrics,
+                                    const TCNLayoutSnapshotRecord *records,
+                                    size_t count,
+                                    TCNEventGeometryFrame *frames);
+
+/**
+ Whether two arrays of @c count records describe the same events laid out in the same way.
+ */
+bool TCNLayoutSnapshotRecordsEqual(const TCNLayoutSnapshotRecord *records,
+                                   const TCNLayoutSnapshotRecord *otherRecords,
+                                   size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNLayoutSnapshot_h */
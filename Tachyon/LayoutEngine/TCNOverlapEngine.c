@@ -0,0 +1,197 @@
+#include "TCNOverlapEngine.h"
+
+#include <stdlib.h>
+
+typedef struct {
+    double start;
+    double end;
+    size_t index;
+} TCNOverlapSweepItem;
+
+typedef struct {
+    double end;
+    uint32_t column;
+} TCNOverlapActiveColumn;
+
+#pragma mark - Sorting
+
+static int TCNOverlapSweepItemCompare(const void *lhs, const void *rhs) {
+    const TCNOverlapSweepItem *const a = lhs;
+    const TCNOverlapSweepItem *const b = rhs;
+    if (a->start != b->start) {
+        return a->start < b->start ? -1 : 1;
+    }
+    // Keep the sort stable so that simultaneous events are placed in data source order.
+    if (a->index != b->index) {
+        return a->index < b->index ? -1 : 1;
+    }
+    return 0;
+}
+
+#pragma mark - Heaps
+
+static void TCNOverlapActivePush(TCNOverlapActiveColumn *heap, size_t *count, TCNOverlapActiveColumn value) {
+    size_t child = (*count)++;
+    while (child > 0) {
+        const size_t parent = (child - 1) / 2;
+        if (heap[parent].end <= value.end) {
+            break;
+        }
+        heap[child] = heap[parent];
+        child = parent;
+    }
+    heap[child] = value;
+}
+
+static TCNOverlapActiveColumn TCNOverlapActivePop(TCNOverlapActiveColumn *heap, size_t *count) {
+    const TCNOverlapActiveColumn top = heap[0];
+    const TCNOverlapActiveColumn last = heap[--(*count)];
+    size_t parent = 0;
+    while (1) {
+        size_t child = (2 * parent) + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && heap[child + 1].end < heap[child].end) {
+            child++;
+        }
+        if (last.end <= heap[child].end) {
+            break;
+        }
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    if (*count > 0) {
+        heap[parent] = last;
+    }
+    return top;
+}
+
+static void TCNOverlapFreePush(uint32_t *heap, size_t *count, uint32_t value) {
+    size_t child = (*count)++;
+    while (child > 0) {
+        const size_t parent = (child - 1) / 2;
+        if (heap[parent] <= value) {
+            break;
+        }
+        heap[child] = heap[parent];
+        child = parent;
+    }
+    heap[child] = value;
+}
+
+static uint32_t TCNOverlapFreePop(uint32_t *heap, size_t *count) {
+    const uint32_t top = heap[0];
+    const uint32_t last = heap[--(*count)];
+    size_t parent = 0;
+    while (1) {
+        size_t child = (2 * parent) + 1;
+        if (child >= *count) {
+            break;
+        }
+        if (child + 1 < *count && heap[child + 1] < heap[child]) {
+            child++;
+        }
+        if (last <= heap[child]) {
+            break;
+        }
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    if (*count > 0) {
+        heap[parent] = last;
+    }
+    return top;
+}
+
+#pragma mark - Placement
+
+/**
+ Assigns the final column count and stack order to every interval in a finished cluster.
+ */
+static void TCNOverlapCloseCluster(const TCNOverlapSweepItem *items,
+                                   size_t clusterStart,
+                                   size_t clusterEnd,
+                                   uint32_t columnCount,
+                                   uint32_t *stackOrder,
+                                   TCNOverlapPlacement *placements) {
+    for (size_t i = clusterStart; i < clusterEnd; i++) {
+        TCNOverlapPlacement *const placement = &placements[items[i].index];
+        placement->columnCount = columnCount;
+        if (columnCount > 1) {
+            // Lower items stack above higher items, since the title is at the top.
+            placement->stackOrder = (*stackOrder)++;
+        } else {
+            placement->stackOrder = 0;
+        }
+    }
+}
+
+int TCNOverlapEngineComputePlacements(const TCNOverlapInterval *intervals, size_t count, TCNOverlapPlacement *placements) {
+    return TCNOverlapEngineComputePlacementsFromStackOrder(intervals, count, 0, placements);
+}
+
+int TCNOverlapEngineComputePlacementsFromStackOrder(const TCNOverlapInterval *intervals,
+                                                    size_t count,
+                                                    uint32_t firstStackOrder,
+                                                    TCNOverlapPlacement *placements) {
+    if (count == 0) {
+        return 0;
+    }
+
+    TCNOverlapSweepItem *const items = malloc(count * sizeof(TCNOverlapSweepItem));
+    TCNOverlapActiveColumn *const active = malloc(count * sizeof(TCNOverlapActiveColumn));
+    uint32_t *const freeColumns = malloc(count * sizeof(uint32_t));
+    if (!items || !active || !freeColumns) {
+        free(items);
+        free(active);
+        free(freeColumns);
+        return -1;
+    }
+
+    size_t itemCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        placements[i] = (TCNOverlapPlacement){0, 1, 0};
+        if (intervals[i].end > intervals[i].start) {
+            items[itemCount++] = (TCNOverlapSweepItem){intervals[i].start, intervals[i].end, i};
+        }
+    }
+    qsort(items, itemCount, sizeof(TCNOverlapSweepItem), TCNOverlapSweepItemCompare);
+
+    size_t activeCount = 0;
+    size_t freeCount = 0;
+    size_t clusterStart = 0;
+    uint32_t clusterColumns = 0;
+    uint32_t stackOrder = firstStackOrder;
+
+    for (size_t i = 0; i < itemCount; i++) {
+        const TCNOverlapSweepItem item = items[i];
+
+        // Release every column whose interval has ended by the time this one starts.
+        while (activeCount > 0 && active[0].end <= item.start) {
+            const TCNOverlapActiveColumn ended = TCNOverlapActivePop(active, &activeCount);
+            TCNOverlapFreePush(freeColumns, &freeCount, ended.column);
+        }
+
+        // Nothing is running anymore, so the previous cluster is complete.
+        if (activeCount == 0 && i > clusterStart) {
+            TCNOverlapCloseCluster(items, clusterStart, i, clusterColumns, &stackOrder, placements);
+            clusterStart = i;
+            clusterColumns = 0;
+            freeCount = 0;
+        }
+
+        const uint32_t column = freeCount > 0 ? TCNOverlapFreePop(freeColumns, &freeCount) : clusterColumns++;
+        placements[item.index].column = column;
+        TCNOverlapActivePush(active, &activeCount, (TCNOverlapActiveColumn){item.end, column});
+    }
+
+    if (itemCount > clusterStart) {
+        TCNOverlapCloseCluster(items, clusterStart, itemCount, clusterColumns, &stackOrder, placements);
+    }
+
+    free(items);
+    free(active);
+    free(freeColumns);
+    return 0;
+}
@@ -0,0 +1,77 @@
+#ifndef TCNOverlapEngine_h
+#define TCNOverlapEngine_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ A half-open vertical interval [start, end) for a single day view event.
+
+ Intervals with @c end less than or equal to @c start are considered empty and never overlap anything.
+ */
+typedef struct {
+    double start;
+    double end;
+} TCNOverlapInterval;
+
+/**
+ The column placement computed for a single @c TCNOverlapInterval.
+ */
+typedef struct {
+    /**
+     The zero-based column of the interval within its overlap cluster.
+     */
+    uint32_t column;
+
+    /**
+     The number of columns the interval's overlap cluster is divided into. An interval that does not overlap any
+     other interval has a column count of 1.
+     */
+    uint32_t columnCount;
+
+    /**
+     The stacking rank of the interval among all overlapping intervals, in ascending start order. Intervals that don't
+     overlap anything have a stack order of 0 and should keep their default zIndex.
+     */
+    uint32_t stackOrder;
+} TCNOverlapPlacement;
+
+/**
+ Partitions the given intervals into columns so that no two overlapping intervals share a column.
+
+ Intervals are swept in ascending (start, input index) order. Each interval takes the lowest column that is free at its
+ start, and every interval in a transitively overlapping cluster is given the column count of that cluster. This runs in
+ O(n log n) time and O(n) additional memory.
+
+ @param intervals The input intervals. May be @c NULL if @c count is 0.
+ @param count The number of intervals.
+ @param placements An output buffer with room for @c count placements, written in input order.
+ @return 0 on success, or -1 if scratch memory could not be allocated. @c placements is left untouched on failure.
+ */
+int TCNOverlapEngineComputePlacements(const TCNOverlapInterval *intervals, size_t count, TCNOverlapPlacement *placements);
+
+/**
+ Like @c TCNOverlapEngineComputePlacements, but numbers the stack orders of overlapping intervals from
+ @c firstStackOrder rather than 0. Placing a single cluster again with the stack order its first interval had in the
+ whole section gives the same placements as placing the whole section.
+
+ @param intervals The input intervals. May be @c NULL if @c count is 0.
+ @param count The number of intervals.
+ @param firstStackOrder The stack order of the first overlapping interval, in ascending start order.
+ @param placements An output buffer with room for @c count placements, written in input order.
+ @return 0 on success, or -1 if scratch memory could not be allocated. @c placements is left untouched on failure.
+ */
+int TCNOverlapEngineComputePlacementsFromStackOrder(const TCNOverlapInterval *intervals,
+                                                    size_t count,
+                                                    uint32_t firstStackOrder,
+                                                    TCNOverlapPlacement *placements);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNOverlapEngine_h */
@@ -0,0 +1,133 @@
+#include "TCNRectIndex.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+typedef struct {
+    TCNRectIndexRect rect;
+    uint32_t identifier;
+} TCNRectIndexEntry;
+
+struct TCNRectIndex {
+    size_t count;
+
+    /**
+     Entries sorted by ascending minY. The implicit tree over [lo, hi) is rooted at (lo + hi) / 2.
+     */
+    TCNRectIndexEntry *entries;
+
+    /**
+     The largest maxY in the subtree rooted at each entry.
+     */
+    double *subtreeMaxY;
+};
+
+#pragma mark - Building
+
+static int TCNRectIndexEntryCompare(const void *lhs, const void *rhs) {
+    const TCNRectIndexEntry *const a = lhs;
+    const TCNRectIndexEntry *const b = rhs;
+    if (a->rect.minY != b->rect.minY) {
+        return a->rect.minY < b->rect.minY ? -1 : 1;
+    }
+    if (a->identifier != b->identifier) {
+        return a->identifier < b->identifier ? -1 : 1;
+    }
+    return 0;
+}
+
+static double TCNRectIndexBuildSubtree(TCNRectIndex *index, size_t lo, size_t hi) {
+    if (lo >= hi) {
+        return -INFINITY;
+    }
+    const size_t mid = lo + ((hi - lo) / 2);
+    double maxY = index->entries[mid].rect.maxY;
+    const double leftMaxY = TCNRectIndexBuildSubtree(index, lo, mid);
+    const double rightMaxY = TCNRectIndexBuildSubtree(index, mid + 1, hi);
+    if (leftMaxY > maxY) {
+        maxY = leftMaxY;
+    }
+    if (rightMaxY > maxY) {
+        maxY = rightMaxY;
+    }
+    index->subtreeMaxY[mid] = maxY;
+    return maxY;
+}
+
+TCNRectIndex *TCNRectIndexCreate(const TCNRectIndexRect *rects, size_t count) {
+    TCNRectIndex *const index = calloc(1, sizeof(TCNRectIndex));
+    if (!index) {
+        return NULL;
+    }
+    if (count == 0) {
+        return index;
+    }
+
+    index->entries = malloc(count * sizeof(TCNRectIndexEntry));
+    index->subtreeMaxY = malloc(count * sizeof(double));
+    if (!index->entries || !index->subtreeMaxY) {
+        TCNRectIndexDestroy(index);
+        return NULL;
+    }
+
+    index->count = count;
+    for (size_t i = 0; i < count; i++) {
+        index->entries[i] = (TCNRectIndexEntry){rects[i], (uint32_t)i};
+    }
+    qsort(index->entries, count, sizeof(TCNRectIndexEntry), TCNRectIndexEntryCompare);
+    TCNRectIndexBuildSubtree(index, 0, count);
+    return index;
+}
+
+void TCNRectIndexDestroy(TCNRectIndex *index) {
+    if (!index) {
+        return;
+    }
+    free(index->entries);
+    free(index->subtreeMaxY);
+    free(index);
+}
+
+size_t TCNRectIndexCount(const TCNRectIndex *index) {
+    return index ? index->count : 0;
+}
+
+#pragma mark - Querying
+
+static size_t TCNRectIndexQuerySubtree(const TCNRectIndex *index,
+                                       size_t lo,
+                                       size_t hi,
+                                       TCNRectIndexRect rect,
+                                       uint32_t *results,
+                                       size_t resultCount) {
+    while (lo < hi) {
+        const size_t mid = lo + ((hi - lo) / 2);
+
+        // Nothing in this subtree reaches down to the query.
+        if (index->subtreeMaxY[mid] < rect.minY) {
+            return resultCount;
+        }
+
+        resultCount = TCNRectIndexQuerySubtree(index, lo, mid, rect, results, resultCount);
+
+        // Everything from here on starts below the query.
+        const TCNRectIndexEntry *const entry = &index->entries[mid];
+        if (entry->rect.minY > rect.maxY) {
+            return resultCount;
+        }
+
+        if (entry->rect.maxY >= rect.minY && entry->rect.minX <= rect.maxX && entry->rect.maxX >= rect.minX) {
+            results[resultCount++] = entry->identifier;
+        }
+
+        lo = mid + 1;
+    }
+    return resultCount;
+}
+
+size_t TCNRectIndexQuery(const TCNRectIndex *index, TCNRectIndexRect rect, uint32_t *results) {
+    if (!index || index->count == 0) {
+        return 0;
+    }
+    return TCNRectIndexQuerySubtree(index, 0, index->count, rect, results, 0);
+}
@@ -0,0 +1,65 @@
+#ifndef TCNRectIndex_h
+#define TCNRectIndex_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ An axis-aligned rectangle stored by its edges.
+ */
+typedef struct {
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+} TCNRectIndexRect;
+
+/**
+ An immutable spatial index over a fixed set of rectangles, optimized for the tall, narrow content of a day view.
+
+ Rectangles are sorted by @c minY into an implicit balanced tree where each node also stores the largest @c maxY in its
+ subtree. A query only descends into subtrees that can contain a hit, so its cost is O(log n + k) for k results on
+ calendar data, instead of a linear scan of every element.
+ */
+typedef struct TCNRectIndex TCNRectIndex;
+
+/**
+ Builds an index over @c rects. The index does not retain @c rects.
+
+ @param rects The rectangles to index. Their positions in this array are the identifiers returned from queries.
+ @param count The number of rectangles.
+ @return A new index that must be released with @c TCNRectIndexDestroy, or @c NULL if memory could not be allocated.
+ */
+TCNRectIndex *TCNRectIndexCreate(const TCNRectIndexRect *rects, size_t count);
+
+/**
+ Releases an index created by @c TCNRectIndexCreate. Passing @c NULL is a no-op.
+ */
+void TCNRectIndexDestroy(TCNRectIndex *index);
+
+/**
+ @return The number of rectangles in the index.
+ */
+size_t TCNRectIndexCount(const TCNRectIndex *index);
+
+/**
+ Finds every indexed rectangle that intersects or touches @c rect.
+
+ Edges are compared inclusively, so callers that need strict intersection semantics should filter the results again.
+
+ @param index The index to query.
+ @param rect The query rectangle.
+ @param results An output buffer with room for at least @c TCNRectIndexCount(index) identifiers.
+ @return The number of identifiers written to @c results.
+ */
+size_t TCNRectIndexQuery(const TCNRectIndex *index, TCNRectIndexRect rect, uint32_t *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNRectIndex_h */
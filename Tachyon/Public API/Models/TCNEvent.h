@@ -1,7 +1,14 @@
 #import <Foundation/Foundation.h>
+#import "TCNRecurrenceRule.h"
 
 @interface TCNEvent : NSObject
 
+/**
+ Identifies the event across snapshots of a calendar, so that a @c TCNDayView can tell an edited event from a new one.
+ Defaults to a new UUID. Occurrences of a recurring event are identified by the series and their start time.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSString *identifier;
+
 /**
  The name of the event.
  */
@@ -37,6 +44,16 @@
  */
 @property (nonatomic, assign, readwrite) BOOL isSelected;
 
+/**
+ When the event repeats, or @c nil if it doesn't. The event's start and end are those of its first occurrence.
+ */
+@property (nonatomic, strong, nullable, readonly) TCNRecurrenceRule *recurrenceRule;
+
+/**
+ The recurring event this event is an occurrence of, or @c nil if it isn't an occurrence.
+ */
+@property (nonatomic, strong, nullable, readonly) TCNEvent *seriesEvent;
+
 /**
  A human-readable string for this event's time and duration.
  */
@@ -55,6 +72,35 @@
                              timezone:(nullable NSTimeZone *)timezone
                              isAllDay:(BOOL)isAllDay;
 
+/**
+ A new event with the specified data, repeating according to @c recurrenceRule.
+
+ @return An instance of @c TCNEvent, assuming the provided input is valid.
+         A valid input has an endDateTime equal to or later than the startDateTime.
+ */
+- (nullable instancetype)initWithName:(nonnull NSString *)name
+                        startDateTime:(nonnull NSDate *)startDateTime
+                          endDateTime:(nonnull NSDate *)endDateTime
+                             location:(nullable NSString *)location
+                             timezone:(nullable NSTimeZone *)timezone
+                             isAllDay:(BOOL)isAllDay
+                       recurrenceRule:(nullable TCNRecurrenceRule *)recurrenceRule;
+
+/**
+ A new event with the specified data and a stable identifier, e.g. the identifier of the event in a calendar store.
+
+ @return An instance of @c TCNEvent, assuming the provided input is valid.
+         A valid input has an endDateTime equal to or later than the startDateTime.
+ */
+- (nullable instancetype)initWithIdentifier:(nonnull NSString *)identifier
+                                       name:(nonnull NSString *)name
+                              startDateTime:(nonnull NSDate *)startDateTime
+                                endDateTime:(nonnull NSDate *)endDateTime
+                                   location:(nullable NSString *)location
+                                   timezone:(nullable NSTimeZone *)timezone
+                                   isAllDay:(BOOL)isAllDay
+                             recurrenceRule:(nullable TCNRecurrenceRule *)recurrenceRule;
+
 /**
  A new @c TCNEvent with @c startDateTime and a length of one hour.
 
@@ -74,6 +120,23 @@
  */
 - (BOOL)occursOnDay:(nonnull NSDate *)date;
 
+/**
+ Asks if this event is displayed the same as another event, i.e. whether everything but their identifiers is equal.
+
+ @param event The event to compare with.
+ @return YES if the events have the same name, location, timezone, times, recurrence rule and selection state.
+ */
+- (BOOL)hasSameContentAsEvent:(nonnull TCNEvent *)event;
+
+/**
+ A single, non-recurring occurrence of this event starting at @c startDateTime, with this event's duration and details
+ and this event as its @c seriesEvent. This doesn't check that the recurrence rule has an occurrence at that time.
+
+ @param startDateTime The start of the occurrence.
+ @return A @c TCNEvent instance.
+ */
+- (nonnull TCNEvent *)occurrenceWithStartDateTime:(nonnull NSDate *)startDateTime;
+
 /**
  Merges overlapping and adjacent events in an array of @c TCNEvent objects.
  Merged events will adopt all of the properties of the earliest composing event besides the end time.
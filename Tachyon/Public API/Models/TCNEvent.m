@@ -13,6 +13,40 @@
                              location:(nullable NSString *)location
                              timezone:(nullable NSTimeZone *)timezone
                              isAllDay:(BOOL)isAllDay {
+    return [self initWithName:name
+                startDateTime:startDateTime
+                  endDateTime:endDateTime
+                     location:location
+                     timezone:timezone
+                     isAllDay:isAllDay
+               recurrenceRule:nil];
+}
+
+- (nullable instancetype)initWithName:(nonnull NSString *)name
+                        startDateTime:(nonnull NSDate *)startDateTime
+                          endDateTime:(nonnull NSDate *)endDateTime
+                             location:(nullable NSString *)location
+                             timezone:(nullable NSTimeZone *)timezone
+                             isAllDay:(BOOL)isAllDay
+                       recurrenceRule:(nullable TCNRecurrenceRule *)recurrenceRule {
+    return [self initWithIdentifier:NSUUID.UUID.UUIDString
+                               name:name
+                      startDateTime:startDateTime
+                        endDateTime:endDateTime
+                           location:location
+                           timezone:timezone
+                           isAllDay:isAllDay
+                     recurrenceRule:recurrenceRule];
+}
+
+- (nullable instancetype)initWithIdentifier:(nonnull NSString *)identifier
+                                       name:(nonnull NSString *)name
+                              startDateTime:(nonnull NSDate *)startDateTime
+                                endDateTime:(nonnull NSDate *)endDateTime
+                                   location:(nullable NSString *)location
+                                   timezone:(nullable NSTimeZone *)timezone
+                                   isAllDay:(BOOL)isAllDay
+                             recurrenceRule:(nullable TCNRecurrenceRule *)recurrenceRule {
     self = [super init];
     if (!self) {
         return self;
@@ -20,12 +54,14 @@
     if ([startDateTime compare:endDateTime] == NSOrderedDescending) {
         return nil;
     }
+    _identifier = [identifier copy];
     _name = name;
     _startDateTime = startDateTime;
     _endDateTime = endDateTime;
     _location = location;
     _timezone = timezone ?: [NSTimeZone localTimeZone];
     _isAllDay = isAllDay;
+    _recurrenceRule = recurrenceRule;
     return self;
 }
 
@@ -35,6 +71,7 @@
     if (!self) {
         return self;
     }
+    _identifier = NSUUID.UUID.UUIDString;
     _name = name;
     _startDateTime = startDateTime;
     _endDateTime = [startDateTime dateByAddingTimeInterval:3600];
@@ -52,21 +89,53 @@
             [formatter stringFromDate:self.endDateTime]];
 }
 
+- (nonnull TCNEvent *)occurrenceWithStartDateTime:(nonnull NSDate *)startDateTime {
+    // Events are never created with an end before their start, so neither is the occurrence. Expanding the series again
+    // gives each occurrence the same identifier.
+    NSString *const identifier = [NSString stringWithFormat:@"%@/%.0f", self.identifier, startDateTime.timeIntervalSinceReferenceDate];
+    TCNEvent *const occurrence = [[TCNEvent alloc] initWithIdentifier:identifier
+                                                                 name:self.name
+                                                        startDateTime:startDateTime
+                                                          endDateTime:[startDateTime dateByAddingTimeInterval:[self.endDateTime timeIntervalSinceDate:self.startDateTime]]
+                                                             location:self.location
+                                                             timezone:self.timezone
+                                                             isAllDay:self.isAllDay
+                                                       recurrenceRule:nil];
+    if (!occurrence) {
+        TCN_ASSERT_FAILURE(@"Failed to construct an occurrence of %@", self);
+        return [[TCNEvent alloc] initWithName:self.name startDateTime:startDateTime];
+    }
+    occurrence->_seriesEvent = self;
+    return TCN_FORCE_UNWRAP(occurrence);
+}
+
 - (BOOL)occursOnDay:(nonnull NSDate *)date {
     return [TCNDateUtil isDate:date inSameDayAsDate:self.startDateTime]
     || [TCNDateUtil isDate:date inSameDayAsDate:self.endDateTime]
     || ([TCNDateUtil date:date isAfterDate:self.startDateTime] && [TCNDateUtil date:date isBeforeDate:self.endDateTime]);
 }
 
+- (BOOL)hasSameContentAsEvent:(nonnull TCNEvent *)event {
+    return self.isAllDay == event.isAllDay
+    && self.isSelected == event.isSelected
+    && [self.startDateTime isEqualToDate:event.startDateTime]
+    && [self.endDateTime isEqualToDate:event.endDateTime]
+    && [self.name isEqualToString:event.name]
+    && (self.location == event.location || (self.location && event.location && [self.location isEqual:event.location]))
+    && (self.timezone == event.timezone || (self.timezone && event.timezone && [self.timezone isEqual:event.timezone]))
+    && (self.recurrenceRule == event.recurrenceRule || (self.recurrenceRule && event.recurrenceRule && [self.recurrenceRule isEqual:event.recurrenceRule]));
+}
+
 #pragma mark - NSObject
 
 - (NSString *)description {
-    return [NSString stringWithFormat:@"TCNEvent {\nname: %@\nstartTime: %@\nendTime: %@\nisAllDay: %d\nisSelected: %d\n}",
+    return [NSString stringWithFormat:@"TCNEvent {\nname: %@\nstartTime: %@\nendTime: %@\nisAllDay: %d\nisSelected: %d\nrecurrenceRule: %@\n}",
             self.name,
             self.startDateTime,
             self.endDateTime,
             self.isAllDay,
-            self.isSelected];
+            self.isSelected,
+            self.recurrenceRule];
 }
 
 #pragma mark - Static Methods
@@ -98,12 +167,14 @@
             }
         }
 
-        TCNEvent *const newEvent = [[TCNEvent alloc] initWithName:event.name
-                                                                  startDateTime:event.startDateTime
-                                                                    endDateTime:newEndDateTime
-                                                                       location:event.location
-                                                                       timezone:event.timezone
-                                                                       isAllDay:event.isAllDay];
+        TCNEvent *const newEvent = [[TCNEvent alloc] initWithIdentifier:event.identifier
+                                                                   name:event.name
+                                                          startDateTime:event.startDateTime
+                                                            endDateTime:newEndDateTime
+                                                               location:event.location
+                                                               timezone:event.timezone
+                                                               isAllDay:event.isAllDay
+                                                         recurrenceRule:nil];
         if (!newEvent) {
             TCN_ASSERT_FAILURE(@"Failed to construct merged calendar event.");
             eventIndex += 1;
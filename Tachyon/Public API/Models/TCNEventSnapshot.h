@@ -0,0 +1,46 @@
+#import <Foundation/Foundation.h>
+#import "TCNDayView.h"
+#import "TCNEvent.h"
+
+/**
+ An immutable copy of the events a @c TCNDayView shows, applied with @c TCNDayView.applySnapshot:.
+
+ Snapshots copy their arrays and never change, so they may be built on any queue, e.g. by a sync engine on a background
+ queue, and handed to the main queue to be applied. The events themselves must not be changed once in a snapshot.
+
+ A snapshot acts as the data source of the day view it is applied to, with one column per date.
+ */
+@interface TCNEventSnapshot : NSObject <TCNDayViewDataSource>
+
+/**
+ The date of each column.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSDate *> *dates;
+
+/**
+ A snapshot of a single day.
+
+ @param date The date of the day.
+ @param dayEvents The events of the day that have specific time slots.
+ @param allDayEvents The events that span the entire day.
+ @return A @c TCNEventSnapshot instance.
+ */
+- (nonnull instancetype)initWithDate:(nonnull NSDate *)date
+                           dayEvents:(nonnull NSArray<TCNEvent *> *)dayEvents
+                        allDayEvents:(nonnull NSArray<TCNEvent *> *)allDayEvents;
+
+/**
+ A snapshot of several columns, e.g. the days of a week.
+
+ @param dates The date of each column. Must not be empty.
+ @param dayEventsByColumn The events of each column that have specific time slots, one array per date.
+ @param allDayEvents The events that span the entire day, shown above every column.
+ @return A @c TCNEventSnapshot instance, or @c nil if there isn't exactly one array of events per date.
+ */
+- (nullable instancetype)initWithDates:(nonnull NSArray<NSDate *> *)dates
+                     dayEventsByColumn:(nonnull NSArray<NSArray<TCNEvent *> *> *)dayEventsByColumn
+                          allDayEvents:(nonnull NSArray<TCNEvent *> *)allDayEvents NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
@@ -0,0 +1,78 @@
+#import "TCNEventSnapshot.h"
+#import "TCNMacros.h"
+
+@interface TCNEventSnapshot ()
+
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSArray<TCNEvent *> *> *dayEventsByColumn;
+
+@end
+
+@implementation TCNEventSnapshot
+
+@synthesize allDayEvents = _allDayEvents;
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithDate:(nonnull NSDate *)date
+                           dayEvents:(nonnull NSArray<TCNEvent *> *)dayEvents
+                        allDayEvents:(nonnull NSArray<TCNEvent *> *)allDayEvents {
+    TCNEventSnapshot *const snapshot = [self initWithDates:@[date] dayEventsByColumn:@[dayEvents] allDayEvents:allDayEvents];
+    if (!snapshot) {
+        TCN_ASSERT_FAILURE(@"Failed to construct a snapshot of %@", date);
+    }
+    return TCN_FORCE_UNWRAP(snapshot);
+}
+
+- (nullable instancetype)initWithDates:(nonnull NSArray<NSDate *> *)dates
+                     dayEventsByColumn:(nonnull NSArray<NSArray<TCNEvent *> *> *)dayEventsByColumn
+                          allDayEvents:(nonnull NSArray<TCNEvent *> *)allDayEvents {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+    if (dates.count == 0 || dates.count != dayEventsByColumn.count) {
+        return nil;
+    }
+
+    _dates = [dates copy];
+    NSMutableArray<NSArray<TCNEvent *> *> *const columns = [[NSMutableArray alloc] initWithCapacity:dayEventsByColumn.count];
+    for (NSArray<TCNEvent *> *events in dayEventsByColumn) {
+        [columns addObject:[events copy]];
+    }
+    _dayEventsByColumn = columns;
+    _allDayEvents = [allDayEvents copy];
+
+    return self;
+}
+
+#pragma mark - TCNDayViewDataSource
+
+- (nonnull NSDate *)currentDate {
+    return TCN_FORCE_UNWRAP(self.dates.firstObject);
+}
+
+- (nonnull NSArray<TCNEvent *> *)dayEvents {
+    return TCN_FORCE_UNWRAP(self.dayEventsByColumn.firstObject);
+}
+
+- (NSInteger)numberOfColumns {
+    return (NSInteger)self.dates.count;
+}
+
+- (nonnull NSDate *)dateForColumn:(NSInteger)column {
+    if (column < 0 || (NSUInteger)column >= self.dates.count) {
+        TCN_ASSERT_FAILURE(@"Column %ld is out of range of %@", (long)column, self);
+        return self.currentDate;
+    }
+    return self.dates[(NSUInteger)column];
+}
+
+- (nonnull NSArray<TCNEvent *> *)dayEventsForColumn:(NSInteger)column {
+    if (column < 0 || (NSUInteger)column >= self.dayEventsByColumn.count) {
+        TCN_ASSERT_FAILURE(@"Column %ld is out of range of %@", (long)column, self);
+        return @[];
+    }
+    return self.dayEventsByColumn[(NSUInteger)column];
+}
+
+@end
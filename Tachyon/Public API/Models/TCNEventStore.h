@@ -0,0 +1,86 @@
+#import <Foundation/Foundation.h>
+#import "TCNDayView.h"
+#import "TCNEvent.h"
+
+/**
+ Holds a calendar's events indexed by time, so that the events of a day or of any time range are found without testing
+ every event.
+
+ Queries cost O(log n + k) for k results. Adding or removing events marks the index stale, and it is rebuilt in O(n log n)
+ by the next query, so batches of changes are cheap.
+
+ Recurring events are expanded with a @c TCNRecurrenceExpander, so queries return their occurrences in the queried range
+ rather than the events themselves.
+
+ A store can act as the data source of a @c TCNDayView by setting @c currentDate. As the day view only keeps a weak
+ reference to its data source, the store must be retained elsewhere. This should only be used on one thread at a time.
+ */
+@interface TCNEventStore : NSObject <TCNDayViewDataSource>
+
+/**
+ Every event in the store, in the order they were added.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<TCNEvent *> *events;
+
+/**
+ The day whose events are returned from @c dayEvents and @c allDayEvents. Defaults to the date the store was created.
+ */
+@property (nonatomic, strong, nonnull, readwrite) NSDate *currentDate;
+
+/**
+ A new store with the specified events.
+
+ @param events The events to store.
+ @return A @c TCNEventStore instance.
+ */
+- (nonnull instancetype)initWithEvents:(nonnull NSArray<TCNEvent *> *)events NS_DESIGNATED_INITIALIZER;
+
+/**
+ A new store with no events.
+ */
+- (nonnull instancetype)init;
+
+/**
+ Adds an event to the store.
+
+ @param event The event to add.
+ */
+- (void)addEvent:(nonnull TCNEvent *)event;
+
+/**
+ Removes an event from the store. Events are compared by identity.
+
+ @param event The event to remove. Nothing happens if it isn't in the store.
+ */
+- (void)removeEvent:(nonnull TCNEvent *)event;
+
+/**
+ Removes every event from the store.
+ */
+- (void)removeAllEvents;
+
+/**
+ The events overlapping the range from @c startDate up to, but not including, @c endDate. Events with the same start
+ and end time are included if that time is in the range.
+
+ @param startDate The start of the range.
+ @param endDate The end of the range.
+ @return The matching events, sorted by start time, then by the order they were added. Occurrences of recurring events
+         follow other events starting at the same time.
+ */
+- (nonnull NSArray<TCNEvent *> *)eventsOverlappingStartDate:(nonnull NSDate *)startDate
+                                                    endDate:(nonnull NSDate *)endDate
+NS_SWIFT_NAME(events(overlappingStart:end:));
+
+/**
+ The events occurring on a day, as determined by @c -[TCNEvent occursOnDay:]. An event ending exactly at the start of the
+ day occurs on that day.
+
+ @param date Any time on the day.
+ @return The matching events, sorted by start time, then by the order they were added. Occurrences of recurring events
+         follow other events starting at the same time.
+ */
+- (nonnull NSArray<TCNEvent *> *)eventsOnDay:(nonnull NSDate *)date
+NS_SWIFT_NAME(events(onDay:));
+
+@end
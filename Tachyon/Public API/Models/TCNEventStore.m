@@ -0,0 +1,241 @@
+#import "TCNEventStore.h"
+#import "TCNCalendarContext.h"
+#import "TCNDateUtil.h"
+#import "TCNMacros.h"
+#import "TCNRecurrenceExpander.h"
+#import "TCNRectIndex.h"
+
+@interface TCNEventStore ()
+
+@property (nonatomic, strong, nonnull, readonly) NSMutableArray<TCNEvent *> *mutableEvents;
+
+/**
+ The index of @c mutableEvents by time, or @c NULL if it needs rebuilding. Identifiers are positions in
+ @c mutableEvents.
+ */
+@property (nonatomic, assign, nullable, readwrite) TCNRectIndex *index;
+
+/**
+ Expands the recurring events of @c mutableEvents. They are still indexed, but never returned from the index.
+ */
+@property (nonatomic, strong, nonnull, readonly) TCNRecurrenceExpander *recurrenceExpander;
+
+/**
+ The events on @c currentDate, split by @c isAllDay, or @c nil if they need querying.
+ */
+@property (nonatomic, copy, nullable, readwrite) NSArray<TCNEvent *> *currentDayEvents;
+@property (nonatomic, copy, nullable, readwrite) NSArray<TCNEvent *> *currentAllDayEvents;
+
+@end
+
+@implementation TCNEventStore
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithEvents:(nonnull NSArray<TCNEvent *> *)events {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _mutableEvents = [events mutableCopy];
+    _recurrenceExpander = [[TCNRecurrenceExpander alloc] init];
+    for (TCNEvent *const event in events) {
+        if (event.recurrenceRule) {
+            [_recurrenceExpander addEvent:event];
+        }
+    }
+    _currentDate = [NSDate date];
+
+    return self;
+}
+
+- (nonnull instancetype)init {
+    return [self initWithEvents:@[]];
+}
+
+- (void)dealloc {
+    TCNRectIndexDestroy(_index);
+}
+
+#pragma mark - Methods
+
+- (nonnull NSArray<TCNEvent *> *)events {
+    return [self.mutableEvents copy];
+}
+
+- (void)setCurrentDate:(nonnull NSDate *)currentDate {
+    _currentDate = currentDate;
+    [self discardCurrentDayEvents];
+}
+
+- (void)addEvent:(nonnull TCNEvent *)event {
+    [self.mutableEvents addObject:event];
+    if (event.recurrenceRule) {
+        [self.recurrenceExpander addEvent:event];
+    }
+    [self discardIndex];
+}
+
+- (void)removeEvent:(nonnull TCNEvent *)event {
+    const NSUInteger index = [self.mutableEvents indexOfObjectIdenticalTo:event];
+    if (index == NSNotFound) {
+        return;
+    }
+    [self.mutableEvents removeObjectAtIndex:index];
+    [self.recurrenceExpander removeEvent:event];
+    [self discardIndex];
+}
+
+- (void)removeAllEvents {
+    [self.mutableEvents removeAllObjects];
+    [self.recurrenceExpander removeAllEvents];
+    [self discardIndex];
+}
+
+- (nonnull NSArray<TCNEvent *> *)eventsOverlappingStartDate:(nonnull NSDate *)startDate endDate:(nonnull NSDate *)endDate {
+    const NSTimeInterval start = startDate.timeIntervalSinceReferenceDate;
+    const NSTimeInterval end = endDate.timeIntervalSinceReferenceDate;
+    NSArray<TCNEvent *> *const events = [self eventsWithCandidatesFrom:start to:end passingTest:^BOOL(NSTimeInterval eventStart, NSTimeInterval eventEnd) {
+        return eventStart < end && (eventEnd > start || (eventStart == eventEnd && eventStart >= start));
+    }];
+    return [TCNEventStore eventsByMergingEvents:events
+                                withOccurrences:[self.recurrenceExpander occurrencesOverlappingStartDate:startDate endDate:endDate]];
+}
+
+- (nonnull NSArray<TCNEvent *> *)eventsOnDay:(nonnull NSDate *)date {
+    NSDate *const startOfDay = [TCNCalendarContext.sharedContext startOfDayForDate:date];
+    const NSTimeInterval start = startOfDay.timeIntervalSinceReferenceDate;
+    const NSTimeInterval end = [TCNDateUtil dateByAddingDays:1 toDate:startOfDay].timeIntervalSinceReferenceDate;
+    NSArray<TCNEvent *> *const events = [self eventsWithCandidatesFrom:start to:end passingTest:^BOOL(NSTimeInterval eventStart, NSTimeInterval eventEnd) {
+        return eventStart < end && eventEnd >= start;
+    }];
+    return [TCNEventStore eventsByMergingEvents:events withOccurrences:[self.recurrenceExpander occurrencesOnDay:date]];
+}
+
+#pragma mark - Class helpers
+
+/**
+ Merges two lists sorted by start time, keeping events before occurrences that start at the same time.
+ */
++ (nonnull NSArray<TCNEvent *> *)eventsByMergingEvents:(nonnull NSArray<TCNEvent *> *)events
+                                       withOccurrences:(nonnull NSArray<TCNEvent *> *)occurrences {
+    if (occurrences.count == 0) {
+        return events;
+    }
+
+    NSMutableArray<TCNEvent *> *const mergedEvents = [[NSMutableArray alloc] initWithCapacity:events.count + occurrences.count];
+    NSUInteger eventIndex = 0;
+    NSUInteger occurrenceIndex = 0;
+    while (eventIndex < events.count || occurrenceIndex < occurrences.count) {
+        const BOOL takeEvent = occurrenceIndex == occurrences.count
+        || (eventIndex < events.count && [events[eventIndex].startDateTime compare:occurrences[occurrenceIndex].startDateTime] != NSOrderedDescending);
+        [mergedEvents addObject:takeEvent ? events[eventIndex++] : occurrences[occurrenceIndex++]];
+    }
+    return mergedEvents;
+}
+
+#pragma mark - TCNDayViewDataSource
+
+- (nonnull NSArray<TCNEvent *> *)dayEvents {
+    [self prepareCurrentDayEvents];
+    return self.currentDayEvents ?: @[];
+}
+
+- (nonnull NSArray<TCNEvent *> *)allDayEvents {
+    [self prepareCurrentDayEvents];
+    return self.currentAllDayEvents ?: @[];
+}
+
+/**
+ The day view asks for its events once per item, so the events of @c currentDate are only queried once.
+ */
+- (void)prepareCurrentDayEvents {
+    if (self.currentDayEvents && self.currentAllDayEvents) {
+        return;
+    }
+
+    NSMutableArray<TCNEvent *> *const dayEvents = [[NSMutableArray alloc] init];
+    NSMutableArray<TCNEvent *> *const allDayEvents = [[NSMutableArray alloc] init];
+    for (TCNEvent *event in [self eventsOnDay:self.currentDate]) {
+        if (event.isAllDay) {
+            [allDayEvents addObject:event];
+        } else {
+            [dayEvents addObject:event];
+        }
+    }
+    self.currentDayEvents = dayEvents;
+    self.currentAllDayEvents = allDayEvents;
+}
+
+- (void)discardCurrentDayEvents {
+    self.currentDayEvents = nil;
+    self.currentAllDayEvents = nil;
+}
+
+#pragma mark - Index
+
+- (void)discardIndex {
+    TCNRectIndexDestroy(self.index);
+    self.index = NULL;
+    [self discardCurrentDayEvents];
+}
+
+/**
+ Builds the index if needed. Events are indexed as vertical segments from their start time to their end time.
+ */
+- (nullable TCNRectIndex *)preparedIndex {
+    if (self.index) {
+        return self.index;
+    }
+
+    const NSUInteger count = self.mutableEvents.count;
+    TCNRectIndexRect *const rects = malloc(MAX(count, (NSUInteger)1) * sizeof(TCNRectIndexRect));
+    if (!rects) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate the event store index");
+        return NULL;
+    }
+    for (NSUInteger i = 0; i < count; i++) {
+        TCNEvent *const event = self.mutableEvents[i];
+        rects[i] = (TCNRectIndexRect){0,
+                                      event.startDateTime.timeIntervalSinceReferenceDate,
+                                      0,
+                                      event.endDateTime.timeIntervalSinceReferenceDate};
+    }
+    self.index = TCNRectIndexCreate(rects, count);
+    free(rects);
+    return self.index;
+}
+
+/**
+ The events whose time ranges touch [start, end] and pass @c test, in index order. The index compares edges
+ inclusively, so @c test decides whether touching ranges count as overlapping.
+ */
+- (nonnull NSArray<TCNEvent *> *)eventsWithCandidatesFrom:(NSTimeInterval)start
+                                                       to:(NSTimeInterval)end
+                                              passingTest:(BOOL (^_Nonnull)(NSTimeInterval eventStart, NSTimeInterval eventEnd))test {
+    TCNRectIndex *const index = [self preparedIndex];
+    const size_t count = TCNRectIndexCount(index);
+    if (!index || count == 0 || end < start) {
+        return @[];
+    }
+
+    uint32_t *const results = malloc(count * sizeof(uint32_t));
+    if (!results) {
+        TCN_ASSERT_FAILURE(@"Unable to allocate event store query results");
+        return @[];
+    }
+
+    const size_t resultCount = TCNRectIndexQuery(index, (TCNRectIndexRect){0, start, 0, end}, results);
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] initWithCapacity:resultCount];
+    for (size_t i = 0; i < resultCount; i++) {
+        TCNEvent *const event = self.mutableEvents[results[i]];
+        if (!event.recurrenceRule && test(event.startDateTime.timeIntervalSinceReferenceDate, event.endDateTime.timeIntervalSinceReferenceDate)) {
+            [events addObject:event];
+        }
+    }
+    free(results);
+    return events;
+}
+
+@end
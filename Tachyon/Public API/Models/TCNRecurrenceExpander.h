@@ -0,0 +1,76 @@
+#import <Foundation/Foundation.h>
+#import "TCNEvent.h"
+
+/**
+ Expands recurring events into their occurrences, only for the time ranges that are asked for.
+
+ The occurrences of a range are found by computing the index of each series' first occurrence in the range from its
+ recurrence rule, so a query costs time proportional to the number of series and the occurrences in the range, and
+ not to the length of any series. Occurrences are created once, with @c -[TCNEvent occurrenceWithStartDateTime:], and
+ the same instances are returned by every later query. The occurrences of each day are also cached.
+
+ Events without a recurrence rule have a single occurrence: the event itself. This should only be used on one thread at
+ a time.
+ */
+@interface TCNRecurrenceExpander : NSObject
+
+/**
+ Every event being expanded, in the order they were added.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<TCNEvent *> *events;
+
+/**
+ A new expander for the specified events.
+
+ @param events The events to expand.
+ @return A @c TCNRecurrenceExpander instance.
+ */
+- (nonnull instancetype)initWithEvents:(nonnull NSArray<TCNEvent *> *)events NS_DESIGNATED_INITIALIZER;
+
+/**
+ A new expander with no events.
+ */
+- (nonnull instancetype)init;
+
+/**
+ Adds an event to expand.
+
+ @param event The event to add.
+ */
+- (void)addEvent:(nonnull TCNEvent *)event;
+
+/**
+ Removes an event and its occurrences. Events are compared by identity.
+
+ @param event The event to remove. Nothing happens if it isn't being expanded.
+ */
+- (void)removeEvent:(nonnull TCNEvent *)event;
+
+/**
+ Removes every event.
+ */
+- (void)removeAllEvents;
+
+/**
+ The occurrences overlapping the range from @c startDate up to, but not including, @c endDate. Occurrences with the same
+ start and end time are included if that time is in the range.
+
+ @param startDate The start of the range.
+ @param endDate The end of the range.
+ @return The matching occurrences, sorted by start time, then by the order their events were added.
+ */
+- (nonnull NSArray<TCNEvent *> *)occurrencesOverlappingStartDate:(nonnull NSDate *)startDate
+                                                         endDate:(nonnull NSDate *)endDate
+NS_SWIFT_NAME(occurrences(overlappingStart:end:));
+
+/**
+ The occurrences on a day, as determined by @c -[TCNEvent occursOnDay:]. An occurrence ending exactly at the start of
+ the day occurs on that day.
+
+ @param date Any time on the day.
+ @return The matching occurrences, sorted by start time, then by the order their events were added.
+ */
+- (nonnull NSArray<TCNEvent *> *)occurrencesOnDay:(nonnull NSDate *)date
+NS_SWIFT_NAME(occurrences(onDay:));
+
+@end
@@ -0,0 +1,342 @@
+#import "TCNRecurrenceExpander.h"
+#import "TCNCalendarContext.h"
+#import "TCNDateUtil.h"
+#import "TCNMacros.h"
+
+/**
+ The expansion state of one event: its calendar, its last occurrence, and the occurrences created so far.
+ */
+@interface TCNRecurrenceSeries : NSObject
+
+@property (nonatomic, strong, nonnull, readonly) TCNEvent *event;
+
+/**
+ The calendar in the event's time zone, in which occurrences keep the event's wall clock time.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSCalendar *calendar;
+
+@property (nonatomic, strong, nonnull, readonly) NSDateComponents *startComponents;
+@property (nonatomic, assign, readonly) NSTimeInterval duration;
+
+/**
+ The index of the last occurrence allowed by the rule's count, or @c NSNotFound if the count doesn't limit it.
+ */
+@property (nonatomic, assign, readonly) NSInteger lastIndex;
+
+/**
+ The most consecutive indexes the rule can skip before it has no further occurrences.
+ */
+@property (nonatomic, assign, readonly) NSInteger maximumSkippedIndexes;
+
+/**
+ The occurrences created so far, by index.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSMutableDictionary<NSNumber *, TCNEvent *> *occurrences;
+
+@end
+
+@implementation TCNRecurrenceSeries
+
+/**
+ The Gregorian calendar repeats every 400 years, so the months a monthly rule lands on repeat after this many months.
+ */
+static const NSInteger MonthsInGregorianCycle = 400 * 12;
+
+- (nonnull instancetype)initWithEvent:(nonnull TCNEvent *)event {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    NSCalendar *const calendar = [TCNCalendarContext.sharedContext.calendar copy];
+    calendar.timeZone = event.timezone ?: TCNCalendarContext.sharedContext.timeZone;
+
+    _event = event;
+    _calendar = calendar;
+    _startComponents = [calendar components:(NSCalendarUnitYear |
+                                             NSCalendarUnitMonth |
+                                             NSCalendarUnitDay |
+                                             NSCalendarUnitHour |
+                                             NSCalendarUnitMinute |
+                                             NSCalendarUnitSecond)
+                                   fromDate:event.startDateTime];
+    _duration = [event.endDateTime timeIntervalSinceDate:event.startDateTime];
+    _occurrences = [[NSMutableDictionary alloc] init];
+    _maximumSkippedIndexes = [TCNRecurrenceSeries maximumSkippedIndexesForRule:event.recurrenceRule];
+    _lastIndex = [self lastIndexForRule:event.recurrenceRule];
+
+    return self;
+}
+
+#pragma mark - Indexes
+
+- (NSInteger)lastIndexForRule:(nullable TCNRecurrenceRule *)rule {
+    if (!rule) {
+        return 0;
+    }
+    if (rule.count == 0) {
+        return NSNotFound;
+    }
+    if (rule.frequency != TCNRecurrenceFrequencyMonthly || self.startComponents.day <= 28) {
+        return rule.count - 1;
+    }
+
+    // Skipped months don't count, so the last index is found by counting the months that have the day
+    NSInteger occurrenceCount = 0;
+    NSInteger index = 0;
+    for (NSInteger skippedMonths = 0; skippedMonths < self.maximumSkippedIndexes; index++) {
+        if ([self startDateForIndex:index]) {
+            occurrenceCount++;
+            skippedMonths = 0;
+            if (occurrenceCount == rule.count) {
+                return index;
+            }
+        } else {
+            skippedMonths++;
+        }
+    }
+    return index - 1;
+}
+
+/**
+ Months without the event's day of the month are skipped, e.g. a rule on February 29 skips 95 months across 2100, and
+ an interval of several months skips more. The event's own month comes round again within one Gregorian cycle of the
+ rule's months, so skipping a whole cycle means the rule never occurs again.
+ */
++ (NSInteger)maximumSkippedIndexesForRule:(nullable TCNRecurrenceRule *)rule {
+    if (!rule || rule.frequency != TCNRecurrenceFrequencyMonthly) {
+        return 1;
+    }
+
+    NSInteger cycle = MonthsInGregorianCycle;
+    NSInteger interval = rule.interval % MonthsInGregorianCycle;
+    while (interval > 0) {
+        const NSInteger remainder = cycle % interval;
+        cycle = interval;
+        interval = remainder;
+    }
+    return MonthsInGregorianCycle / cycle;
+}
+
+/**
+ The start of the occurrence at @c index, or @c nil if the rule skips it.
+ */
+- (nullable NSDate *)startDateForIndex:(NSInteger)index {
+    TCNRecurrenceRule *const rule = self.event.recurrenceRule;
+    if (index == 0 || !rule) {
+        return index == 0 ? self.event.startDateTime : nil;
+    }
+
+    switch (rule.frequency) {
+        case TCNRecurrenceFrequencyDaily:
+        case TCNRecurrenceFrequencyWeekly: {
+            const NSInteger days = index * rule.interval * (rule.frequency == TCNRecurrenceFrequencyWeekly ? 7 : 1);
+            return [self.calendar dateByAddingUnit:NSCalendarUnitDay value:days toDate:self.event.startDateTime options:0];
+        }
+        case TCNRecurrenceFrequencyMonthly: {
+            const NSInteger months = (self.startComponents.month - 1) + (index * rule.interval);
+            NSDateComponents *const components = [self.startComponents copy];
+            components.year = self.startComponents.year + (months / 12);
+            components.month = (months % 12) + 1;
+
+            // The calendar rolls a day that the month doesn't have over into the next month
+            NSDate *const date = [self.calendar dateFromComponents:components];
+            if (!date || [self.calendar component:NSCalendarUnitDay fromDate:TCN_FORCE_UNWRAP(date)] != components.day) {
+                return nil;
+            }
+            return date;
+        }
+    }
+    return nil;
+}
+
+/**
+ An index at or before the first occurrence starting at or after @c date.
+ */
+- (NSInteger)firstIndexNearDate:(nonnull NSDate *)date {
+    TCNRecurrenceRule *const rule = self.event.recurrenceRule;
+    if (!rule || [date compare:self.event.startDateTime] != NSOrderedDescending) {
+        return 0;
+    }
+
+    NSInteger index = 0;
+    switch (rule.frequency) {
+        case TCNRecurrenceFrequencyDaily:
+        case TCNRecurrenceFrequencyWeekly: {
+            const NSInteger days = [self.calendar components:NSCalendarUnitDay fromDate:self.event.startDateTime toDate:date options:0].day;
+            index = days / (rule.interval * (rule.frequency == TCNRecurrenceFrequencyWeekly ? 7 : 1));
+            break;
+        }
+        case TCNRecurrenceFrequencyMonthly: {
+            const NSInteger months = [self.calendar components:NSCalendarUnitMonth fromDate:self.event.startDateTime toDate:date options:0].month;
+            index = months / rule.interval;
+            break;
+        }
+    }
+
+    // Wall clock time shifts around time zone transitions, so start one occurrence early
+    return MAX(index - 1, 0);
+}
+
+#pragma mark - Occurrences
+
+- (void)addOccurrencesFrom:(NSTimeInterval)start
+                        to:(NSTimeInterval)end
+               passingTest:(BOOL (^_Nonnull)(NSTimeInterval occurrenceStart, NSTimeInterval occurrenceEnd))test
+                   toArray:(nonnull NSMutableArray<TCNEvent *> *)occurrences {
+    TCNRecurrenceRule *const rule = self.event.recurrenceRule;
+    NSDate *const untilDate = rule.untilDate;
+    NSSet<NSDate *> *const exceptionDates = rule.exceptionDates;
+
+    NSInteger skippedMonths = 0;
+    for (NSInteger index = [self firstIndexNearDate:[NSDate dateWithTimeIntervalSinceReferenceDate:start - MAX(self.duration, 0)]];
+         self.lastIndex == NSNotFound || index <= self.lastIndex;
+         index++) {
+        NSDate *const occurrenceStart = [self startDateForIndex:index];
+        if (!occurrenceStart) {
+            if (++skippedMonths >= self.maximumSkippedIndexes || !rule) {
+                return;
+            }
+            continue;
+        }
+        skippedMonths = 0;
+
+        const NSTimeInterval occurrenceStartTime = occurrenceStart.timeIntervalSinceReferenceDate;
+        if (occurrenceStartTime >= end || (untilDate && [occurrenceStart compare:TCN_FORCE_UNWRAP(untilDate)] == NSOrderedDescending)) {
+            return;
+        }
+        if ([exceptionDates containsObject:occurrenceStart] || !test(occurrenceStartTime, occurrenceStartTime + self.duration)) {
+            continue;
+        }
+        [occurrences addObject:[self occurrenceAtIndex:index startDate:occurrenceStart]];
+    }
+}
+
+- (nonnull TCNEvent *)occurrenceAtIndex:(NSInteger)index startDate:(nonnull NSDate *)startDate {
+    if (!self.event.recurrenceRule) {
+        return self.event;
+    }
+
+    TCNEvent *occurrence = self.occurrences[@(index)];
+    if (!occurrence) {
+        occurrence = [self.event occurrenceWithStartDateTime:startDate];
+        self.occurrences[@(index)] = occurrence;
+    }
+    return occurrence;
+}
+
+@end
+
+@interface TCNRecurrenceExpander ()
+
+@property (nonatomic, strong, nonnull, readonly) NSMutableArray<TCNRecurrenceSeries *> *series;
+
+/**
+ The occurrences of each day, by the day counted like @c TCNCalendarDayMinute.day.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSCache<NSNumber *, NSArray<TCNEvent *> *> *dayOccurrences;
+
+@end
+
+@implementation TCNRecurrenceExpander
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithEvents:(nonnull NSArray<TCNEvent *> *)events {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _series = [[NSMutableArray alloc] initWithCapacity:events.count];
+    for (TCNEvent *const event in events) {
+        [_series addObject:[[TCNRecurrenceSeries alloc] initWithEvent:event]];
+    }
+    _dayOccurrences = [[NSCache alloc] init];
+
+    return self;
+}
+
+- (nonnull instancetype)init {
+    return [self initWithEvents:@[]];
+}
+
+#pragma mark - Methods
+
+- (nonnull NSArray<TCNEvent *> *)events {
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] initWithCapacity:self.series.count];
+    for (TCNRecurrenceSeries *const series in self.series) {
+        [events addObject:series.event];
+    }
+    return events;
+}
+
+- (void)addEvent:(nonnull TCNEvent *)event {
+    [self.series addObject:[[TCNRecurrenceSeries alloc] initWithEvent:event]];
+    [self.dayOccurrences removeAllObjects];
+}
+
+- (void)removeEvent:(nonnull TCNEvent *)event {
+    const NSUInteger index = [self.series indexOfObjectPassingTest:^BOOL(TCNRecurrenceSeries *series, __unused NSUInteger idx, __unused BOOL *stop) {
+        return series.event == event;
+    }];
+    if (index == NSNotFound) {
+        return;
+    }
+    [self.series removeObjectAtIndex:index];
+    [self.dayOccurrences removeAllObjects];
+}
+
+- (void)removeAllEvents {
+    [self.series removeAllObjects];
+    [self.dayOccurrences removeAllObjects];
+}
+
+- (nonnull NSArray<TCNEvent *> *)occurrencesOverlappingStartDate:(nonnull NSDate *)startDate endDate:(nonnull NSDate *)endDate {
+    const NSTimeInterval start = startDate.timeIntervalSinceReferenceDate;
+    const NSTimeInterval end = endDate.timeIntervalSinceReferenceDate;
+    return [self occurrencesFrom:start to:end passingTest:^BOOL(NSTimeInterval occurrenceStart, NSTimeInterval occurrenceEnd) {
+        return occurrenceStart < end && (occurrenceEnd > start || (occurrenceStart == occurrenceEnd && occurrenceStart >= start));
+    }];
+}
+
+- (nonnull NSArray<TCNEvent *> *)occurrencesOnDay:(nonnull NSDate *)date {
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    NSNumber *const day = @([calendarContext dayMinuteForDate:date].day);
+    NSArray<TCNEvent *> *const cachedOccurrences = [self.dayOccurrences objectForKey:day];
+    if (cachedOccurrences) {
+        return TCN_FORCE_UNWRAP(cachedOccurrences);
+    }
+
+    NSDate *const startOfDay = [calendarContext startOfDayForDate:date];
+    const NSTimeInterval start = startOfDay.timeIntervalSinceReferenceDate;
+    const NSTimeInterval end = [TCNDateUtil dateByAddingDays:1 toDate:startOfDay].timeIntervalSinceReferenceDate;
+    NSArray<TCNEvent *> *const occurrences = [self occurrencesFrom:start to:end passingTest:^BOOL(NSTimeInterval occurrenceStart, NSTimeInterval occurrenceEnd) {
+        return occurrenceStart < end && occurrenceEnd >= start;
+    }];
+    [self.dayOccurrences setObject:occurrences forKey:day];
+    return occurrences;
+}
+
+#pragma mark - Expansion
+
+/**
+ The occurrences that start before @c end and pass @c test, sorted by start time, then by series.
+ */
+- (nonnull NSArray<TCNEvent *> *)occurrencesFrom:(NSTimeInterval)start
+                                              to:(NSTimeInterval)end
+                                     passingTest:(BOOL (^_Nonnull)(NSTimeInterval occurrenceStart, NSTimeInterval occurrenceEnd))test {
+    if (end < start) {
+        return @[];
+    }
+
+    NSMutableArray<TCNEvent *> *const occurrences = [[NSMutableArray alloc] init];
+    for (TCNRecurrenceSeries *const series in self.series) {
+        [series addOccurrencesFrom:start to:end passingTest:test toArray:occurrences];
+    }
+    return [occurrences sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(TCNEvent *first, TCNEvent *second) {
+        return [first.startDateTime compare:second.startDateTime];
+    }];
+}
+
+@end
@@ -0,0 +1,83 @@
+#import <Foundation/Foundation.h>
+
+/**
+ How often a recurring event repeats.
+ */
+typedef NS_ENUM(NSInteger, TCNRecurrenceFrequency) {
+
+    /**
+     Every @c interval days, at the same time of day.
+     */
+    TCNRecurrenceFrequencyDaily,
+
+    /**
+     Every @c interval weeks, on the same weekday and time of day.
+     */
+    TCNRecurrenceFrequencyWeekly,
+
+    /**
+     Every @c interval months, on the same day of the month and time of day. Months without that day are skipped.
+     */
+    TCNRecurrenceFrequencyMonthly
+
+};
+
+/**
+ When a recurring @c TCNEvent repeats: a subset of an iCalendar RRULE, with the series' EXDATE exceptions.
+
+ The first occurrence is the event itself. Occurrences keep the event's wall clock time in its time zone.
+ */
+@interface TCNRecurrenceRule : NSObject
+
+/**
+ How often the event repeats.
+ */
+@property (nonatomic, assign, readonly) TCNRecurrenceFrequency frequency;
+
+/**
+ The number of days, weeks or months between occurrences. At least 1.
+ */
+@property (nonatomic, assign, readonly) NSInteger interval;
+
+/**
+ The total number of occurrences, including exceptions but not skipped months, or 0 if not limited by count.
+ */
+@property (nonatomic, assign, readonly) NSInteger count;
+
+/**
+ The latest date an occurrence may start at, inclusive, or @c nil if not limited by date.
+ */
+@property (nonatomic, strong, nullable, readonly) NSDate *untilDate;
+
+/**
+ The start dates of occurrences that were removed from the series.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSSet<NSDate *> *exceptionDates;
+
+/**
+ A new recurrence rule with the specified data.
+
+ @return A @c TCNRecurrenceRule instance, or @c nil if @c interval is less than 1 or @c count is negative.
+ */
+- (nullable instancetype)initWithFrequency:(TCNRecurrenceFrequency)frequency
+                                  interval:(NSInteger)interval
+                                     count:(NSInteger)count
+                                 untilDate:(nullable NSDate *)untilDate
+                            exceptionDates:(nonnull NSSet<NSDate *> *)exceptionDates NS_DESIGNATED_INITIALIZER;
+
+/**
+ A new recurrence rule parsed from the value of an iCalendar RRULE, e.g. @c FREQ=WEEKLY;INTERVAL=2;COUNT=10.
+
+ Only the @c FREQ values @c DAILY, @c WEEKLY and @c MONTHLY, and the @c INTERVAL, @c COUNT and @c UNTIL parts are
+ supported. @c UNTIL must be a UTC date-time such as @c 20190301T120000Z, or a date such as @c 20190301, which is read
+ as the end of that day in the current time zone.
+
+ @param string The RRULE value, with or without the @c RRULE: prefix.
+ @param exceptionDates The start dates of occurrences removed from the series, from its EXDATE properties.
+ @return A @c TCNRecurrenceRule instance, or @c nil if @c string isn't a supported rule.
+ */
++ (nullable instancetype)ruleWithRRuleString:(nonnull NSString *)string exceptionDates:(nonnull NSSet<NSDate *> *)exceptionDates;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
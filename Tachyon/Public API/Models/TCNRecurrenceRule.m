@@ -0,0 +1,149 @@
+#import "TCNRecurrenceRule.h"
+#import "TCNCalendarContext.h"
+#import "TCNDateUtil.h"
+#import "TCNMacros.h"
+
+@implementation TCNRecurrenceRule
+
+#pragma mark - Initialization
+
+- (nullable instancetype)initWithFrequency:(TCNRecurrenceFrequency)frequency
+                                  interval:(NSInteger)interval
+                                     count:(NSInteger)count
+                                 untilDate:(nullable NSDate *)untilDate
+                            exceptionDates:(nonnull NSSet<NSDate *> *)exceptionDates {
+    self = [super init];
+    if (!self) {
+        return self;
+    }
+    if (interval < 1 || count < 0) {
+        return nil;
+    }
+    _frequency = frequency;
+    _interval = interval;
+    _count = count;
+    _untilDate = untilDate;
+    _exceptionDates = [exceptionDates copy];
+    return self;
+}
+
++ (nullable instancetype)ruleWithRRuleString:(nonnull NSString *)string exceptionDates:(nonnull NSSet<NSDate *> *)exceptionDates {
+    NSString *rule = [string stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]];
+    if ([rule.uppercaseString hasPrefix:@"RRULE:"]) {
+        rule = [rule substringFromIndex:@"RRULE:".length];
+    }
+
+    NSNumber *frequency;
+    NSInteger interval = 1;
+    NSInteger count = 0;
+    NSDate *untilDate;
+    for (NSString *const part in [rule componentsSeparatedByString:@";"]) {
+        if (part.length == 0) {
+            continue;
+        }
+        NSArray<NSString *> *const nameAndValue = [part componentsSeparatedByString:@"="];
+        if (nameAndValue.count != 2) {
+            return nil;
+        }
+        NSString *const name = nameAndValue[0].uppercaseString;
+        NSString *const value = nameAndValue[1].uppercaseString;
+
+        if ([name isEqualToString:@"FREQ"]) {
+            frequency = [TCNRecurrenceRule frequencyForString:value];
+            if (!frequency) {
+                return nil;
+            }
+        } else if ([name isEqualToString:@"INTERVAL"] || [name isEqualToString:@"COUNT"]) {
+            NSScanner *const scanner = [NSScanner scannerWithString:value];
+            NSInteger number = 0;
+            if (![scanner scanInteger:&number] || !scanner.isAtEnd) {
+                return nil;
+            }
+            if ([name isEqualToString:@"INTERVAL"]) {
+                interval = number;
+            } else {
+                count = number;
+            }
+        } else if ([name isEqualToString:@"UNTIL"]) {
+            untilDate = [TCNRecurrenceRule untilDateForString:value];
+            if (!untilDate) {
+                return nil;
+            }
+        } else {
+            // Rules with parts we don't support would produce the wrong occurrences
+            return nil;
+        }
+    }
+
+    if (!frequency) {
+        return nil;
+    }
+    return [[TCNRecurrenceRule alloc] initWithFrequency:(TCNRecurrenceFrequency)frequency.integerValue
+                                               interval:interval
+                                                  count:count
+                                              untilDate:untilDate
+                                         exceptionDates:exceptionDates];
+}
+
+#pragma mark - Class helpers
+
++ (nullable NSNumber *)frequencyForString:(nonnull NSString *)string {
+    if ([string isEqualToString:@"DAILY"]) {
+        return @(TCNRecurrenceFrequencyDaily);
+    } else if ([string isEqualToString:@"WEEKLY"]) {
+        return @(TCNRecurrenceFrequencyWeekly);
+    } else if ([string isEqualToString:@"MONTHLY"]) {
+        return @(TCNRecurrenceFrequencyMonthly);
+    }
+    return nil;
+}
+
++ (nullable NSDate *)untilDateForString:(nonnull NSString *)string {
+    NSDateFormatter *const formatter = [[NSDateFormatter alloc] init];
+    formatter.locale = [NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"];
+    formatter.calendar = [NSCalendar calendarWithIdentifier:NSCalendarIdentifierGregorian];
+
+    if ([string hasSuffix:@"Z"]) {
+        formatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+        formatter.dateFormat = @"yyyyMMdd'T'HHmmss'Z'";
+        return [formatter dateFromString:string];
+    }
+
+    formatter.timeZone = TCNCalendarContext.sharedContext.timeZone;
+    formatter.dateFormat = @"yyyyMMdd";
+    NSDate *const date = [formatter dateFromString:string];
+    return date ? [TCNDateUtil endOfDayForDate:TCN_FORCE_UNWRAP(date)] : nil;
+}
+
+#pragma mark - NSObject
+
+- (BOOL)isEqual:(id)object {
+    if (self == object) {
+        return YES;
+    }
+    if (![object isKindOfClass:TCNRecurrenceRule.class]) {
+        return NO;
+    }
+
+    TCNRecurrenceRule *const other = object;
+    return self.frequency == other.frequency
+        && self.interval == other.interval
+        && self.count == other.count
+        && (self.untilDate == other.untilDate || (self.untilDate && other.untilDate && [self.untilDate isEqualToDate:TCN_FORCE_UNWRAP(other.untilDate)]))
+        && [self.exceptionDates isEqualToSet:other.exceptionDates];
+}
+
+- (NSUInteger)hash {
+    return (NSUInteger)self.frequency ^ ((NSUInteger)self.interval << 8) ^ ((NSUInteger)self.count << 16) ^ self.untilDate.hash ^ self.exceptionDates.count;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"TCNRecurrenceRule {\nfrequency: %ld\ninterval: %ld\ncount: %ld\nuntilDate: %@\nexceptionDates: %lu\n}",
+            (long)self.frequency,
+            (long)self.interval,
+            (long)self.count,
+            self.untilDate,
+            (unsigned long)self.exceptionDates.count];
+}
+
+@end
@@ -0,0 +1,58 @@
+#import <Foundation/Foundation.h>
+#import "TCNEvent.h"
+
+/**
+ Finds the times at which every attendee of a meeting is free, within working hours.
+
+ Attendees' events are converted to sorted numeric intervals once, when the finder is created, and each search streams a
+ k-way merge over them. Only the events before the last window found are read, so finding the next few free windows in a
+ long horizon is fast. All-day events don't make an attendee busy, like in @c +[TCNEvent mergedEventsForEvents:].
+ */
+@interface TCNAvailabilityFinder : NSObject
+
+/**
+ The hour of the day at which working hours start, in the local time zone. Defaults to 9.
+ */
+@property (nonatomic, assign, readwrite) NSInteger workingHoursStartHour;
+
+/**
+ The hour of the day at which working hours end, in the local time zone, up to 24. Defaults to 17.
+ */
+@property (nonatomic, assign, readwrite) NSInteger workingHoursEndHour;
+
+/**
+ Whether free windows may be found on weekends. Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL includesWeekends;
+
+/**
+ A new finder over the given attendees' events.
+
+ @param eventsByAttendee The events of each attendee, in any order.
+ @return A @c TCNAvailabilityFinder instance.
+ */
+- (nonnull instancetype)initWithEventsByAttendee:(nonnull NSArray<NSArray<TCNEvent *> *> *)eventsByAttendee NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ The earliest windows of at least @c minimumDuration, within working hours, in which no attendee has an event.
+
+ Each window is returned as a selected event spanning all of its free time, so that it can be handled like an event
+ passed to @c -[TCNDayViewDelegate dayView:didSelectAvailabilityWithEvent:].
+
+ @param name The name of the returned events.
+ @param startDate The earliest time a window may start.
+ @param endDate The latest time a window may end.
+ @param minimumDuration The shortest window to return, in seconds.
+ @param maximumCount The number of windows to find.
+ @return Up to @c maximumCount events, in ascending order.
+ */
+- (nonnull NSArray<TCNEvent *> *)freeEventsWithName:(nonnull NSString *)name
+                                           fromDate:(nonnull NSDate *)startDate
+                                             toDate:(nonnull NSDate *)endDate
+                                    minimumDuration:(NSTimeInterval)minimumDuration
+                                       maximumCount:(NSUInteger)maximumCount
+NS_SWIFT_NAME(freeEvents(name:from:to:minimumDuration:maximumCount:));
+
+@end
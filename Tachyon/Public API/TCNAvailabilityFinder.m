@@ -0,0 +1,172 @@
+#import "TCNAvailabilityFinder.h"
+#import "TCNAvailabilityEngine.h"
+#import "TCNCalendarContext.h"
+#import "TCNDateUtil.h"
+#import "TCNMacros.h"
+
+@interface TCNAvailabilityFinder ()
+
+/**
+ Each attendee's busy intervals, sorted by start, in seconds since the reference date.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSData *> *busyIntervalsByAttendee;
+
+@end
+
+@implementation TCNAvailabilityFinder
+
+static const NSInteger DefaultWorkingHoursStartHour = 9;
+static const NSInteger DefaultWorkingHoursEndHour = 17;
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithEventsByAttendee:(nonnull NSArray<NSArray<TCNEvent *> *> *)eventsByAttendee {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _workingHoursStartHour = DefaultWorkingHoursStartHour;
+    _workingHoursEndHour = DefaultWorkingHoursEndHour;
+    _includesWeekends = NO;
+
+    NSMutableArray<NSData *> *const busyIntervalsByAttendee = [[NSMutableArray alloc] initWithCapacity:eventsByAttendee.count];
+    for (NSArray<TCNEvent *> *events in eventsByAttendee) {
+        [busyIntervalsByAttendee addObject:[TCNAvailabilityFinder busyIntervalsForEvents:events]];
+    }
+    _busyIntervalsByAttendee = busyIntervalsByAttendee;
+
+    return self;
+}
+
+#pragma mark - Class helpers
+
+static int TCNAvailabilityIntervalCompare(const void *lhs, const void *rhs) {
+    const TCNAvailabilityInterval *const a = lhs;
+    const TCNAvailabilityInterval *const b = rhs;
+    if (a->start != b->start) {
+        return a->start < b->start ? -1 : 1;
+    }
+    return 0;
+}
+
++ (nonnull NSData *)busyIntervalsForEvents:(nonnull NSArray<TCNEvent *> *)events {
+    NSMutableData *const data = [[NSMutableData alloc] initWithLength:events.count * sizeof(TCNAvailabilityInterval)];
+    TCNAvailabilityInterval *const intervals = data.mutableBytes;
+    size_t count = 0;
+    for (TCNEvent *event in events) {
+        if (event.isAllDay) {
+            continue;
+        }
+        intervals[count++] = (TCNAvailabilityInterval){
+            event.startDateTime.timeIntervalSinceReferenceDate,
+            event.endDateTime.timeIntervalSinceReferenceDate,
+        };
+    }
+    qsort(intervals, count, sizeof(TCNAvailabilityInterval), TCNAvailabilityIntervalCompare);
+    data.length = count * sizeof(TCNAvailabilityInterval);
+    return data;
+}
+
+/**
+ The given hour on @c day, local time. Hour 24 is the start of the next day.
+ */
++ (nonnull NSDate *)dateWithDay:(nonnull NSDate *)day atHour:(NSInteger)hour {
+    if (hour >= 24) {
+        return [TCNDateUtil dateByAddingDays:1 toDate:day];
+    }
+    return [TCNDateUtil dateWithDate:day atHour:hour];
+}
+
+#pragma mark - Methods
+
+- (nonnull NSArray<TCNEvent *> *)freeEventsWithName:(nonnull NSString *)name
+                                           fromDate:(nonnull NSDate *)startDate
+                                             toDate:(nonnull NSDate *)endDate
+                                    minimumDuration:(NSTimeInterval)minimumDuration
+                                       maximumCount:(NSUInteger)maximumCount {
+    NSData *const bounds = [self workingHoursFromDate:startDate toDate:endDate];
+    const size_t boundsCount = bounds.length / sizeof(TCNAvailabilityInterval);
+    if (boundsCount == 0 || maximumCount == 0) {
+        return @[];
+    }
+
+    const NSUInteger attendeeCount = self.busyIntervalsByAttendee.count;
+    TCNAvailabilityCalendar *const calendars = malloc(MAX(attendeeCount, (NSUInteger)1) * sizeof(TCNAvailabilityCalendar));
+    TCNAvailabilityInterval *const windows = malloc(maximumCount * sizeof(TCNAvailabilityInterval));
+    if (!calendars || !windows) {
+        free(calendars);
+        free(windows);
+        TCN_ASSERT_FAILURE(@"Unable to allocate the availability search");
+        return @[];
+    }
+    for (NSUInteger i = 0; i < attendeeCount; i++) {
+        NSData *const intervals = self.busyIntervalsByAttendee[i];
+        calendars[i] = (TCNAvailabilityCalendar){intervals.bytes, intervals.length / sizeof(TCNAvailabilityInterval)};
+    }
+
+    size_t windowCount = 0;
+    const int result = TCNAvailabilityEngineFindFreeWindows(calendars,
+                                                            attendeeCount,
+                                                            bounds.bytes,
+                                                            boundsCount,
+                                                            minimumDuration,
+                                                            windows,
+                                                            maximumCount,
+                                                            &windowCount);
+    free(calendars);
+    if (result != 0) {
+        free(windows);
+        TCN_ASSERT_FAILURE(@"Unable to allocate the availability search");
+        return @[];
+    }
+
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] initWithCapacity:windowCount];
+    for (size_t i = 0; i < windowCount; i++) {
+        TCNEvent *const event = [[TCNEvent alloc] initWithName:name
+                                                 startDateTime:[NSDate dateWithTimeIntervalSinceReferenceDate:windows[i].start]
+                                                   endDateTime:[NSDate dateWithTimeIntervalSinceReferenceDate:windows[i].end]
+                                                      location:nil
+                                                      timezone:[NSTimeZone localTimeZone]
+                                                      isAllDay:NO];
+        if (!event) {
+            TCN_ASSERT_FAILURE(@"Failed to construct a free window event.");
+            continue;
+        }
+        event.isSelected = YES;
+        [events addObject:event];
+    }
+    free(windows);
+    return events;
+}
+
+/**
+ The working hours of each day from @c startDate to @c endDate, clipped to that range.
+ */
+- (nonnull NSData *)workingHoursFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate {
+    NSMutableData *const bounds = [[NSMutableData alloc] init];
+    if (self.workingHoursEndHour <= self.workingHoursStartHour || ![TCNDateUtil date:endDate isAfterDate:startDate]) {
+        return bounds;
+    }
+
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    const NSTimeInterval start = startDate.timeIntervalSinceReferenceDate;
+    const NSTimeInterval end = endDate.timeIntervalSinceReferenceDate;
+    for (NSDate *day = [calendarContext startOfDayForDate:startDate];
+         day.timeIntervalSinceReferenceDate < end;
+         day = [TCNDateUtil dateByAddingDays:1 toDate:day]) {
+        if (!self.includesWeekends && [calendarContext.calendar isDateInWeekend:day]) {
+            continue;
+        }
+        const TCNAvailabilityInterval workingHours = {
+            MAX(start, [TCNAvailabilityFinder dateWithDay:day atHour:self.workingHoursStartHour].timeIntervalSinceReferenceDate),
+            MIN(end, [TCNAvailabilityFinder dateWithDay:day atHour:self.workingHoursEndHour].timeIntervalSinceReferenceDate),
+        };
+        if (workingHours.end > workingHours.start) {
+            [bounds appendBytes:&workingHours length:sizeof(TCNAvailabilityInterval)];
+        }
+    }
+    return bounds;
+}
+
+@end
@@ -72,6 +72,25 @@
  */
 @property (nonatomic, strong, nonnull, readwrite) UIColor *weekendTextColor;
 
+/**
+ The color of the dots that show how busy a day is, when the date picker has a density data source.
+ Defaults to gray.
+ */
+@property (nonatomic, strong, nonnull, readwrite) UIColor *eventDensityColor;
+
+/**
+ Whether the date picker scrolls freely through a range of weeks instead of paging one week at a time. Swiping doesn't
+ reload the picker, and selecting a date only moves the selection indicator, so fast flicks across months stay smooth.
+ Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL scrollsContinuously;
+
+/**
+ When @c scrollsContinuously is YES, the number of weeks that can be scrolled to before and after the selected date.
+ Selecting a date outside of this range centers the range on it. Defaults to 520, about ten years.
+ */
+@property (nonatomic, assign, readwrite) NSInteger continuousScrollingWeekRange;
+
 /**
  Optionally specified to provide a background view for the date picker collection view.
  */
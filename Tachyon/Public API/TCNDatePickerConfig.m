@@ -19,6 +19,9 @@
     _textColor = [UIColor blackColor];
     _selectedTextColor = [UIColor whiteColor];
     _weekendTextColor = [UIColor blackColor];
+    _eventDensityColor = [UIColor grayColor];
+    _scrollsContinuously = NO;
+    _continuousScrollingWeekRange = 520;
     _datePickerBackgroundProvider = nil;
     _customDatePickerViewConfig = nil;
 
@@ -1,5 +1,7 @@
 #import <UIKit/UIKit.h>
 #import "TCNDatePickerConfig.h"
+#import "TCNEvent.h"
+#import "TCNPassMetrics.h"
 
 @class TCNDatePickerView;
 
@@ -15,6 +17,43 @@
 
 @end
 
+/**
+ Classes may implement this protocol to provide the events from which a @c TCNDatePickerView shows how busy each day is.
+ */
+@protocol TCNDatePickerDensityDataSource <NSObject>
+
+/**
+ Called with the range of several weeks at once, rather than once per day, when the picker displays days whose density
+ isn't cached.
+
+ @param datePickerView The date picker requesting events.
+ @param startDate The start of the first day of the range.
+ @param endDate The start of the day after the last day of the range.
+ @return The events overlapping the half-open range from @c startDate to @c endDate.
+ */
+- (nonnull NSArray<TCNEvent *> *)datePickerView:(nonnull TCNDatePickerView *)datePickerView
+                                eventsFromDate:(nonnull NSDate *)startDate
+                                        toDate:(nonnull NSDate *)endDate;
+
+@end
+
+/**
+ Classes implementing this protocol receive the measurements of the date picker's hot paths, e.g. to report them to
+ telemetry.
+ */
+@protocol TCNDatePickerMetricsDelegate <NSObject>
+
+/**
+ Called on the main thread every time the date picker regenerates its weeks around a new date. The densities the
+ regeneration found already cached are reported as cache hits.
+
+ @param datePickerView The measured @c TCNDatePickerView.
+ @param metrics The measurements of the pass.
+ */
+- (void)datePickerView:(nonnull TCNDatePickerView *)datePickerView didMeasurePass:(nonnull TCNPassMetrics *)metrics;
+
+@end
+
 /**
  A paging view that displays the month and date, and allows users to select a date.
  */
@@ -25,6 +64,16 @@
  */
 @property (nonatomic, weak, nullable, readwrite) id<TCNDatePickerDelegate> datePickerDelegate;
 
+/**
+ Provides the events from which each day's busy-ness is shown. Densities are cached by week until they are reloaded.
+ */
+@property (nonatomic, weak, nullable, readwrite) id<TCNDatePickerDensityDataSource> densityDataSource;
+
+/**
+ The date picker's metrics delegate. The date picker only measures its passes while this is set.
+ */
+@property (nonatomic, weak, nullable, readwrite) id<TCNDatePickerMetricsDelegate> metricsDelegate;
+
 /**
  Returns the currently selected date.
  */
@@ -58,4 +107,18 @@
  */
 - (void)selectDate:(nonnull NSDate *)date animated:(BOOL)animated;
 
+/**
+ Reloads how busy the days from @c startDate to @c endDate are, e.g. after their events changed. The densities of other
+ days stay cached.
+
+ @param startDate A time on the first day to reload.
+ @param endDate A time on the last day to reload.
+ */
+- (void)reloadEventDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate;
+
+/**
+ Reloads how busy every day is.
+ */
+- (void)reloadAllEventDensities;
+
 @end
@@ -8,6 +8,7 @@
 #import "TCNNumberHelper.h"
 #import "TCNDatePickerLayout.h"
 #import "TCNViewUtils.h"
+#import "TCNTrace.h"
 
 @interface TCNDatePickerView () <UICollectionViewDelegate, UICollectionViewDelegateFlowLayout, TCNDatePickerLayoutDelegate>
 
@@ -115,7 +116,11 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
                                              superview:(nonnull UIView *)superview {
     UICollectionView *const collectionView = [[UICollectionView alloc] initWithFrame:CGRectZero collectionViewLayout:layout];
     collectionView.dataSource = dataSource;
-    collectionView.pagingEnabled = YES;
+    // Continuous scrolling snaps to weeks itself, so that a flick can move across several of them
+    collectionView.pagingEnabled = !config.scrollsContinuously;
+    if (config.scrollsContinuously) {
+        collectionView.decelerationRate = UIScrollViewDecelerationRateFast;
+    }
     collectionView.showsHorizontalScrollIndicator = NO;
     collectionView.showsVerticalScrollIndicator = NO;
     collectionView.allowsMultipleSelection = NO;
@@ -160,7 +165,12 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
     [self updateMonthLabelWithDate:[TCNDateUtil middleOfWeekForDate:[[NSDate alloc] init]]];
 }
 
-- (void)selectDate:(nonnull NSDate *)date animated:(__unused BOOL)animated {
+- (void)selectDate:(nonnull NSDate *)date animated:(BOOL)animated {
+    if (self.config.scrollsContinuously) {
+        [self continuouslySelectDate:date animated:animated];
+        return;
+    }
+
     NSIndexPath *const indexPathOfNewDate = [self.datePickerDataSource indexPathForDate:date];
 
     if (indexPathOfNewDate && indexPathOfNewDate.section == [TCNDatePickerDataSource datePickerSectionActiveWeek]) {
@@ -175,12 +185,91 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
     }
 }
 
+/**
+ Scrolls to the week of @c date and selects it. The picker is only reloaded if the date is outside the range of weeks.
+ */
+- (void)continuouslySelectDate:(nonnull NSDate *)date animated:(BOOL)animated {
+    NSIndexPath *indexPathOfNewDate = [self.datePickerDataSource indexPathForDate:date];
+    if (!indexPathOfNewDate) {
+        [self setupWeekDatesWithCurrentlyVisibleDate:date];
+        [self.collectionView reloadData];
+        indexPathOfNewDate = [self.datePickerDataSource indexPathForDate:date];
+        animated = NO;
+    }
+    if (!indexPathOfNewDate) {
+        TCN_ASSERT_FAILURE(@"No index path for %@ after centering the date picker on it", date);
+        return;
+    }
+
+    [self updateActiveWeekSection:indexPathOfNewDate.section];
+    [self scrollToActiveWeekAnimated:animated];
+    [self triggerSelectInCollectionViewForIndexPath:TCN_FORCE_UNWRAP(indexPathOfNewDate)];
+}
+
 - (void)updateDataSourceWithSelectedDate:(nonnull NSDate *)date {
     if (self.selectedDate && [TCNDateUtil isDate:date inSameDayAsDate:self.selectedDate]) {
         return;
     }
     self.datePickerDataSource.selectedDate = date;
+    if (!self.config.scrollsContinuously) {
+        [self setupWeekDatesWithCurrentlyVisibleDate:date];
+    }
+}
+
+/**
+ Regenerates the weeks of the data source around @c date, and reports the pass to the metrics delegate.
+ */
+- (void)setupWeekDatesWithCurrentlyVisibleDate:(nonnull NSDate *)date {
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameWeekRegeneration);
+    TCNDayDensityCache *const densityCache = self.datePickerDataSource.densityCache;
+    const NSInteger hitCount = densityCache.hitCount;
+    const NSInteger lookupCount = densityCache.lookupCount;
+
     [self.datePickerDataSource setupWeekDatesWithCurrentlyVisibleDate:date];
+
+    const NSTimeInterval duration = TCNTraceEnd(traceInterval);
+    id<TCNDatePickerMetricsDelegate> const metricsDelegate = self.metricsDelegate;
+    if (!metricsDelegate) {
+        return;
+    }
+
+    const NSInteger weekCount = [self.datePickerDataSource numberOfSectionsInCollectionView:self.collectionView];
+    TCNPassMetrics *const metrics = [[TCNPassMetrics alloc] initWithName:traceInterval.name
+                                                                duration:duration
+                                                            elementCount:weekCount * DaysInAWeek
+                                                           cacheHitCount:densityCache.hitCount - hitCount
+                                                        cacheLookupCount:densityCache.lookupCount - lookupCount];
+    [metricsDelegate datePickerView:self didMeasurePass:metrics];
+}
+
+/**
+ Makes @c section the visible week when scrolling continuously, and updates the month label for it.
+ */
+- (void)updateActiveWeekSection:(NSInteger)section {
+    if (section == self.datePickerDataSource.activeWeekSection) {
+        return;
+    }
+    self.datePickerDataSource.activeWeekSection = section;
+    [self.datePickerDataSource prepareDaysNearWeekSection:section];
+    [self.datePickerDataSource prepareEventDensities];
+
+    NSDate *const weekDate = [self.datePickerDataSource dateForItemAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:section]];
+    if (weekDate) {
+        [self updateMonthLabelWithDate:[TCNDateUtil middleOfWeekForDate:TCN_FORCE_UNWRAP(weekDate)]];
+    }
+}
+
+/**
+ The section of the week nearest to @c contentOffset when scrolling continuously. Each week is one page wide.
+ */
+- (NSInteger)weekSectionForContentOffset:(CGPoint)contentOffset {
+    const CGFloat pageWidth = self.collectionView.bounds.size.width;
+    const NSInteger numberOfSections = self.collectionView.numberOfSections;
+    if (pageWidth <= 0 || numberOfSections == 0) {
+        return self.datePickerDataSource.activeWeekSection;
+    }
+    const NSInteger section = (NSInteger)round(contentOffset.x / pageWidth);
+    return MIN(MAX(section, 0), numberOfSections - 1);
 }
 
 - (void)updateMonthLabelWithDate:(nonnull NSDate *)date {
@@ -191,6 +280,52 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
     return self.datePickerDataSource.selectedDate;
 }
 
+- (void)setDensityDataSource:(nullable id<TCNDatePickerDensityDataSource>)densityDataSource {
+    _densityDataSource = densityDataSource;
+    if (!densityDataSource) {
+        self.datePickerDataSource.densityCache = nil;
+        [self updateVisibleEventDensities];
+        return;
+    }
+
+    __weak TCNDatePickerView *const weakSelf = self;
+    self.datePickerDataSource.densityCache = [[TCNDayDensityCache alloc] initWithEventsProvider:^NSArray<TCNEvent *> *(NSDate *startDate, NSDate *endDate) {
+        TCNDatePickerView *const strongSelf = weakSelf;
+        if (!strongSelf) {
+            return @[];
+        }
+        return [strongSelf.densityDataSource datePickerView:strongSelf eventsFromDate:startDate toDate:endDate] ?: @[];
+    }];
+    [self.datePickerDataSource prepareEventDensities];
+    [self updateVisibleEventDensities];
+}
+
+- (void)reloadEventDensitiesFromDate:(nonnull NSDate *)startDate toDate:(nonnull NSDate *)endDate {
+    [self.datePickerDataSource.densityCache invalidateDensitiesFromDate:startDate toDate:endDate];
+    [self.datePickerDataSource prepareEventDensities];
+    [self updateVisibleEventDensities];
+}
+
+- (void)reloadAllEventDensities {
+    [self.datePickerDataSource.densityCache invalidateAllDensities];
+    [self.datePickerDataSource prepareEventDensities];
+    [self updateVisibleEventDensities];
+}
+
+/**
+ Updates the densities shown by the visible cells, without reloading them.
+ */
+- (void)updateVisibleEventDensities {
+    TCNDayDensityCache *const densityCache = self.datePickerDataSource.densityCache;
+    for (UICollectionViewCell *const cell in self.collectionView.visibleCells) {
+        TCNDatePickerDayView *const dayView = TCN_CAST_OR_NIL(cell, TCNDatePickerDayView);
+        if (!dayView || !dayView.date) {
+            continue;
+        }
+        dayView.eventDensity = densityCache ? [densityCache densityForDate:dayView.date] : (TCNDayDensity){0, 0};
+    }
+}
+
 - (void)layoutSubviews {
     [super layoutSubviews];
 
@@ -216,20 +351,28 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
         HorizontalInsetDimension,
         0,
         HorizontalInsetDimension + additionalRightSpacing);
+    // Laying out every week of a continuously scrolling picker is only worth it when the width changed
+    const BOOL itemWidthChanged = itemWidth != self.collectionViewItemWidth;
     self.collectionViewItemWidth = itemWidth;
     self.collectionViewLayout.sectionInset = self.collectionView.contentInset;
 
-    [self.collectionView.collectionViewLayout invalidateLayout];
+    if (!self.config.scrollsContinuously || itemWidthChanged) {
+        [self.collectionView.collectionViewLayout invalidateLayout];
+    }
     [self scrollToActiveWeek];
 }
 
 - (void)scrollToActiveWeek {
+    [self scrollToActiveWeekAnimated:NO];
+}
+
+- (void)scrollToActiveWeekAnimated:(BOOL)animated {
     const UICollectionViewScrollPosition scrollPosition = [TCNViewUtils isLayoutDirectionRTL]
     ? UICollectionViewScrollPositionRight
     : UICollectionViewScrollPositionLeft;
-    [self.collectionView scrollToItemAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:[TCNDatePickerDataSource datePickerSectionActiveWeek]]
+    [self.collectionView scrollToItemAtIndexPath:[NSIndexPath indexPathForRow:0 inSection:self.datePickerDataSource.activeWeekSection]
                                 atScrollPosition:scrollPosition
-                                        animated:NO];
+                                        animated:animated];
     self.lastContentOffset = self.collectionView.contentOffset;
 }
 
@@ -257,6 +400,18 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
 
     // select the new date
     [self updateDataSourceWithSelectedDate:newSelectedDate];
+
+    // When scrolling continuously, only the selection indicator and the styling of the two visible cells change
+    if (self.config.scrollsContinuously) {
+        for (NSIndexPath *const indexPathToRestyle in indexPathsToReload) {
+            TCNDatePickerDayView *const cell = TCN_CAST_OR_NIL([collectionView cellForItemAtIndexPath:indexPathToRestyle], TCNDatePickerDayView);
+            [cell applyStylingFromConfig:self.config selected:[indexPathToRestyle isEqual:indexPath]];
+        }
+        [self.collectionViewLayout invalidateSelectionIndicator];
+        [self.datePickerDelegate datePickerView:self didSelectDate:newSelectedDate];
+        return;
+    }
+
     [self.collectionViewLayout invalidateLayout];
 
     // If the new selection is a different indexPath,
@@ -270,7 +425,30 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
     [self.datePickerDelegate datePickerView:self didSelectDate:newSelectedDate];
 }
 
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+    // Programmatic scrolling already sets the active week, and layout passes may scroll through other weeks
+    if (!self.config.scrollsContinuously || !(scrollView.isDragging || scrollView.isDecelerating)) {
+        return;
+    }
+    [self updateActiveWeekSection:[self weekSectionForContentOffset:self.collectionView.contentOffset]];
+}
+
+- (void)scrollViewWillEndDragging:(__unused UIScrollView *)scrollView
+                     withVelocity:(__unused CGPoint)velocity
+              targetContentOffset:(inout CGPoint *)targetContentOffset {
+    if (!self.config.scrollsContinuously) {
+        return;
+    }
+    // Snap to the start of the week nearest to where the scroll view would stop
+    const NSInteger section = [self weekSectionForContentOffset:*targetContentOffset];
+    targetContentOffset->x = (CGFloat)section * self.collectionView.bounds.size.width;
+}
+
 - (void)scrollViewDidEndDecelerating:(__unused UIScrollView *)scrollView {
+    if (self.config.scrollsContinuously) {
+        return;
+    }
+
     NSDate *newDate;
 
     // If there is enough change in the last content offset, then we'll swipe
@@ -288,7 +466,7 @@ static const CGFloat AdditionalTitleLabelHeight = 1.0f;
 
     [self updateMonthLabelWithDate:[TCNDateUtil middleOfWeekForDate:newDate]];
 
-    [self.datePickerDataSource setupWeekDatesWithCurrentlyVisibleDate:newDate];
+    [self setupWeekDatesWithCurrentlyVisibleDate:newDate];
     [self.collectionView reloadData];
 
     [self scrollToActiveWeek];
@@ -1,4 +1,5 @@
 #import "TCNDateUtil.h"
+#import "TCNCalendarContext.h"
 #import "TCNDateFormatter.h"
 #import "TCNMacros.h"
 
@@ -7,7 +8,7 @@
 #pragma mark - Date manipulation
 
 + (nonnull NSDate *)dateWithDate:(nonnull NSDate *)date atHour:(NSInteger)hour {
-    NSDate *const newDate = [[NSCalendar currentCalendar] dateBySettingHour:hour minute:0 second:0 ofDate:date options:0];
+    NSDate *const newDate = [TCNCalendarContext.sharedContext.calendar dateBySettingHour:hour minute:0 second:0 ofDate:date options:0];
     if (!newDate) {
         return date;
     }
@@ -15,11 +16,11 @@
 }
 
 + (nonnull NSDate *)dateWithDate:(nonnull NSDate *)date atHour:(NSInteger)hour andMinute:(NSInteger)minute {
-    NSDate *const newDate = [[NSCalendar currentCalendar] dateBySettingHour:hour
-                                                                     minute:minute
-                                                                     second:0
-                                                                     ofDate:date
-                                                                    options:0];
+    NSDate *const newDate = [TCNCalendarContext.sharedContext.calendar dateBySettingHour:hour
+                                                                                  minute:minute
+                                                                                  second:0
+                                                                                  ofDate:date
+                                                                                 options:0];
     if (!newDate) {
         return date;
     }
@@ -29,7 +30,7 @@
 + (nonnull NSDate *)dateByAddingDays:(NSInteger)days toDate:(nonnull NSDate *)date {
     NSDateComponents *const dateComponent = [[NSDateComponents alloc] init];
     [dateComponent setDay:days];
-    NSCalendar *const calendar = [NSCalendar currentCalendar];
+    NSCalendar *const calendar = TCNCalendarContext.sharedContext.calendar;
     NSDate *const newDate = [calendar dateByAddingComponents:dateComponent toDate:date options:0];
     if (!newDate) {
         TCN_ASSERT_FAILURE(@"no new date found after adding days to the date");
@@ -39,7 +40,7 @@
 }
 
 + (nonnull NSDate *)dateByAddingWeeks:(NSInteger)weeks toDate:(nonnull NSDate *)date {
-    NSCalendar *const calendar = [NSCalendar currentCalendar];
+    NSCalendar *const calendar = TCNCalendarContext.sharedContext.calendar;
     NSDateComponents *const components = [[NSDateComponents alloc] init];
     components.weekOfYear = weeks;
     NSDate *const newDate = [calendar dateByAddingComponents:components toDate:date options:0];
@@ -51,7 +52,7 @@
 }
 
 + (nonnull NSDate *)middleOfWeekForDate:(nonnull NSDate *)date {
-    NSDate* newDate = [[NSCalendar currentCalendar] dateBySettingUnit:NSCalendarUnitWeekday value:4 ofDate:date options:0];
+    NSDate* newDate = [TCNCalendarContext.sharedContext.calendar dateBySettingUnit:NSCalendarUnitWeekday value:4 ofDate:date options:0];
     if (!newDate) {
         return [NSDate date];
     }
@@ -62,8 +63,8 @@
     NSDateComponents *components = [[NSDateComponents alloc] init];
     components.day = 1;
     components.second = -1;
-    NSCalendar *calendar = [NSCalendar currentCalendar];
-    NSDate *newDate = [calendar dateByAddingComponents:components toDate:[calendar startOfDayForDate:date] options:0];
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    NSDate *newDate = [context.calendar dateByAddingComponents:components toDate:[context startOfDayForDate:date] options:0];
     if (!newDate) {
         return [NSDate date];
     }
@@ -73,11 +74,12 @@
 #pragma mark - Date comparison
 
 + (BOOL)isDate:(nonnull NSDate *)date inSameDayAsDate:(nonnull NSDate *)otherDate {
-    return [[NSCalendar currentCalendar] isDate:date inSameDayAsDate:otherDate];
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    return [context dayMinuteForDate:date].day == [context dayMinuteForDate:otherDate].day;
 }
 
 + (BOOL)isDate:(nonnull NSDate *)date inSameWeekAsDate:(nonnull NSDate *)otherDate {
-    return [[NSCalendar currentCalendar] isDate:date equalToDate:otherDate toUnitGranularity:NSCalendarUnitWeekOfYear];
+    return [TCNCalendarContext.sharedContext.calendar isDate:date equalToDate:otherDate toUnitGranularity:NSCalendarUnitWeekOfYear];
 }
 
 + (BOOL)date:(nonnull NSDate *)date isAfterDate:(nonnull NSDate *)otherDate {
@@ -99,14 +101,14 @@
 #pragma mark - Other
 
 + (NSInteger)indexOfDateInWeek:(nonnull NSDate *)date {
-    NSCalendar *calendar = [NSCalendar currentCalendar];
+    NSCalendar *calendar = TCNCalendarContext.sharedContext.calendar;
     NSInteger weekdayToAdd = (NSInteger)calendar.firstWeekday - 1;
     return [calendar component:NSCalendarUnitWeekday fromDate:date] - 1 - weekdayToAdd;
 }
 
 + (nonnull NSArray<NSDate *> *)daysOfWeekFromDate:(nonnull NSDate *)date {
-    NSCalendar *const calendar = [NSCalendar currentCalendar];
-    [calendar setLocale:[NSLocale currentLocale]];
+    // The shared calendar is already in the current locale
+    NSCalendar *const calendar = TCNCalendarContext.sharedContext.calendar;
     NSDateComponents *const components = [calendar components:(NSCalendarUnitYear |
                                                                NSCalendarUnitMonth |
                                                                NSCalendarUnitWeekOfYear |
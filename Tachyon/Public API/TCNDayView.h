@@ -1,8 +1,10 @@
 #import <UIKit/UIKit.h>
 #import "TCNEvent.h"
 #import "TCNDayViewConfig.h"
+#import "TCNPassMetrics.h"
 
 @class TCNDayView;
+@class TCNEventSnapshot;
 
 #pragma mark - TCNDayViewDelegate
 
@@ -32,6 +34,63 @@
 @optional
 - (void)dayView:(nonnull TCNDayView *)dayView didCancelEvent:(nonnull TCNEvent *)event;
 
+/**
+ Called instead of @c dayView:didSelectAvailabilityWithEvent: when implemented, with the column that was tapped.
+ The event's times are on the date the data source returned for that column.
+
+ @param dayView The @c TCNDayView responding to this UI event.
+ @param event The new @c TCNEvent for the timeslot selected.
+ @param column The index of the tapped column.
+ */
+- (void)dayView:(nonnull TCNDayView *)dayView didSelectAvailabilityWithEvent:(nonnull TCNEvent *)event column:(NSInteger)column;
+
+/**
+ Called when a long press starts dragging @c event, if @c TCNDayViewConfig.editsEventsByDragging is set. Events are
+ dragged unless this returns NO, e.g. for events the user can't edit.
+
+ @param dayView The @c TCNDayView responding to this UI event.
+ @param event The event about to be dragged.
+ @return Whether the event can be dragged.
+ */
+- (BOOL)dayView:(nonnull TCNDayView *)dayView shouldDragEvent:(nonnull TCNEvent *)event;
+
+/**
+ Called when a drag of @c event ends at new times. The event is shown at its own times again until the data source
+ returns it with the new ones, e.g. through @c applySnapshot:.
+
+ @param dayView The @c TCNDayView responding to this UI event.
+ @param event The dragged event.
+ @param startDateTime The time the event was dragged to start at.
+ @param endDateTime The time the event was dragged to end at.
+ */
+- (void)dayView:(nonnull TCNDayView *)dayView
+   didDragEvent:(nonnull TCNEvent *)event
+toStartDateTime:(nonnull NSDate *)startDateTime
+    endDateTime:(nonnull NSDate *)endDateTime;
+
+@end
+
+#pragma mark - TCNDayViewMetricsDelegate
+
+/**
+ Classes implementing this protocol receive the measurements of the day view's hot paths, e.g. to report them to
+ telemetry.
+ */
+@protocol TCNDayViewMetricsDelegate <NSObject>
+
+/**
+ Called on the main thread after each pass through a hot path: every layout pass, overlap adjustment and visible element
+ query of the day view's layouts, every event cell configured, and every reload. The time to the day view's first frame,
+ from its initialization until its first layout in a window is committed, is reported once as a pass of its own.
+
+ Layout passes report the sections in range whose layout was kept as cache hits, cell configurations report whether the
+ event's display model was prepared ahead of time, and reloads whether the events were drawn from a layout snapshot.
+
+ @param dayView The measured @c TCNDayView.
+ @param metrics The measurements of the pass.
+ */
+- (void)dayView:(nonnull TCNDayView *)dayView didMeasurePass:(nonnull TCNPassMetrics *)metrics;
+
 @end
 
 #pragma mark - TCNDayViewDataSource
@@ -42,6 +101,9 @@
 
  The day view contains two separate sections for all day events and non-all day events. This is implemented as
  two separate @c UICollectionView instances.
+
+ The non-all day section may show several columns side by side, e.g. the days of a week or one column per resource,
+ by implementing the optional column methods. Each column is laid out only while it is on or next to the screen.
  */
 @protocol TCNDayViewDataSource <NSObject>
 
@@ -64,6 +126,37 @@
  */
 @property (nonatomic, strong, nonnull, readonly) NSArray<TCNEvent *> *allDayEvents;
 
+@optional
+
+/**
+ The number of columns of non-all day events. Defaults to 1.
+
+ The width of each column is set by @c TCNDayViewConfig.columnWidth.
+ */
+@property (nonatomic, assign, readonly) NSInteger numberOfColumns;
+
+/**
+ The date displayed in @c column. Defaults to @c currentDate.
+
+ @param column The index of the column.
+ */
+- (nonnull NSDate *)dateForColumn:(NSInteger)column;
+
+/**
+ The non-all day events displayed in @c column. Defaults to @c dayEvents.
+
+ @param column The index of the column.
+ */
+- (nonnull NSArray<TCNEvent *> *)dayEventsForColumn:(NSInteger)column;
+
+/**
+ A version of the events on the day of @c date that changes whenever they change, e.g. a counter incremented on every
+ change or a sync token. Required to save the day's layout with @c TCNDayViewConfig.layoutSnapshotDirectoryURL.
+
+ @param date A time on the day.
+ */
+- (uint64_t)dataVersionForDate:(nonnull NSDate *)date;
+
 @end
 
 #pragma mark - TCNDayView
@@ -84,11 +177,28 @@
  */
 @property (nonatomic, weak, nullable, readwrite) id<TCNDayViewDataSource> dataSource;
 
+/**
+ The snapshot applied with @c applySnapshot:, which the day view shows instead of the events of @c dataSource. While a
+ snapshot is applied, changes are made by applying another snapshot rather than by inserting or removing single events.
+ */
+@property (nonatomic, strong, nullable, readonly) TCNEventSnapshot *snapshot;
+
+/**
+ The day view's metrics delegate. The day view only measures its passes while this is set.
+ */
+@property (nonatomic, weak, nullable, readwrite) id<TCNDayViewMetricsDelegate> metricsDelegate;
+
 /**
  The default hour of the day view. Defaults to 8AM local time.
  */
 @property (nonatomic, assign, readwrite) NSInteger defaultHour;
 
+/**
+ The factor the height of an hour is scaled by, from the config's @c minimumTimeScale to its @c maximumTimeScale. Changed
+ by pinching if the config's @c zoomsWithPinch is set. Defaults to 1.
+ */
+@property (nonatomic, assign, readwrite) CGFloat timeScale;
+
 /**
  Initialize the day view with a frame and config. The config will be read during the initialization process.
 
@@ -110,4 +220,60 @@
 - (void)reloadAndResetScrolling:(BOOL)resetScrolling
 NS_SWIFT_NAME(reload(resetScrolling:));
 
+/**
+ Shows the events of @c snapshot instead of those of @c dataSource. Must be called on the main thread, but the snapshot
+ may be built on any queue.
+
+ If @c snapshot has the same dates as the snapshot shown, only the events whose @c TCNEvent.identifier was added or
+ removed, or whose content or order changed, are updated, in a single batch update without animation. Only the overlap
+ clusters they touch are laid out again. Otherwise, e.g. when the date changes, the day view is reloaded without
+ resetting scrolling.
+
+ @param snapshot The events to show, or @c nil to show the events of @c dataSource again.
+ */
+- (void)applySnapshot:(nullable TCNEventSnapshot *)snapshot
+NS_SWIFT_NAME(apply(_:));
+
+/**
+ Adds a single event to the day view without reloading it. Only the events overlapping the new event are laid out again.
+
+ This should be called after the data source has added the event, e.g. in response to
+ @c dayView:didSelectAvailabilityWithEvent:.
+
+ @param index The index of the new event in the data source's @c dayEvents, or @c allDayEvents if @c isAllDay is true.
+ @param isAllDay Whether the new event is an all-day event.
+ */
+- (void)insertEventAtIndex:(NSUInteger)index isAllDay:(BOOL)isAllDay
+NS_SWIFT_NAME(insertEvent(at:isAllDay:));
+
+/**
+ Removes a single event from the day view without reloading it. Only the events the removed event overlapped are laid
+ out again.
+
+ This should be called after the data source has removed the event, e.g. in response to @c dayView:didCancelEvent:.
+
+ @param index The index the removed event had in the data source's @c dayEvents, or @c allDayEvents if @c isAllDay is true.
+ @param isAllDay Whether the removed event is an all-day event.
+ */
+- (void)removeEventAtIndex:(NSUInteger)index isAllDay:(BOOL)isAllDay
+NS_SWIFT_NAME(removeEvent(at:isAllDay:));
+
+/**
+ Adds a single non-all day event to one column of the day view without reloading it.
+
+ @param index The index of the new event in the data source's @c dayEventsForColumn:.
+ @param column The index of the column.
+ */
+- (void)insertEventAtIndex:(NSUInteger)index column:(NSInteger)column
+NS_SWIFT_NAME(insertEvent(at:column:));
+
+/**
+ Removes a single non-all day event from one column of the day view without reloading it.
+
+ @param index The index the removed event had in the data source's @c dayEventsForColumn:.
+ @param column The index of the column.
+ */
+- (void)removeEventAtIndex:(NSUInteger)index column:(NSInteger)column
+NS_SWIFT_NAME(removeEvent(at:column:));
+
 @end
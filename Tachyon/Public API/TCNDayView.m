@@ -1,20 +1,86 @@
 #import "TCNAllDayViewLayout.h"
+#import "TCNAllDayOverflowView.h"
+#import "TCNCalendarContext.h"
 #import "TCNDateUtil.h"
 #import "TCNDayView.h"
 #import "TCNDayViewLayout.h"
+#import "TCNDayViewLayoutInvalidationContext.h"
+#import "TCNDayViewLayoutSnapshot.h"
+#import "TCNDayViewGridView.h"
 #import "TCNDayViewGridlineView.h"
 #import "TCNDayViewTimeView.h"
 #import "TCNMacros.h"
 #import "TCNEventCell.h"
+#import "TCNEventDiff.h"
+#import "TCNEventSnapshot.h"
+#import "TCNTrace.h"
 
-@interface TCNDayView ()<UICollectionViewDelegate, UICollectionViewDataSource, TCNDayViewLayoutDelegate>
+/**
+ How a drag changes the dragged event.
+ */
+typedef NS_ENUM(NSInteger, TCNDayViewDragMode) {
+
+    TCNDayViewDragModeMove,
+    TCNDayViewDragModeResizeStart,
+    TCNDayViewDragModeResizeEnd
+
+};
+
+@interface TCNDayView ()<UICollectionViewDelegate, UICollectionViewDataSource, UICollectionViewDataSourcePrefetching, TCNDayViewLayoutDelegate>
 
 @property (nonatomic, strong, nonnull, readonly) TCNDayViewLayout *collectionViewLayout;
-@property (nonatomic, strong, nonnull, readonly) TCNDayViewLayout *allDayCollectionViewLayout;
 @property (nonatomic, strong, nonnull, readonly) UICollectionView *collectionView;
-@property (nonatomic, strong, nonnull, readonly) UICollectionView *allDayCollectionView;
+
+/**
+ The all day collection view and its layout. If the config's @c createsAllDayViewLazily is set, these are nil until there
+ are all day events to show.
+ */
+@property (nonatomic, strong, nullable, readonly) TCNDayViewLayout *allDayCollectionViewLayout;
+@property (nonatomic, strong, nullable, readonly) UICollectionView *allDayCollectionView;
 @property (nonatomic, strong, nonnull, readonly) TCNDayViewConfig *config;
 @property (nonatomic, strong, nonnull, readonly) UITapGestureRecognizer *tapGestureRecognizer;
+@property (nonatomic, strong, nullable, readonly) UIPinchGestureRecognizer *pinchGestureRecognizer;
+
+/**
+ The time scale when the current pinch began.
+ */
+@property (nonatomic, assign, readwrite) CGFloat pinchStartTimeScale;
+
+@property (nonatomic, strong, nullable, readonly) UILongPressGestureRecognizer *longPressGestureRecognizer;
+
+/**
+ The event being dragged and its item, or nil if there is no drag.
+ */
+@property (nonatomic, strong, nullable, readwrite) TCNEvent *draggedEvent;
+@property (nonatomic, strong, nullable, readwrite) NSIndexPath *draggedIndexPath;
+
+/**
+ How the drag changes the event, the event's own times and the minute under the touch when the drag began, and the
+ times the event is currently shown at, all in minutes of the day.
+ */
+@property (nonatomic, assign, readwrite) TCNDayViewDragMode dragMode;
+@property (nonatomic, assign, readwrite) NSInteger dragOriginalStartMinute;
+@property (nonatomic, assign, readwrite) NSInteger dragOriginalEndMinute;
+@property (nonatomic, assign, readwrite) NSInteger dragTouchMinute;
+@property (nonatomic, assign, readwrite) NSInteger draggedStartMinute;
+@property (nonatomic, assign, readwrite) NSInteger draggedEndMinute;
+
+/**
+ The display model of each event shown since the last reload, built ahead of time by prefetching or on first display.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSMapTable<TCNEvent *, TCNEventDisplayModel *> *displayModels;
+
+/**
+ The queue display models are prefetched on, and the prefetches in flight by index path.
+ */
+@property (nonatomic, strong, nonnull, readonly) NSOperationQueue *displayModelQueue;
+@property (nonatomic, strong, nonnull, readonly) NSMutableDictionary<NSIndexPath *, NSOperation *> *displayModelOperations;
+
+/**
+ The interval from initialization to the first frame, and whether the end of the first frame is already being waited for.
+ */
+@property (nonatomic, assign, readonly) TCNTraceInterval firstFrameTraceInterval;
+@property (nonatomic, assign, readwrite) BOOL waitsForFirstFrame;
 
 @end
 
@@ -23,6 +89,14 @@
 #pragma mark - Static
 
 static const NSInteger DefaultHour = 8;
+static const NSInteger MinutesInDay = 24 * 60;
+static const NSInteger DragMinuteInterval = 15;
+static const CGFloat DragHandleHeight = 12.0f;
+// Core Animation commits each run loop pass's changes in a before-waiting observer of order 2000000
+static const CFIndex AfterCommitObserverOrder = 2000001;
+static const CGFloat PrewarmedViewHeight = 44.0f;
+// The width of the layout's time column
+static const CGFloat PrewarmedTimeViewWidth = 56.0f;
 
 #pragma mark - Initialization
 
@@ -36,26 +110,83 @@ static const NSInteger DefaultHour = 8;
         return nil;
     }
 
+    _firstFrameTraceInterval = TCNTraceBegin(TCNTraceNameFirstFrame);
     _defaultHour = DefaultHour;
     _config = config;
     _collectionViewLayout = [TCNDayView collectionViewLayoutWithConfig:config isAllDay:NO];
-    _allDayCollectionViewLayout = [TCNDayView collectionViewLayoutWithConfig:config isAllDay:YES];
     _collectionView = [TCNDayView collectionViewWithConfig:config collectionViewLayout:_collectionViewLayout superview:self isAllDay:NO];
-    _allDayCollectionView = [TCNDayView collectionViewWithConfig:config collectionViewLayout:_allDayCollectionViewLayout superview:self isAllDay:YES];
+    if (!config.createsAllDayViewLazily) {
+        [self loadAllDayCollectionView];
+    }
     _tapGestureRecognizer = [[UITapGestureRecognizer alloc] initWithTarget:self action:@selector(dayViewTapped:)];
     [_collectionView addGestureRecognizer:_tapGestureRecognizer];
+    if (config.zoomsWithPinch) {
+        _pinchGestureRecognizer = [[UIPinchGestureRecognizer alloc] initWithTarget:self action:@selector(dayViewPinched:)];
+        [_collectionView addGestureRecognizer:_pinchGestureRecognizer];
+    }
+    _pinchStartTimeScale = 1;
+    if (config.editsEventsByDragging) {
+        _longPressGestureRecognizer = [[UILongPressGestureRecognizer alloc] initWithTarget:self action:@selector(dayViewLongPressed:)];
+        [_collectionView addGestureRecognizer:_longPressGestureRecognizer];
+    }
+    _displayModels = [NSMapTable weakToStrongObjectsMapTable];
+    _displayModelQueue = [[NSOperationQueue alloc] init];
+    _displayModelQueue.name = @"com.linkedin.tachyon.event-display-models";
+    _displayModelQueue.qualityOfService = NSQualityOfServiceUserInitiated;
+    _displayModelOperations = [[NSMutableDictionary alloc] init];
 
     return self;
 }
 
+/**
+ Creates the all day collection view, unless it was already created.
+ */
+- (void)loadAllDayCollectionView {
+    if (self.allDayCollectionView) {
+        return;
+    }
+
+    TCNDayViewLayout *const collectionViewLayout = [TCNDayView collectionViewLayoutWithConfig:self.config isAllDay:YES];
+    collectionViewLayout.measuresPasses = self.metricsDelegate != nil;
+    UICollectionView *const collectionView = [TCNDayView collectionViewWithConfig:self.config
+                                                             collectionViewLayout:collectionViewLayout
+                                                                        superview:self
+                                                                         isAllDay:YES];
+    // A lazily created all day view is created after willMoveToSuperview: set the other delegates
+    if (self.collectionView.dataSource) {
+        collectionViewLayout.delegate = self;
+        collectionView.dataSource = self;
+        collectionView.delegate = self;
+    }
+    _allDayCollectionViewLayout = collectionViewLayout;
+    _allDayCollectionView = collectionView;
+}
+
+/**
+ Creates the all day collection view if it is created lazily and there are now all day events to show.
+ */
+- (void)loadAllDayCollectionViewIfNeeded {
+    if (!self.allDayCollectionView && self.allDayEvents.count > 0) {
+        [self loadAllDayCollectionView];
+    }
+}
+
 #pragma mark - Class helpers
 
 + (nonnull TCNDayViewLayout *)collectionViewLayoutWithConfig:(nonnull TCNDayViewConfig *)config isAllDay:(BOOL)isAllDay {
     TCNDayViewLayout *const collectionViewLayout = isAllDay
         ? [[TCNAllDayViewLayout alloc] initWithConfig:config]
         : [[TCNDayViewLayout alloc] initWithConfig:config];
+    if (isAllDay) {
+        TCN_CAST_OR_NIL(collectionViewLayout, TCNAllDayViewLayout).maximumRowCount = config.maximumAllDayRowCount;
+    } else {
+        // All day events span every column, so only the non-all day view is split into columns
+        collectionViewLayout.columnWidth = config.columnWidth;
+        collectionViewLayout.rendersStaticGrid = config.rendersStaticGrid;
+    }
     [collectionViewLayout registerClass:TCNDayViewGridlineView.class forDecorationViewOfKind:TCNDayViewGridlineView.darkKind];
     [collectionViewLayout registerClass:TCNDayViewGridlineView.class forDecorationViewOfKind:TCNDayViewGridlineView.lightKind];
+    [collectionViewLayout registerClass:TCNDayViewGridView.class forDecorationViewOfKind:TCNDayViewGridView.kind];
     return collectionViewLayout;
 }
 
@@ -77,6 +208,9 @@ static const NSInteger DefaultHour = 8;
     [superview addSubview:collectionView];
 
     if (isAllDay) {
+        [collectionView registerClass:TCNAllDayOverflowView.class
+           forSupplementaryViewOfKind:TCNAllDayOverflowView.kind
+                  withReuseIdentifier:TCNAllDayOverflowView.reuseIdentifier];
         if (config.allDayViewBackgroundProvider) {
             collectionView.backgroundView = config.allDayViewBackgroundProvider();
         }
@@ -104,8 +238,7 @@ static const NSInteger DefaultHour = 8;
  @param length The length of the event to be created, in minutes.
  */
 + (nonnull TCNEvent *)calendarEventWithSelectedDate:(nonnull NSDate *)date eventName:(nonnull NSString *)name eventLength:(TCNEventLength)length {
-    NSDateComponents *const components = [[NSCalendar currentCalendar] componentsInTimeZone:[NSTimeZone localTimeZone] fromDate:date];
-    const NSInteger secondsInSelectedTime = (components.hour * 3600) + (components.minute * 60);
+    const NSInteger secondsInSelectedTime = [TCNCalendarContext.sharedContext minuteOfDayForDate:date] * 60;
 
     const NSInteger secondsPerChunk = ((NSInteger)length) * 60;
     const double chunks = secondsInSelectedTime / secondsPerChunk;
@@ -116,10 +249,10 @@ static const NSInteger DefaultHour = 8;
                                                atHour:newHour
                                             andMinute:newMinute];
 
-    NSDate *const endDate = [[NSCalendar currentCalendar] dateByAddingUnit:NSCalendarUnitMinute
-                                                                     value:length
-                                                                    toDate:newDate
-                                                                   options:0];
+    NSDate *const endDate = [TCNCalendarContext.sharedContext.calendar dateByAddingUnit:NSCalendarUnitMinute
+                                                                                  value:length
+                                                                                 toDate:newDate
+                                                                                options:0];
     TCNEvent *const event = [[TCNEvent alloc] initWithName:name
                                              startDateTime:newDate
                                                endDateTime:endDate
@@ -130,22 +263,87 @@ static const NSInteger DefaultHour = 8;
     return event;
 }
 
+/**
+ The start time to display for @c event on the day view's day. See @c collectionView:layout:startTimeForItemAtIndexPath:.
+ */
++ (nonnull NSDate *)displayedStartTimeForEvent:(nonnull TCNEvent *)event
+                                   currentDate:(nonnull NSDate *)currentDate
+                                    startOfDay:(nonnull NSDate *)startOfThisDay {
+    if (![event occursOnDay:currentDate]) {
+        return startOfThisDay;
+    } else if (event.isAllDay) {
+        return startOfThisDay;
+    } else {
+        return [TCNDateUtil latestDate:event.startDateTime otherDate:startOfThisDay];
+    }
+}
+
+/**
+ The end time to display for @c event on the day view's day. See @c collectionView:layout:endTimeForItemAtIndexPath:.
+ */
++ (nonnull NSDate *)displayedEndTimeForEvent:(nonnull TCNEvent *)event
+                                 currentDate:(nonnull NSDate *)currentDate
+                                  startOfDay:(nonnull NSDate *)startOfThisDay
+                                    endOfDay:(nonnull NSDate *)endOfThisDay {
+    if (![event occursOnDay:currentDate]) {
+        return startOfThisDay;
+    } else if (event.isAllDay) {
+        return startOfThisDay;
+    } else {
+        return [TCNDateUtil earliestDate:event.endDateTime otherDate:endOfThisDay];
+    }
+}
+
 #pragma mark - Methods
 
+- (void)setMetricsDelegate:(nullable id<TCNDayViewMetricsDelegate>)metricsDelegate {
+    _metricsDelegate = metricsDelegate;
+    self.collectionViewLayout.measuresPasses = metricsDelegate != nil;
+    self.allDayCollectionViewLayout.measuresPasses = metricsDelegate != nil;
+}
+
+- (CGFloat)timeScale {
+    return self.collectionViewLayout.timeScale;
+}
+
+- (void)setTimeScale:(CGFloat)timeScale {
+    self.collectionViewLayout.timeScale = timeScale;
+}
+
 - (void)reloadAndResetScrolling:(BOOL)resetScrolling {
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameReload);
+
+    // The config may have changed along with the events, so nothing prepared for the previous data is reused
+    [self discardDisplayModels];
+    [self prepareVisibleCalendarDays];
     [self.collectionView reloadData];
+    [self loadAllDayCollectionViewIfNeeded];
     [self.allDayCollectionView reloadData];
+    const BOOL drawsEventsFromSnapshot = [self prepareEventLayoutFromSnapshot];
+    if (self.config.layoutsEventsInBackground && !drawsEventsFromSnapshot) {
+        // Also cancels the layout of a previous date that is still in flight
+        [self.collectionViewLayout prepareEventLayoutInBackgroundWithCompletion:nil];
+    }
+    [self prepareVisibleEventCellText];
     [self setNeedsLayout];
 
-    if (!resetScrolling) {
-        return;
+    if (resetScrolling) {
+        [self scrollToDefaultHour];
     }
 
+    [self finishPass:traceInterval
+        elementCount:[self numberOfEventsNearVisibleArea]
+       cacheHitCount:drawsEventsFromSnapshot ? 1 : 0
+    cacheLookupCount:self.config.layoutSnapshotDirectoryURL ? 1 : 0];
+}
+
+- (void)scrollToDefaultHour {
     // We are able to scroll without forcing a layout because the UICollectionView will calculate indexes and offsets before
     // returning from reloadData.
     NSIndexPath *const indexPathForDefaultHour = [NSIndexPath indexPathForRow:self.defaultHour inSection:0];
-    const CGFloat yOffsetForDefaultHour = [TCNDayViewLayout offsetForIndexPath:indexPathForDefaultHour
-                                                                          minY:TCNDayViewLayout.topInsetMargin];
+    const CGFloat unscaledYOffsetForDefaultHour = [TCNDayViewLayout offsetForIndexPath:indexPathForDefaultHour
+                                                                                  minY:TCNDayViewLayout.topInsetMargin];
+    const CGFloat yOffsetForDefaultHour = [self.collectionViewLayout yOffsetForUnscaledYOffset:unscaledYOffsetForDefaultHour];
     // The offset to scroll to is calculated as the hour offset + the collection view's height - the default top inset, so that the
     // hour is displayed at the top of the screen.
     const CGFloat yOffsetToScrollTo = yOffsetForDefaultHour + self.collectionView.frame.size.height - TCNDayViewLayout.topInsetMargin;
@@ -153,29 +351,683 @@ static const NSInteger DefaultHour = 8;
     [self.collectionView scrollRectToVisible:CGRectMake(0, yOffsetToScrollTo, 1, 1) animated:NO];
 }
 
+/**
+ Draws the events of a single column from the layout snapshot saved for its day, and saves a new snapshot if the events
+ no longer match it once they are laid out again in the background.
+
+ @return YES if the events are drawn from a saved snapshot, in which case they are already laid out in the background.
+ */
+- (BOOL)prepareEventLayoutFromSnapshot {
+    NSURL *const directoryURL = self.config.layoutSnapshotDirectoryURL;
+    id<TCNDayViewDataSource> const dataSource = [self eventSource];
+    NSDate *const date = [self dateForColumn:0];
+    if (!directoryURL || !date || [self numberOfColumns] != 1 || ![dataSource respondsToSelector:@selector(dataVersionForDate:)]) {
+        return NO;
+    }
+
+    const uint64_t dataVersion = [dataSource dataVersionForDate:TCN_FORCE_UNWRAP(date)];
+    const TCNLayoutSnapshotKey key = [self.collectionViewLayout layoutSnapshotKeyForDate:TCN_FORCE_UNWRAP(date) dataVersion:dataVersion];
+    NSString *const fileName = [NSString stringWithFormat:@"TCNDayViewLayout-%lld.snapshot", (long long)key.day];
+    NSURL *const fileURL = [TCN_FORCE_UNWRAP(directoryURL) URLByAppendingPathComponent:fileName isDirectory:NO];
+
+    TCNDayViewLayoutSnapshot *const snapshot = [TCNDayViewLayoutSnapshot snapshotWithContentsOfURL:fileURL];
+    [self.collectionViewLayout prepareEventLayoutInSection:0
+                                              fromSnapshot:snapshot
+                                                       key:key
+                                                completion:^(TCNDayViewLayoutSnapshot *_Nullable currentSnapshot, BOOL snapshotWasCurrent) {
+        if (!currentSnapshot || snapshotWasCurrent) {
+            return;
+        }
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+            [currentSnapshot writeToURL:fileURL error:NULL];
+        });
+    }];
+    return [snapshot hasKey:key];
+}
+
+/**
+ Measures the titles of the events in the columns on or next to the screen in the background, so their cells don't
+ measure text on the main thread when they are first laid out.
+ */
+- (void)prepareVisibleEventCellText {
+    const CGFloat cellWidth = self.collectionViewLayout.fullEventItemWidth;
+    if (cellWidth <= 0) {
+        return;
+    }
+
+    const NSRange columns = [self columnsNearVisibleArea];
+    for (NSUInteger column = columns.location; column < NSMaxRange(columns); column++) {
+        [TCNEventCell prepareTextMeasurementsForEvents:[self dayEventsForColumn:(NSInteger)column] cellWidth:cellWidth config:self.config];
+    }
+}
+
+/**
+ Prepares the shared calendar context for the dates of the columns on or next to the screen, so that their events'
+ times are converted without calendar calculations.
+ */
+- (void)prepareVisibleCalendarDays {
+    NSDate *firstDate = nil;
+    NSDate *lastDate = nil;
+    const NSRange columns = [self columnsNearVisibleArea];
+    for (NSUInteger column = columns.location; column < NSMaxRange(columns); column++) {
+        NSDate *const date = [self dateForColumn:(NSInteger)column];
+        if (!date) {
+            continue;
+        }
+        firstDate = firstDate ? [TCNDateUtil earliestDate:TCN_FORCE_UNWRAP(firstDate) otherDate:TCN_FORCE_UNWRAP(date)] : date;
+        lastDate = lastDate ? [TCNDateUtil latestDate:TCN_FORCE_UNWRAP(lastDate) otherDate:TCN_FORCE_UNWRAP(date)] : date;
+    }
+    if (firstDate && lastDate) {
+        [TCNCalendarContext.sharedContext prepareDaysFromDate:TCN_FORCE_UNWRAP(firstDate) toDate:TCN_FORCE_UNWRAP(lastDate)];
+    }
+}
+
+/**
+ The columns in or next to the visible area, or only the first column before the day view has a width.
+ */
+- (NSRange)columnsNearVisibleArea {
+    const NSInteger numberOfColumns = [self numberOfColumns];
+    const CGFloat columnWidth = self.config.columnWidth > 0 ? self.config.columnWidth : CGRectGetWidth(self.collectionView.bounds);
+    if (numberOfColumns <= 0) {
+        return NSMakeRange(0, 0);
+    }
+    if (columnWidth <= 0) {
+        return NSMakeRange(0, 1);
+    }
+    const NSInteger firstColumn = MAX(0, (NSInteger)floor(CGRectGetMinX(self.collectionView.bounds) / columnWidth) - 1);
+    const NSInteger lastColumn = MIN(numberOfColumns - 1, (NSInteger)floor(CGRectGetMaxX(self.collectionView.bounds) / columnWidth) + 1);
+    if (lastColumn < firstColumn) {
+        return NSMakeRange(0, 0);
+    }
+    return NSMakeRange((NSUInteger)firstColumn, (NSUInteger)(lastColumn - firstColumn + 1));
+}
+
+- (void)insertEventAtIndex:(NSUInteger)index isAllDay:(BOOL)isAllDay {
+    [self updateEventAtIndex:index column:0 isAllDay:isAllDay isInsertion:YES];
+}
+
+- (void)removeEventAtIndex:(NSUInteger)index isAllDay:(BOOL)isAllDay {
+    [self updateEventAtIndex:index column:0 isAllDay:isAllDay isInsertion:NO];
+}
+
+- (void)insertEventAtIndex:(NSUInteger)index column:(NSInteger)column {
+    [self updateEventAtIndex:index column:column isAllDay:NO isInsertion:YES];
+}
+
+- (void)removeEventAtIndex:(NSUInteger)index column:(NSInteger)column {
+    [self updateEventAtIndex:index column:column isAllDay:NO isInsertion:NO];
+}
+
+- (void)updateEventAtIndex:(NSUInteger)index column:(NSInteger)column isAllDay:(BOOL)isAllDay isInsertion:(BOOL)isInsertion {
+    if (isAllDay && !self.allDayCollectionView) {
+        // A new all day view reads every event when it is first laid out, so there is nothing to update
+        [self loadAllDayCollectionViewIfNeeded];
+        [self setNeedsLayout];
+        return;
+    }
+
+    UICollectionView *const collectionView = isAllDay ? self.allDayCollectionView : self.collectionView;
+    TCNDayViewLayout *const collectionViewLayout = isAllDay ? self.allDayCollectionViewLayout : self.collectionViewLayout;
+    NSArray<NSIndexPath *> *const indexPaths = @[[NSIndexPath indexPathForItem:(NSInteger)index inSection:column]];
+
+    // Like reloadAndResetScrolling:, the update is applied without animation
+    [UIView performWithoutAnimation:^{
+        [collectionView performBatchUpdates:^{
+            TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+            if (isInsertion) {
+                [context invalidateInsertedEventsAtIndexPaths:indexPaths];
+                [collectionView insertItemsAtIndexPaths:indexPaths];
+            } else {
+                [context invalidateDeletedEventsAtIndexPaths:indexPaths];
+                [collectionView deleteItemsAtIndexPaths:indexPaths];
+            }
+            [collectionViewLayout invalidateLayoutWithContext:context];
+        } completion:nil];
+    }];
+
+    if (isAllDay) {
+        // The all day view's height depends on its number of events
+        [self setNeedsLayout];
+    }
+}
+
+/**
+ The number of all-day events and events in the columns on or next to the screen, which are the ones laid out.
+ */
+- (NSInteger)numberOfEventsNearVisibleArea {
+    NSInteger eventCount = (NSInteger)[self allDayEvents].count;
+    const NSRange columns = [self columnsNearVisibleArea];
+    for (NSUInteger column = columns.location; column < NSMaxRange(columns); column++) {
+        eventCount += (NSInteger)[self dayEventsForColumn:(NSInteger)column].count;
+    }
+    return eventCount;
+}
+
+/**
+ The applied snapshot, or the data source if there is none.
+ */
+- (nullable id<TCNDayViewDataSource>)eventSource {
+    return self.snapshot ?: self.dataSource;
+}
+
 - (nonnull NSArray<TCNEvent *> *)dayEvents {
-    return self.dataSource.dayEvents ?: @[];
+    return [self eventSource].dayEvents ?: @[];
 }
 
 - (nonnull NSArray<TCNEvent *> *)allDayEvents {
-    return self.dataSource.allDayEvents ?: @[];
+    return [self eventSource].allDayEvents ?: @[];
+}
+
+- (NSInteger)numberOfColumns {
+    id<TCNDayViewDataSource> const dataSource = [self eventSource];
+    if (![dataSource respondsToSelector:@selector(numberOfColumns)]) {
+        return 1;
+    }
+    return MAX(0, dataSource.numberOfColumns);
+}
+
+- (nullable NSDate *)dateForColumn:(NSInteger)column {
+    id<TCNDayViewDataSource> const dataSource = [self eventSource];
+    if (![dataSource respondsToSelector:@selector(dateForColumn:)]) {
+        return dataSource.currentDate;
+    }
+    return [dataSource dateForColumn:column];
+}
+
+- (nonnull NSArray<TCNEvent *> *)dayEventsForColumn:(NSInteger)column {
+    id<TCNDayViewDataSource> const dataSource = [self eventSource];
+    if (![dataSource respondsToSelector:@selector(dayEventsForColumn:)]) {
+        return self.dayEvents;
+    }
+    return [dataSource dayEventsForColumn:column] ?: @[];
+}
+
+/**
+ The events displayed in @c section of @c collectionView. Each section of the non-all day collection view is a column.
+ */
+- (nonnull NSArray<TCNEvent *> *)eventsForCollectionView:(nonnull UICollectionView *)collectionView section:(NSInteger)section {
+    return collectionView == self.collectionView ? [self dayEventsForColumn:section] : self.allDayEvents;
+}
+
+/**
+ The date displayed in @c section of @c collectionView. The all day collection view always displays @c currentDate.
+ */
+- (nullable NSDate *)dateForCollectionView:(nonnull UICollectionView *)collectionView section:(NSInteger)section {
+    return collectionView == self.collectionView ? [self dateForColumn:section] : [self eventSource].currentDate;
 }
 
 - (void)dayViewTapped:(nonnull UITapGestureRecognizer *)recognizer {
-    NSDate *const currentDate = self.dataSource.currentDate;
-    if (!currentDate) {
+    NSInteger column = 0;
+    [self selectAvailabilityAtLocation:[recognizer locationInView:self.collectionView] column:&column];
+}
+
+/**
+ Creates a selected event in the time slot at @c location and passes it to the delegate.
+
+ @param location A point in the collection view.
+ @param column Set to the column of the time slot.
+ @return The created event, or nil if there is no time slot at @c location.
+ */
+- (nullable TCNEvent *)selectAvailabilityAtLocation:(CGPoint)location column:(nonnull NSInteger *)column {
+    const CGFloat columnWidth = self.config.columnWidth > 0 ? self.config.columnWidth : CGRectGetWidth(self.collectionView.bounds);
+    const NSInteger numberOfColumns = [self.collectionView numberOfSections];
+    if (columnWidth <= 0 || numberOfColumns <= 0) {
+        return nil;
+    }
+    *column = MIN(MAX(0, (NSInteger)floor(location.x / columnWidth)), numberOfColumns - 1);
+
+    NSDate *const columnDate = [self dateForColumn:*column];
+    if (!columnDate) {
+        return nil;
+    }
+    const NSInteger tappedMinute = [self minuteOfDayAtYOffset:location.y];
+    NSDate *const selectedDate = [TCNDateUtil dateWithDate:TCN_FORCE_UNWRAP(columnDate)
+                                                    atHour:tappedMinute / 60
+                                                 andMinute:tappedMinute % 60];
+
+    TCNEvent *const event = [TCNDayView calendarEventWithSelectedDate:selectedDate
+                                                            eventName:self.config.createdEventText
+                                                          eventLength:self.config.defaultEventLength];
+    id<TCNDayViewDelegate> const delegate = self.delegate;
+    if ([delegate respondsToSelector:@selector(dayView:didSelectAvailabilityWithEvent:column:)]) {
+        [delegate dayView:self didSelectAvailabilityWithEvent:event column:*column];
+    } else {
+        [delegate dayView:self didSelectAvailabilityWithEvent:event];
+    }
+    return event;
+}
+
+/**
+ The minute of the day at @c yOffset in the collection view, at the current time scale.
+ */
+- (NSInteger)minuteOfDayAtYOffset:(CGFloat)yOffset {
+    return [TCNCalendarContext.sharedContext minuteOfDayForDate:[TCNDayViewLayout timeForYOffset:[self.collectionViewLayout unscaledYOffsetForYOffset:yOffset]]];
+}
+
+- (void)dayViewPinched:(nonnull UIPinchGestureRecognizer *)recognizer {
+    if (recognizer.state == UIGestureRecognizerStateBegan) {
+        self.pinchStartTimeScale = self.collectionViewLayout.timeScale;
+    }
+    if (recognizer.state != UIGestureRecognizerStateBegan && recognizer.state != UIGestureRecognizerStateChanged) {
         return;
     }
+
+    // The time under the pinch stays under it, so the content offset moves by as much as that time does
+    const CGFloat focusY = [recognizer locationInView:self.collectionView].y;
+    const CGFloat unscaledFocusY = [self.collectionViewLayout unscaledYOffsetForYOffset:focusY];
+    self.collectionViewLayout.timeScale = self.pinchStartTimeScale * recognizer.scale;
+    const CGFloat scaledFocusY = [self.collectionViewLayout yOffsetForUnscaledYOffset:unscaledFocusY];
+
+    const CGFloat maximumOffsetY = MAX(0, self.collectionViewLayout.collectionViewContentSize.height - CGRectGetHeight(self.collectionView.bounds));
+    const CGFloat offsetY = MIN(MAX(0, self.collectionView.contentOffset.y + scaledFocusY - focusY), maximumOffsetY);
+    self.collectionView.contentOffset = CGPointMake(self.collectionView.contentOffset.x, offsetY);
+}
+
+#pragma mark - Dragging
+
+- (void)dayViewLongPressed:(nonnull UILongPressGestureRecognizer *)recognizer {
     const CGPoint location = [recognizer locationInView:self.collectionView];
-    NSDateComponents *const tappedComponents = [[NSCalendar currentCalendar] componentsInTimeZone:[NSTimeZone localTimeZone]
-                                                                                         fromDate:[TCNDayViewLayout timeForYOffset:location.y]];
-    NSDate *const selectedDate = [TCNDateUtil dateWithDate:TCN_FORCE_UNWRAP(currentDate)
-                                                    atHour:tappedComponents.hour
-                                                 andMinute:tappedComponents.minute];
+    switch (recognizer.state) {
+        case UIGestureRecognizerStateBegan:
+            [self beginDragAtLocation:location];
+            break;
+        case UIGestureRecognizerStateChanged:
+            [self continueDragAtLocation:location];
+            break;
+        case UIGestureRecognizerStateEnded:
+            [self endDragAndCommit:YES];
+            break;
+        default:
+            [self endDragAndCommit:NO];
+            break;
+    }
+}
 
-    [self.delegate dayView:self didSelectAvailabilityWithEvent:[TCNDayView calendarEventWithSelectedDate:selectedDate
-                                                                                               eventName:self.config.createdEventText
-                                                                                             eventLength:self.config.defaultEventLength]];
+/**
+ Starts dragging the event at @c location, or creates an event there and starts dragging its end time. The edges of an
+ event change its start or end time, and the rest of it moves it.
+ */
+- (void)beginDragAtLocation:(CGPoint)location {
+    id<TCNDayViewDelegate> const delegate = self.delegate;
+    if (![delegate respondsToSelector:@selector(dayView:didDragEvent:toStartDateTime:endDateTime:)]) {
+        return;
+    }
+
+    NSIndexPath *indexPath = [self.collectionViewLayout indexPathForEventItemAtPoint:location];
+    TCNDayViewDragMode dragMode = TCNDayViewDragModeMove;
+    if (indexPath) {
+        const CGRect frame = [self.collectionViewLayout layoutAttributesForItemAtIndexPath:TCN_FORCE_UNWRAP(indexPath)].frame;
+        if (CGRectGetHeight(frame) > 3 * DragHandleHeight && location.y < CGRectGetMinY(frame) + DragHandleHeight) {
+            dragMode = TCNDayViewDragModeResizeStart;
+        } else if (location.y > CGRectGetMaxY(frame) - DragHandleHeight) {
+            dragMode = TCNDayViewDragModeResizeEnd;
+        }
+    } else {
+        NSInteger column = 0;
+        TCNEvent *const createdEvent = [self selectAvailabilityAtLocation:location column:&column];
+        if (!createdEvent) {
+            return;
+        }
+
+        // The event can only be dragged once the delegate has added it to the events shown
+        [self.collectionView layoutIfNeeded];
+        NSString *const identifier = TCN_FORCE_UNWRAP(createdEvent).identifier;
+        const NSUInteger index = [[self dayEventsForColumn:column] indexOfObjectPassingTest:^BOOL(TCNEvent *event, __unused NSUInteger idx, __unused BOOL *stop) {
+            return [event.identifier isEqualToString:identifier];
+        }];
+        if (index == NSNotFound) {
+            return;
+        }
+        indexPath = [NSIndexPath indexPathForItem:(NSInteger)index inSection:column];
+        dragMode = TCNDayViewDragModeResizeEnd;
+    }
+
+    NSIndexPath *const draggedIndexPath = TCN_FORCE_UNWRAP(indexPath);
+    TCNEvent *const event = [self eventForIndexPath:draggedIndexPath collectionView:self.collectionView];
+    if (!event) {
+        return;
+    }
+    if ([delegate respondsToSelector:@selector(dayView:shouldDragEvent:)] && ![delegate dayView:self shouldDragEvent:TCN_FORCE_UNWRAP(event)]) {
+        return;
+    }
+
+    // The event is dragged from the times it is shown at, which the layout read the same way
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    const NSInteger startMinute = [calendarContext minuteOfDayForDate:[self collectionView:self.collectionView
+                                                                                    layout:self.collectionViewLayout
+                                                                   startTimeForItemAtIndexPath:draggedIndexPath]];
+    const NSInteger endMinute = [calendarContext minuteOfDayForDate:[self collectionView:self.collectionView
+                                                                                  layout:self.collectionViewLayout
+                                                                 endTimeForItemAtIndexPath:draggedIndexPath]];
+    self.draggedEvent = event;
+    self.draggedIndexPath = draggedIndexPath;
+    self.dragMode = dragMode;
+    self.dragOriginalStartMinute = startMinute;
+    self.dragOriginalEndMinute = MAX(startMinute, endMinute);
+    self.dragTouchMinute = [self minuteOfDayAtYOffset:location.y];
+    self.draggedStartMinute = self.dragOriginalStartMinute;
+    self.draggedEndMinute = self.dragOriginalEndMinute;
+}
+
+/**
+ Shows the dragged event at the times under @c location, in steps of @c DragMinuteInterval. The layout is only asked to
+ move it when those times change.
+ */
+- (void)continueDragAtLocation:(CGPoint)location {
+    NSIndexPath *const indexPath = self.draggedIndexPath;
+    if (!indexPath) {
+        return;
+    }
+
+    // The end of the day is the last point that has a minute of that day
+    const CGFloat maximumYOffset = self.collectionViewLayout.collectionViewContentSize.height - TCNDayViewLayout.topInsetMargin - 1;
+    const NSInteger touchMinute = [self minuteOfDayAtYOffset:MIN(MAX(location.y, TCNDayViewLayout.topInsetMargin), maximumYOffset)];
+    const NSInteger originalStartMinute = self.dragOriginalStartMinute;
+    const NSInteger originalEndMinute = self.dragOriginalEndMinute;
+    NSInteger startMinute = originalStartMinute;
+    NSInteger endMinute = originalEndMinute;
+    switch (self.dragMode) {
+        case TCNDayViewDragModeMove: {
+            const NSInteger length = originalEndMinute - originalStartMinute;
+            const NSInteger offset = [TCNDayView minuteRoundedToDragInterval:touchMinute - self.dragTouchMinute];
+            startMinute = MIN(MAX(0, originalStartMinute + offset), MinutesInDay - length);
+            endMinute = startMinute + length;
+            break;
+        }
+        case TCNDayViewDragModeResizeStart:
+            startMinute = MAX(0, MIN([TCNDayView minuteRoundedToDragInterval:touchMinute], originalEndMinute - DragMinuteInterval));
+            break;
+        case TCNDayViewDragModeResizeEnd:
+            endMinute = MIN(MinutesInDay, MAX([TCNDayView minuteRoundedToDragInterval:touchMinute], originalStartMinute + DragMinuteInterval));
+            break;
+    }
+
+    if (startMinute == self.draggedStartMinute && endMinute == self.draggedEndMinute) {
+        return;
+    }
+    self.draggedStartMinute = startMinute;
+    self.draggedEndMinute = endMinute;
+    [self.collectionViewLayout dragEventItemAtIndexPath:TCN_FORCE_UNWRAP(indexPath) toStartMinute:startMinute endMinute:endMinute];
+}
+
+/**
+ Shows the dragged event at its own times again, and passes the times it was dragged to to the delegate if @c commit
+ is set and they changed.
+ */
+- (void)endDragAndCommit:(BOOL)commit {
+    TCNEvent *const event = self.draggedEvent;
+    NSIndexPath *const indexPath = self.draggedIndexPath;
+    self.draggedEvent = nil;
+    self.draggedIndexPath = nil;
+    if (!event || !indexPath) {
+        return;
+    }
+    [self.collectionViewLayout endEventItemDrag];
+
+    if (!commit || (self.draggedStartMinute == self.dragOriginalStartMinute && self.draggedEndMinute == self.dragOriginalEndMinute)) {
+        return;
+    }
+    NSDate *const columnDate = [self dateForColumn:TCN_FORCE_UNWRAP(indexPath).section];
+    if (!columnDate) {
+        return;
+    }
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    NSDate *const startDateTime = [calendarContext dateAtMinuteOfDay:self.draggedStartMinute ofDate:TCN_FORCE_UNWRAP(columnDate)];
+    NSDate *const endDateTime = [calendarContext dateAtMinuteOfDay:self.draggedEndMinute ofDate:TCN_FORCE_UNWRAP(columnDate)];
+    id<TCNDayViewDelegate> const delegate = self.delegate;
+    if (startDateTime && endDateTime && [delegate respondsToSelector:@selector(dayView:didDragEvent:toStartDateTime:endDateTime:)]) {
+        [delegate dayView:self didDragEvent:TCN_FORCE_UNWRAP(event) toStartDateTime:TCN_FORCE_UNWRAP(startDateTime) endDateTime:TCN_FORCE_UNWRAP(endDateTime)];
+    }
+}
+
++ (NSInteger)minuteRoundedToDragInterval:(NSInteger)minute {
+    return (NSInteger)lround((double)minute / (double)DragMinuteInterval) * DragMinuteInterval;
+}
+
+#pragma mark - Snapshots
+
+- (void)applySnapshot:(nullable TCNEventSnapshot *)snapshot {
+    TCNEventSnapshot *const previousSnapshot = self.snapshot;
+    if (!snapshot || !previousSnapshot || ![snapshot.dates isEqualToArray:TCN_FORCE_UNWRAP(previousSnapshot).dates]) {
+        _snapshot = snapshot;
+        [self reloadAndResetScrolling:NO];
+        return;
+    }
+    TCNEventSnapshot *const newSnapshot = TCN_FORCE_UNWRAP(snapshot);
+    TCNEventSnapshot *const oldSnapshot = TCN_FORCE_UNWRAP(previousSnapshot);
+
+    // Events that appear twice can't be matched, and a diff may fail to allocate, so the day view is reloaded instead
+    TCNEventDiff *const allDayDiff = [TCNEventDiff diffFromEvents:oldSnapshot.allDayEvents toEvents:newSnapshot.allDayEvents];
+    NSMutableArray<TCNEventDiff *> *const columnDiffs = [[NSMutableArray alloc] initWithCapacity:newSnapshot.dates.count];
+    BOOL hasColumnChanges = NO;
+    for (NSInteger column = 0; column < newSnapshot.numberOfColumns; column++) {
+        TCNEventDiff *const diff = [TCNEventDiff diffFromEvents:[oldSnapshot dayEventsForColumn:column]
+                                                       toEvents:[newSnapshot dayEventsForColumn:column]];
+        if (!diff) {
+            break;
+        }
+        [columnDiffs addObject:TCN_FORCE_UNWRAP(diff)];
+        hasColumnChanges = hasColumnChanges || diff.hasChanges;
+    }
+    if (!allDayDiff || (NSInteger)columnDiffs.count != newSnapshot.numberOfColumns) {
+        _snapshot = newSnapshot;
+        [self reloadAndResetScrolling:NO];
+        return;
+    }
+
+    // The new snapshot holds new instances of the events that didn't change, which are displayed the same
+    [self carryOverDisplayModelsFromEvents:oldSnapshot.allDayEvents toEvents:newSnapshot.allDayEvents];
+    for (NSInteger column = 0; column < newSnapshot.numberOfColumns; column++) {
+        [self carryOverDisplayModelsFromEvents:[oldSnapshot dayEventsForColumn:column] toEvents:[newSnapshot dayEventsForColumn:column]];
+    }
+
+    // Both collection views read their item counts from the old snapshot before the swap, and from the new one after it
+    const BOOL hasAllDayChanges = TCN_FORCE_UNWRAP(allDayDiff).hasChanges;
+    UICollectionView *const allDayCollectionView = self.allDayCollectionView;
+    [UIView performWithoutAnimation:^{
+        [TCNDayView performUpdates:^{
+            if (allDayCollectionView) {
+                [TCNDayView performUpdates:^{
+                    self->_snapshot = newSnapshot;
+                    if (hasAllDayChanges) {
+                        TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+                        [TCNDayView applyDiff:TCN_FORCE_UNWRAP(allDayDiff) toSection:0 ofCollectionView:TCN_FORCE_UNWRAP(allDayCollectionView) context:context];
+                        [self.allDayCollectionViewLayout invalidateLayoutWithContext:context];
+                    }
+                } inCollectionView:TCN_FORCE_UNWRAP(allDayCollectionView) batched:hasAllDayChanges];
+            } else {
+                // A new all day view reads every event when it is first laid out, so there is nothing to update
+                self->_snapshot = newSnapshot;
+            }
+
+            if (hasColumnChanges) {
+                TCNDayViewLayoutInvalidationContext *const context = [[TCNDayViewLayoutInvalidationContext alloc] init];
+                for (NSUInteger column = 0; column < columnDiffs.count; column++) {
+                    [TCNDayView applyDiff:columnDiffs[column] toSection:(NSInteger)column ofCollectionView:self.collectionView context:context];
+                }
+                [self.collectionViewLayout invalidateLayoutWithContext:context];
+            }
+        } inCollectionView:self.collectionView batched:hasColumnChanges];
+    }];
+
+    if (hasAllDayChanges) {
+        // The all day view's height depends on its number of events
+        [self loadAllDayCollectionViewIfNeeded];
+        [self setNeedsLayout];
+    }
+}
+
+/**
+ Runs @c updates in a batch update of @c collectionView, or directly if they don't change its items, since an empty
+ batch update would still lay out every event again.
+ */
++ (void)performUpdates:(nonnull void (^)(void))updates inCollectionView:(nonnull UICollectionView *)collectionView batched:(BOOL)batched {
+    if (batched) {
+        [collectionView performBatchUpdates:updates completion:nil];
+    } else {
+        updates();
+    }
+}
+
+/**
+ Applies the changes of @c diff to @c section of @c collectionView, inside a batch update. Updated events are deleted and
+ inserted again, as a collection view can't reload an item whose index also changes. The layout treats moved events the
+ same way, so that their overlap clusters are adjusted at their new indexes.
+ */
++ (void)applyDiff:(nonnull TCNEventDiff *)diff
+        toSection:(NSInteger)section
+ ofCollectionView:(nonnull UICollectionView *)collectionView
+          context:(nonnull TCNDayViewLayoutInvalidationContext *)context {
+    NSMutableArray<NSIndexPath *> *const deletedIndexPaths = [[NSMutableArray alloc] init];
+    NSMutableArray<NSIndexPath *> *const insertedIndexPaths = [[NSMutableArray alloc] init];
+    [diff.deletedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
+        [deletedIndexPaths addObject:[NSIndexPath indexPathForItem:(NSInteger)index inSection:section]];
+    }];
+    [diff.insertedIndexes enumerateIndexesUsingBlock:^(NSUInteger index, __unused BOOL *stop) {
+        [insertedIndexPaths addObject:[NSIndexPath indexPathForItem:(NSInteger)index inSection:section]];
+    }];
+    [diff.updatedIndexes enumerateKeysAndObjectsUsingBlock:^(NSNumber *oldIndex, NSNumber *newIndex, __unused BOOL *stop) {
+        [deletedIndexPaths addObject:[NSIndexPath indexPathForItem:oldIndex.integerValue inSection:section]];
+        [insertedIndexPaths addObject:[NSIndexPath indexPathForItem:newIndex.integerValue inSection:section]];
+    }];
+    [collectionView deleteItemsAtIndexPaths:deletedIndexPaths];
+    [collectionView insertItemsAtIndexPaths:insertedIndexPaths];
+
+    NSMutableArray<NSIndexPath *> *const movedFromIndexPaths = [[NSMutableArray alloc] init];
+    NSMutableArray<NSIndexPath *> *const movedToIndexPaths = [[NSMutableArray alloc] init];
+    [diff.movedIndexes enumerateKeysAndObjectsUsingBlock:^(NSNumber *oldIndex, NSNumber *newIndex, __unused BOOL *stop) {
+        NSIndexPath *const oldIndexPath = [NSIndexPath indexPathForItem:oldIndex.integerValue inSection:section];
+        NSIndexPath *const newIndexPath = [NSIndexPath indexPathForItem:newIndex.integerValue inSection:section];
+        [collectionView moveItemAtIndexPath:oldIndexPath toIndexPath:newIndexPath];
+        [movedFromIndexPaths addObject:oldIndexPath];
+        [movedToIndexPaths addObject:newIndexPath];
+    }];
+
+    [context invalidateDeletedEventsAtIndexPaths:[deletedIndexPaths arrayByAddingObjectsFromArray:movedFromIndexPaths]];
+    [context invalidateInsertedEventsAtIndexPaths:[insertedIndexPaths arrayByAddingObjectsFromArray:movedToIndexPaths]];
+}
+
+/**
+ Reuses the display models prepared for @c oldEvents for the events of @c newEvents with the same identifier and content.
+ */
+- (void)carryOverDisplayModelsFromEvents:(nonnull NSArray<TCNEvent *> *)oldEvents toEvents:(nonnull NSArray<TCNEvent *> *)newEvents {
+    NSMutableDictionary<NSString *, TCNEvent *> *const preparedEventsByIdentifier = [[NSMutableDictionary alloc] init];
+    for (TCNEvent *event in oldEvents) {
+        if ([self cachedDisplayModelForEvent:event]) {
+            preparedEventsByIdentifier[event.identifier] = event;
+        }
+    }
+    if (preparedEventsByIdentifier.count == 0) {
+        return;
+    }
+
+    for (TCNEvent *event in newEvents) {
+        TCNEvent *const oldEvent = preparedEventsByIdentifier[event.identifier];
+        if (!oldEvent || oldEvent == event || ![oldEvent hasSameContentAsEvent:event]) {
+            continue;
+        }
+        TCNEventDisplayModel *const displayModel = [self.displayModels objectForKey:TCN_FORCE_UNWRAP(oldEvent)];
+        if (displayModel) {
+            [self.displayModels setObject:TCN_FORCE_UNWRAP(displayModel) forKey:event];
+        }
+    }
+}
+
+#pragma mark - Startup
+
+/**
+ Ends the first frame interval once the frame laid out in this run loop pass is committed, then prewarms the views.
+ */
+- (void)finishFirstFrameAfterCommit {
+    self.waitsForFirstFrame = YES;
+    __weak typeof(self) weakSelf = self;
+    [TCNDayView observeMainRunLoopBeforeWaitingInMode:kCFRunLoopCommonModes handler:^BOOL{
+        typeof(self) strongSelf = weakSelf;
+        if (!strongSelf) {
+            return NO;
+        }
+        [strongSelf finishPass:strongSelf.firstFrameTraceInterval
+                  elementCount:[strongSelf numberOfEventsNearVisibleArea]
+                 cacheHitCount:0
+              cacheLookupCount:0];
+        [strongSelf prewarmViews];
+        return NO;
+    }];
+}
+
+/**
+ Measures the titles of the events on screen at the laid out item width and styles one of their cells and an hour label,
+ the next time the main run loop is about to sleep. The run loop isn't in its default mode while the day view is
+ scrolled, so nothing is prewarmed during a scroll.
+ */
+- (void)prewarmViews {
+    if (!self.config.prewarmsViews) {
+        return;
+    }
+
+    __weak typeof(self) weakSelf = self;
+    [TCNDayView observeMainRunLoopBeforeWaitingInMode:kCFRunLoopDefaultMode handler:^BOOL{
+        typeof(self) strongSelf = weakSelf;
+        if (!strongSelf) {
+            return NO;
+        }
+        const CGFloat cellWidth = strongSelf.collectionViewLayout.fullEventItemWidth;
+        if (cellWidth <= 0) {
+            return NO;
+        }
+
+        // Any timed event on screen stands in for the cells that will scroll in
+        TCNEvent *event = nil;
+        const NSRange columns = [strongSelf columnsNearVisibleArea];
+        for (NSUInteger column = columns.location; column < NSMaxRange(columns); column++) {
+            NSArray<TCNEvent *> *const events = [strongSelf dayEventsForColumn:(NSInteger)column];
+            [TCNEventCell prepareTextMeasurementsForEvents:events cellWidth:cellWidth config:strongSelf.config];
+            for (TCNEvent *dayEvent in events) {
+                if (!event && !dayEvent.isAllDay) {
+                    event = dayEvent;
+                }
+            }
+        }
+        [TCNDayView prewarmViewsForEvent:event config:strongSelf.config cellWidth:cellWidth];
+        return NO;
+    }];
+}
+
+/**
+ Creates and styles an event cell showing @c event, or a placeholder event, and an hour label, then discards them. The
+ fonts, images and text layout loaded for them are shared with every later view.
+ */
++ (void)prewarmViewsForEvent:(nullable TCNEvent *)event config:(nonnull TCNDayViewConfig *)config cellWidth:(CGFloat)cellWidth {
+    TCNEvent *const shownEvent = event ?: [TCNDayView calendarEventWithSelectedDate:[NSDate date]
+                                                                           eventName:config.createdEventText
+                                                                         eventLength:config.defaultEventLength];
+    TCNEventCell *const eventCell = [[TCNEventCell alloc] initWithFrame:CGRectMake(0, 0, cellWidth, PrewarmedViewHeight)];
+    [eventCell applyDisplayModel:[TCNEventCell displayModelForEvent:shownEvent config:config cellWidth:cellWidth]];
+    [eventCell layoutIfNeeded];
+
+    TCNDayViewTimeView *const timeView = [[TCNDayViewTimeView alloc] initWithFrame:CGRectMake(0, 0, PrewarmedTimeViewWidth, PrewarmedViewHeight)];
+    [timeView applyStylingFromConfig:config selected:NO];
+    timeView.time = shownEvent.startDateTime;
+    [timeView layoutIfNeeded];
+}
+
+/**
+ Calls @c handler each time the main run loop is about to sleep in @c mode, after Core Animation committed the pass's
+ changes, until it returns NO.
+ */
++ (void)observeMainRunLoopBeforeWaitingInMode:(nonnull CFRunLoopMode)mode handler:(nonnull BOOL (^)(void))handler {
+    CFRunLoopObserverRef const runLoopObserver =
+    CFRunLoopObserverCreateWithHandler(kCFAllocatorDefault,
+                                       kCFRunLoopBeforeWaiting,
+                                       true,
+                                       AfterCommitObserverOrder,
+                                       ^(CFRunLoopObserverRef observer, __unused CFRunLoopActivity activity) {
+        if (!handler()) {
+            CFRunLoopObserverInvalidate(observer);
+        }
+    });
+    CFRunLoopAddObserver(CFRunLoopGetMain(), runLoopObserver, mode);
+    CFRelease(runLoopObserver);
 }
 
 #pragma mark - View Lifecycle
@@ -186,13 +1038,18 @@ static const NSInteger DefaultHour = 8;
     const NSInteger numberOfAllDayItems = [self.allDayCollectionView numberOfItemsInSection:0];
     if (numberOfAllDayItems) {
         [self.allDayCollectionView scrollRectToVisible:CGRectZero animated:false];
-        const CGFloat allDayViewHeight = [TCNAllDayViewLayout allDayViewHeightForEventCount:numberOfAllDayItems];
+        TCNAllDayViewLayout *const allDayLayout = TCN_CAST_OR_NIL(self.allDayCollectionViewLayout, TCNAllDayViewLayout);
+        const CGFloat allDayViewHeight = allDayLayout ? allDayLayout.allDayViewHeight : [TCNAllDayViewLayout allDayViewHeightForEventCount:numberOfAllDayItems];
         self.collectionView.frame = CGRectMake(0, allDayViewHeight, self.bounds.size.width, self.bounds.size.height - allDayViewHeight);
         self.allDayCollectionView.frame = CGRectMake(0, 0, self.bounds.size.width, allDayViewHeight);
     } else {
         self.collectionView.frame = self.bounds;
         self.allDayCollectionView.frame = CGRectZero;
     }
+
+    if (self.window && !self.waitsForFirstFrame) {
+        [self finishFirstFrameAfterCommit];
+    }
 }
 
 - (void)willMoveToSuperview:(UIView *)newSuperview {
@@ -200,6 +1057,7 @@ static const NSInteger DefaultHour = 8;
 
     self.collectionViewLayout.delegate = self;
     self.collectionView.dataSource = self;
+    self.collectionView.prefetchDataSource = self;
     self.collectionView.delegate = self;
     self.allDayCollectionViewLayout.delegate = self;
     self.allDayCollectionView.dataSource = self;
@@ -208,29 +1066,36 @@ static const NSInteger DefaultHour = 8;
 
 #pragma mark - UICollectionViewDataSource
 
-- (NSInteger)numberOfSectionsInCollectionView:(__unused UICollectionView *)collectionView {
-    return 1;
+- (NSInteger)numberOfSectionsInCollectionView:(UICollectionView *)collectionView {
+    return collectionView == self.collectionView ? [self numberOfColumns] : 1;
 }
 
-- (NSInteger)collectionView:(__unused UICollectionView *)collectionView numberOfItemsInSection:(__unused NSInteger)section {
-    if (collectionView == self.collectionView) {
-        return (NSInteger)self.dayEvents.count;
-    } else {
-        return (NSInteger)self.allDayEvents.count;
-    }
+- (NSInteger)collectionView:(UICollectionView *)collectionView numberOfItemsInSection:(NSInteger)section {
+    return (NSInteger)[self eventsForCollectionView:collectionView section:section].count;
 }
 
 - (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView cellForItemAtIndexPath:(NSIndexPath *)indexPath {
-    NSArray<TCNEvent *> *const events = collectionView == self.collectionView ? self.dayEvents : self.allDayEvents;
+    NSArray<TCNEvent *> *const events = [self eventsForCollectionView:collectionView section:indexPath.section];
     UICollectionViewCell *const collectionViewCell = [collectionView dequeueReusableCellWithReuseIdentifier:TCNEventCell.reuseIdentifier
                                                                                                forIndexPath:indexPath];
     TCNEventCell *const eventCell = TCN_CAST_OR_NIL(collectionViewCell, TCNEventCell);
     if (!eventCell) {
         return collectionViewCell;
     }
+    const TCNTraceInterval traceInterval = TCNTraceBegin(TCNTraceNameCellConfiguration);
     TCNEvent *const event = events[(NSUInteger)indexPath.row];
+    TCNEventDisplayModel *const preparedDisplayModel = [self cachedDisplayModelForEvent:event];
+    TCNEventDisplayModel *const displayModel = preparedDisplayModel ?: [self displayModelForEvent:event];
+    // Only a cell showing its cancel button needs a handler
+    eventCell.cancelHandler = displayModel.style.showsCancelButton ? [self cancelHandlerForEvent:event] : nil;
+    [eventCell applyDisplayModel:displayModel];
+    [self finishPass:traceInterval elementCount:1 cacheHitCount:preparedDisplayModel ? 1 : 0 cacheLookupCount:1];
+    return eventCell;
+}
+
+- (nonnull void (^)(void))cancelHandlerForEvent:(nonnull TCNEvent *)event {
     __weak typeof(self) weakSelf = self;
-    eventCell.cancelHandler = ^{
+    return ^{
         typeof(self) strongSelf = weakSelf;
         id<TCNDayViewDelegate> strongDelegate = strongSelf.delegate;
         if (!strongSelf || !strongDelegate) {
@@ -240,14 +1105,25 @@ static const NSInteger DefaultHour = 8;
             [strongDelegate dayView:strongSelf didCancelEvent:event];
         }
     };
-    [eventCell updateWithEvent:event];
-    [eventCell applyStylingFromConfig:self.config selected:event.isSelected];
-    return eventCell;
 }
 
 - (UICollectionReusableView *)collectionView:(UICollectionView *)collectionView
            viewForSupplementaryElementOfKind:(NSString *)kind
                                  atIndexPath:(NSIndexPath *)indexPath {
+    if ([kind isEqualToString:TCNAllDayOverflowView.kind]) {
+        UICollectionReusableView *const reusableView = [collectionView dequeueReusableSupplementaryViewOfKind:kind
+                                                                                          withReuseIdentifier:TCNAllDayOverflowView.reuseIdentifier
+                                                                                                 forIndexPath:indexPath];
+        TCNAllDayOverflowView *const overflowView = TCN_CAST_OR_NIL(reusableView, TCNAllDayOverflowView);
+        if (!overflowView) {
+            NSAssert(NO, @"Unable to cast UICollectionReusableView to TCNAllDayOverflowView");
+            return nil;
+        }
+        [overflowView applyStylingFromConfig:self.config selected:NO];
+        overflowView.hiddenEventCount = [TCN_CAST_OR_NIL(self.allDayCollectionViewLayout, TCNAllDayViewLayout) hiddenEventCountForDay:indexPath.item];
+        return overflowView;
+    }
+
     UICollectionReusableView *const reusableView = [collectionView dequeueReusableSupplementaryViewOfKind:kind
                                                                                       withReuseIdentifier:TCNDayViewTimeView.reuseIdentifier
                                                                                              forIndexPath:indexPath];
@@ -275,7 +1151,7 @@ static const NSInteger DefaultHour = 8;
     NSDateComponents *const dateComponents = [[NSDateComponents alloc] init];
     dateComponents.hour = indexPath.item;
 
-    NSDate *const date = [[NSCalendar currentCalendar] dateFromComponents:dateComponents];
+    NSDate *const date = [TCNCalendarContext.sharedContext.calendar dateFromComponents:dateComponents];
     if (!date) {
         TCN_ASSERT_FAILURE(@"No date created in dateForTimeViewAtIndexPath");
         // we'll just return current date if we fail to calculate a date
@@ -285,6 +1161,112 @@ static const NSInteger DefaultHour = 8;
     return date;
 }
 
+#pragma mark - UICollectionViewDataSourcePrefetching
+
+- (void)collectionView:(UICollectionView *)collectionView prefetchItemsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths {
+    const CGFloat cellWidth = self.collectionViewLayout.fullEventItemWidth;
+    TCNDayViewConfig *const config = self.config;
+    for (NSIndexPath *indexPath in indexPaths) {
+        NSArray<TCNEvent *> *const events = [self eventsForCollectionView:collectionView section:indexPath.section];
+        if ((NSUInteger)indexPath.row >= events.count || self.displayModelOperations[indexPath]) {
+            continue;
+        }
+        TCNEvent *const event = events[(NSUInteger)indexPath.row];
+        if ([self cachedDisplayModelForEvent:event]) {
+            continue;
+        }
+
+        // The config is only read here, on the main thread; the operation measures and formats with the resolved style
+        TCNEventCellStyle *const style = [TCNEventCellStyle styleWithConfig:config selected:event.isSelected];
+        NSBlockOperation *const operation = [[NSBlockOperation alloc] init];
+        __weak NSBlockOperation *weakOperation = operation;
+        __weak typeof(self) weakSelf = self;
+        [operation addExecutionBlock:^{
+            NSBlockOperation *const strongOperation = weakOperation;
+            if (!strongOperation || strongOperation.isCancelled) {
+                return;
+            }
+            TCNEventDisplayModel *const displayModel = [TCNEventCell displayModelForEvent:event style:style cellWidth:cellWidth];
+            [NSOperationQueue.mainQueue addOperationWithBlock:^{
+                typeof(self) strongSelf = weakSelf;
+                if (!strongSelf || strongSelf.displayModelOperations[indexPath] != strongOperation) {
+                    return;
+                }
+                [strongSelf.displayModelOperations removeObjectForKey:indexPath];
+                if (!strongOperation.isCancelled) {
+                    [strongSelf.displayModels setObject:displayModel forKey:event];
+                }
+            }];
+        }];
+        self.displayModelOperations[indexPath] = operation;
+        [self.displayModelQueue addOperation:operation];
+    }
+}
+
+- (void)collectionView:(UICollectionView *)collectionView cancelPrefetchingForItemsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths {
+    for (NSIndexPath *indexPath in indexPaths) {
+        [self.displayModelOperations[indexPath] cancel];
+        [self.displayModelOperations removeObjectForKey:indexPath];
+    }
+}
+
+#pragma mark - Display Models
+
+/**
+ The prepared display model of @c event, or a new one built on the main thread if it wasn't prepared in time.
+ */
+- (nonnull TCNEventDisplayModel *)displayModelForEvent:(nonnull TCNEvent *)event {
+    TCNEventDisplayModel *const cachedDisplayModel = [self cachedDisplayModelForEvent:event];
+    if (cachedDisplayModel) {
+        return TCN_FORCE_UNWRAP(cachedDisplayModel);
+    }
+
+    TCNEventDisplayModel *const displayModel = [TCNEventCell displayModelForEvent:event
+                                                                           config:self.config
+                                                                        cellWidth:self.collectionViewLayout.fullEventItemWidth];
+    [self.displayModels setObject:displayModel forKey:event];
+    return displayModel;
+}
+
+/**
+ The display model prepared for @c event, unless the event has been selected or deselected since.
+ */
+- (nullable TCNEventDisplayModel *)cachedDisplayModelForEvent:(nonnull TCNEvent *)event {
+    TCNEventDisplayModel *const displayModel = [self.displayModels objectForKey:event];
+    return displayModel.style.selected == event.isSelected ? displayModel : nil;
+}
+
+- (void)discardDisplayModels {
+    for (NSOperation *operation in self.displayModelOperations.allValues) {
+        [operation cancel];
+    }
+    [self.displayModelOperations removeAllObjects];
+    [self.displayModels removeAllObjects];
+}
+
+#pragma mark - Metrics
+
+/**
+ Ends a traced pass, and reports its measurements to the metrics delegate if there is one.
+ */
+- (void)finishPass:(TCNTraceInterval)traceInterval
+      elementCount:(NSInteger)elementCount
+     cacheHitCount:(NSInteger)cacheHitCount
+  cacheLookupCount:(NSInteger)cacheLookupCount {
+    const NSTimeInterval duration = TCNTraceEnd(traceInterval);
+    id<TCNDayViewMetricsDelegate> const metricsDelegate = self.metricsDelegate;
+    if (!metricsDelegate) {
+        return;
+    }
+
+    TCNPassMetrics *const metrics = [[TCNPassMetrics alloc] initWithName:traceInterval.name
+                                                                duration:duration
+                                                            elementCount:elementCount
+                                                           cacheHitCount:cacheHitCount
+                                                        cacheLookupCount:cacheLookupCount];
+    [metricsDelegate dayView:self didMeasurePass:metrics];
+}
+
 #pragma mark - TCNDayViewLayoutDelegate
 
 /**
@@ -298,8 +1280,11 @@ static const NSInteger DefaultHour = 8;
 - (nonnull NSDate *)collectionView:(nullable UICollectionView *)collectionView
                             layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
        startTimeForItemAtIndexPath:(NSIndexPath *)indexPath {
-    NSDate *const currentDate = self.dataSource.currentDate;
-    if (!currentDate || !collectionView) {
+    if (!collectionView) {
+        return [NSDate date];
+    }
+    NSDate *const currentDate = [self dateForCollectionView:TCN_FORCE_UNWRAP(collectionView) section:indexPath.section];
+    if (!currentDate) {
         return [NSDate date];
     }
 
@@ -307,18 +1292,12 @@ static const NSInteger DefaultHour = 8;
     if (!event) {
         return [NSDate new];
     }
-    NSDate *const startOfThisDay = [[NSCalendar currentCalendar] startOfDayForDate:TCN_FORCE_UNWRAP(currentDate)];
+    NSDate *const startOfThisDay = [TCNCalendarContext.sharedContext startOfDayForDate:TCN_FORCE_UNWRAP(currentDate)];
     if (!startOfThisDay) {
         return [NSDate date];
     }
 
-    if (![event occursOnDay:currentDate]) {
-        return startOfThisDay;
-    } else if (event.isAllDay) {
-        return startOfThisDay;
-    } else {
-        return [TCNDateUtil latestDate:event.startDateTime otherDate:startOfThisDay];
-    }
+    return [TCNDayView displayedStartTimeForEvent:event currentDate:TCN_FORCE_UNWRAP(currentDate) startOfDay:startOfThisDay];
 }
 
 /**
@@ -332,8 +1311,11 @@ static const NSInteger DefaultHour = 8;
 - (nonnull NSDate *)collectionView:(nullable UICollectionView *)collectionView
                             layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
          endTimeForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
-    NSDate *const currentDateOrNil = self.dataSource.currentDate;
-    if (!currentDateOrNil || !collectionView) {
+    if (!collectionView) {
+        return [NSDate date];
+    }
+    NSDate *const currentDateOrNil = [self dateForCollectionView:TCN_FORCE_UNWRAP(collectionView) section:indexPath.section];
+    if (!currentDateOrNil) {
         return [NSDate date];
     }
     NSDate *const currentDate = TCN_FORCE_UNWRAP(currentDateOrNil);
@@ -342,19 +1324,59 @@ static const NSInteger DefaultHour = 8;
     if (!event) {
         return [NSDate new];
     }
-    NSDate *const startOfThisDay = [[NSCalendar currentCalendar] startOfDayForDate:currentDate];
+    NSDate *const startOfThisDay = [TCNCalendarContext.sharedContext startOfDayForDate:currentDate];
     NSDate *const endOfThisDay = [TCNDateUtil endOfDayForDate:currentDate];
     if (!startOfThisDay) {
         return [NSDate date];
     }
 
-    if (![event occursOnDay:currentDate]) {
-        return startOfThisDay;
-    } else if (event.isAllDay) {
-        return startOfThisDay;
-    } else {
-        return [TCNDateUtil earliestDate:event.endDateTime otherDate:endOfThisDay];
+    return [TCNDayView displayedEndTimeForEvent:event currentDate:currentDate startOfDay:startOfThisDay endOfDay:endOfThisDay];
+}
+
+/**
+ Fills in the time ranges of every event in the collection view's section at once, using the same rules as
+ @c collectionView:layout:startTimeForItemAtIndexPath: and @c collectionView:layout:endTimeForItemAtIndexPath:.
+ The events, calendar and day boundaries are read once for the whole section.
+ */
+- (BOOL)collectionView:(nullable UICollectionView *)collectionView
+                layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+         getTimeRanges:(nonnull TCNDayViewLayoutItemTimeRange *)timeRanges
+     forItemsInSection:(NSInteger)section
+                 count:(NSInteger)count {
+    if (!collectionView) {
+        return NO;
+    }
+    NSDate *const currentDateOrNil = [self dateForCollectionView:TCN_FORCE_UNWRAP(collectionView) section:section];
+    if (!currentDateOrNil) {
+        return NO;
     }
+    NSDate *const currentDate = TCN_FORCE_UNWRAP(currentDateOrNil);
+
+    NSArray<TCNEvent *> *const events = [self eventsForCollectionView:TCN_FORCE_UNWRAP(collectionView) section:section];
+    if (count < 0 || events.count < (NSUInteger)count) {
+        TCN_ASSERT_FAILURE(@"Index out of bounds for calendar data source");
+        return NO;
+    }
+
+    TCNCalendarContext *const calendarContext = TCNCalendarContext.sharedContext;
+    NSDate *const startOfThisDay = [calendarContext startOfDayForDate:currentDate];
+    NSDate *const endOfThisDay = [TCNDateUtil endOfDayForDate:currentDate];
+    if (!startOfThisDay) {
+        return NO;
+    }
+
+    for (NSUInteger index = 0; index < (NSUInteger)count; index++) {
+        TCNEvent *const event = events[index];
+        NSDate *const startTime = [TCNDayView displayedStartTimeForEvent:event currentDate:currentDate startOfDay:startOfThisDay];
+        NSDate *const endTime = [TCNDayView displayedEndTimeForEvent:event currentDate:currentDate startOfDay:startOfThisDay endOfDay:endOfThisDay];
+
+        timeRanges[index] = (TCNDayViewLayoutItemTimeRange){
+            [calendarContext minuteOfDayForDate:startTime],
+            [calendarContext minuteOfDayForDate:endTime],
+            !event.isSelected
+        };
+    }
+    return YES;
 }
 
 /**
@@ -369,8 +1391,34 @@ static const NSInteger DefaultHour = 8;
     return ![self eventForIndexPath:indexPath collectionView:TCN_FORCE_UNWRAP(collectionView)].isSelected;
 }
 
+/**
+ Identifies an event by its name and times rather than by @c TCNEvent.identifier, which is a new UUID for events created
+ without one, so that saved layout snapshots still match the events after a relaunch.
+ */
+- (nonnull NSString *)collectionView:(nullable UICollectionView *)collectionView
+                              layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+        identifierForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    if (!collectionView) {
+        return @"";
+    }
+    TCNEvent *const event = [self eventForIndexPath:indexPath collectionView:TCN_FORCE_UNWRAP(collectionView)];
+    if (!event) {
+        return @"";
+    }
+    return [NSString stringWithFormat:@"%@|%.0f|%.0f",
+            event.name,
+            event.startDateTime.timeIntervalSinceReferenceDate,
+            event.endDateTime.timeIntervalSinceReferenceDate];
+}
+
+- (void)collectionView:(nullable __unused UICollectionView *)collectionView
+                layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+        didMeasurePass:(nonnull TCNPassMetrics *)metrics {
+    [self.metricsDelegate dayView:self didMeasurePass:metrics];
+}
+
 - (nullable TCNEvent *)eventForIndexPath:(nonnull NSIndexPath *)indexPath collectionView:(nonnull UICollectionView *)collectionView {
-    NSArray<TCNEvent *> *const events = [(collectionView == self.collectionView ? self.dayEvents : self.allDayEvents) copy];
+    NSArray<TCNEvent *> *const events = [[self eventsForCollectionView:collectionView section:indexPath.section] copy];
     NSUInteger index = (NSUInteger)indexPath.row;
     if (events.count <= index) {
         TCN_ASSERT_FAILURE(@"Index out of bounds for calendar data source");
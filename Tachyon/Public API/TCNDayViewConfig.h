@@ -48,12 +48,90 @@ typedef NS_ENUM(NSInteger, TCNEventLength) {
  */
 @property (nonatomic, copy, nonnull, readwrite) NSString *allDayLabelText;
 
+/**
+ The text after the number of all day events that don't fit on a day, e.g. "+3 more".
+ Defaults to "more".
+ */
+@property (nonatomic, copy, nonnull, readwrite) NSString *allDayOverflowLabelText;
+
+/**
+ The most rows of all day events to show, including a row with the number of events on each day that don't fit. All
+ day events share rows where they don't overlap. Defaults to 0, which shows every row and scrolls the all day view when
+ they don't fit in its height.
+ */
+@property (nonatomic, assign, readwrite) NSInteger maximumAllDayRowCount;
+
 /**
  The length of a newly created event, in minutes.
  Defaults to 30.
  */
 @property (nonatomic, assign, readwrite) TCNEventLength defaultEventLength;
 
+/**
+ The width of each column when the day view's data source provides more than one column.
+ Defaults to 0, which makes each column as wide as the day view.
+ */
+@property (nonatomic, assign, readwrite) CGFloat columnWidth;
+
+/**
+ Whether event frames are computed on a background queue when the day view reloads. The grid is shown right away and
+ events appear once their frames are ready, so reloading a day with many events doesn't block touch handling.
+ Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL layoutsEventsInBackground;
+
+/**
+ Whether the hour labels and gridlines are drawn once into images shared by every day view with this config, instead of
+ being laid out as a view per hour label and gridline. The config's sidebar and gridline styling is read when the images
+ are first drawn. Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL rendersStaticGrid;
+
+/**
+ Whether pinching the day view zooms its time scale, from @c minimumTimeScale to @c maximumTimeScale. Events are laid out
+ once and only scaled while pinching, and switch to more compact cells as they get shorter. Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL zoomsWithPinch;
+
+/**
+ Whether events can be dragged after a long press: by their middle to move them, or by their top or bottom edge to
+ change their start or end time. A long press on an empty time slot creates an event there, as a tap does, and dragging
+ then changes its end time. Overlapping events make room for the dragged event as it moves. Defaults to NO.
+
+ Events are only dragged if the day view's delegate implements @c dayView:didDragEvent:toStartDateTime:endDateTime:.
+ */
+@property (nonatomic, assign, readwrite) BOOL editsEventsByDragging;
+
+/**
+ The smallest and largest factors the height of an hour can be scaled by, e.g. by pinching. Default to 0.25, which fits
+ the whole day on most screens, and 2.
+ */
+@property (nonatomic, assign, readwrite) CGFloat minimumTimeScale;
+@property (nonatomic, assign, readwrite) CGFloat maximumTimeScale;
+
+/**
+ A directory in which the event layout of each day shown in a single column is saved, so that the next time the day is
+ shown, e.g. right after the app launches, its events are drawn from the saved layout while they are laid out again in
+ the background. The data source must implement @c dataVersionForDate:. Defaults to nil, which saves nothing.
+
+ A small file is saved for each day shown, so a caches directory owned by the app is a good choice.
+ */
+@property (nonatomic, copy, nullable, readwrite) NSURL *layoutSnapshotDirectoryURL;
+
+/**
+ Whether the all day view is only created once there are all day events to show, so that opening a day without any
+ doesn't build a second collection view. Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL createsAllDayViewLazily;
+
+/**
+ Whether an event cell and an hour label are styled, and the titles of the events on screen measured, once the main run
+ loop is idle after the day view's first frame, so that the fonts, images and text layout they share are loaded before
+ the first scroll rather than during it. The views are discarded afterwards: UIKit can't add them to the collection
+ view's reuse queue, so the cells shown later are still created as they scroll in. Defaults to NO.
+ */
+@property (nonatomic, assign, readwrite) BOOL prewarmsViews;
+
 /**
  The background color of the collection view.
  Defaults to white.
@@ -5,6 +5,7 @@
 
 static NSString *const DefaultNewEventText = @"Available";
 static NSString *const DefaultAllDayEventText = @"All Day";
+static NSString *const DefaultAllDayOverflowText = @"more";
 
 - (nonnull instancetype)init {
     self = [super init];
@@ -14,7 +15,19 @@ static NSString *const DefaultAllDayEventText = @"All Day";
 
     _createdEventText = DefaultNewEventText;
     _allDayLabelText = DefaultAllDayEventText;
+    _allDayOverflowLabelText = DefaultAllDayOverflowText;
+    _maximumAllDayRowCount = 0;
     _defaultEventLength = TCNEventLengthHalfHour;
+    _columnWidth = 0.0f;
+    _layoutsEventsInBackground = NO;
+    _rendersStaticGrid = NO;
+    _zoomsWithPinch = NO;
+    _editsEventsByDragging = NO;
+    _minimumTimeScale = 0.25f;
+    _maximumTimeScale = 2.0f;
+    _layoutSnapshotDirectoryURL = nil;
+    _createsAllDayViewLazily = NO;
+    _prewarmsViews = NO;
     _backgroundColor = [UIColor whiteColor];
 
     _eventFont = [UIFont systemFontOfSize:12.0f];
@@ -0,0 +1,55 @@
+#import <Foundation/Foundation.h>
+#import "TCNTrace.h"
+
+/**
+ The measurements of one pass through a hot path of a day view or date picker, reported to their metrics delegates.
+ */
+@interface TCNPassMetrics : NSObject
+
+/**
+ The hot path the pass went through.
+ */
+@property (nonatomic, assign, readonly) TCNTraceName name;
+
+/**
+ How long the pass took, in seconds.
+ */
+@property (nonatomic, assign, readonly) NSTimeInterval duration;
+
+/**
+ The number of elements the pass produced or handled, e.g. the layout attributes prepared or returned, the events
+ adjusted for overlap or the days regenerated.
+ */
+@property (nonatomic, assign, readonly) NSInteger elementCount;
+
+/**
+ How many of the pass's lookups in a cache found what they looked for, out of @c cacheLookupCount. Both are 0 for passes
+ that don't use a cache.
+ */
+@property (nonatomic, assign, readonly) NSInteger cacheHitCount;
+@property (nonatomic, assign, readonly) NSInteger cacheLookupCount;
+
+/**
+ @c cacheHitCount divided by @c cacheLookupCount, or 0 if there were no lookups.
+ */
+@property (nonatomic, assign, readonly) double cacheHitRate;
+
+/**
+ The measurements of a pass.
+
+ @param name The hot path the pass went through.
+ @param duration How long the pass took, in seconds.
+ @param elementCount The number of elements the pass produced or handled.
+ @param cacheHitCount The number of cache lookups that hit.
+ @param cacheLookupCount The number of cache lookups.
+ @return A @c TCNPassMetrics instance.
+ */
+- (nonnull instancetype)initWithName:(TCNTraceName)name
+                            duration:(NSTimeInterval)duration
+                        elementCount:(NSInteger)elementCount
+                       cacheHitCount:(NSInteger)cacheHitCount
+                    cacheLookupCount:(NSInteger)cacheLookupCount NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
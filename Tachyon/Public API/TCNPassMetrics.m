@@ -0,0 +1,44 @@
+#import "TCNPassMetrics.h"
+
+@implementation TCNPassMetrics
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithName:(TCNTraceName)name
+                            duration:(NSTimeInterval)duration
+                        elementCount:(NSInteger)elementCount
+                       cacheHitCount:(NSInteger)cacheHitCount
+                    cacheLookupCount:(NSInteger)cacheLookupCount {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _name = name;
+    _duration = duration;
+    _elementCount = elementCount;
+    _cacheHitCount = cacheHitCount;
+    _cacheLookupCount = cacheLookupCount;
+
+    return self;
+}
+
+#pragma mark - Properties
+
+- (double)cacheHitRate {
+    return self.cacheLookupCount > 0 ? (double)self.cacheHitCount / (double)self.cacheLookupCount : 0;
+}
+
+#pragma mark - NSObject
+
+- (nonnull NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %@ %.3fms, %ld elements, %ld/%ld cache hits>",
+            NSStringFromClass(self.class),
+            [TCNTrace stringForName:self.name],
+            self.duration * 1000,
+            (long)self.elementCount,
+            (long)self.cacheHitCount,
+            (long)self.cacheLookupCount];
+}
+
+@end
@@ -0,0 +1,127 @@
+#import <Foundation/Foundation.h>
+#import <QuartzCore/QuartzCore.h>
+
+/**
+ The hot paths of the day view and date picker that are traced as intervals.
+ */
+typedef NS_ENUM(NSInteger, TCNTraceName) {
+
+    /**
+     A @c prepareLayout pass of a day view layout.
+     */
+    TCNTraceNamePrepareLayout,
+
+    /**
+     Placing one section's overlapping events side by side.
+     */
+    TCNTraceNameOverlapAdjustment,
+
+    /**
+     A @c layoutAttributesForElementsInRect: query of a day view layout.
+     */
+    TCNTraceNameElementsInRect,
+
+    /**
+     Configuring one event cell for display.
+     */
+    TCNTraceNameCellConfiguration,
+
+    /**
+     A @c reloadAndResetScrolling: of a day view.
+     */
+    TCNTraceNameReload,
+
+    /**
+     Regenerating the weeks of a date picker around a new date.
+     */
+    TCNTraceNameWeekRegeneration,
+
+    /**
+     From the initialization of a day view to the commit of its first frame in a window.
+     */
+    TCNTraceNameFirstFrame
+
+};
+
+/**
+ Receives the intervals traced by Tachyon, e.g. to forward them to a system tracing facility or a profiler.
+ */
+@protocol TCNTraceBackend <NSObject>
+
+/**
+ Called when an interval starts.
+
+ @param name The traced hot path.
+ @param identifier Identifies the interval until it ends. Never 0.
+ */
+- (void)beginIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier;
+
+/**
+ Called when the interval started with @c identifier ends.
+
+ @param name The traced hot path.
+ @param identifier The identifier passed to @c beginIntervalWithName:identifier:.
+ */
+- (void)endIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier;
+
+@end
+
+/**
+ Tracing of Tachyon's hot paths. Intervals are only reported while a backend is set, so tracing costs no more than
+ reading a clock by default.
+ */
+@interface TCNTrace : NSObject
+
+/**
+ The backend that receives traced intervals, or @c nil to trace nothing. Defaults to @c nil.
+
+ Intervals are reported on the main thread, so the backend should be set on the main thread.
+ */
+@property (nonatomic, strong, nullable, class, readwrite) id<TCNTraceBackend> backend;
+
+/**
+ @return The name of a traced hot path, e.g. "prepareLayout".
+ */
++ (nonnull NSString *)stringForName:(TCNTraceName)name;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ A @c TCNTraceBackend that emits os_signpost intervals, which appear in Instruments' Points of Interest.
+ */
+API_AVAILABLE(ios(12.0))
+@interface TCNSignpostTraceBackend : NSObject <TCNTraceBackend>
+
+@end
+
+/**
+ An interval in progress, started with @c TCNTraceBegin.
+ */
+typedef struct {
+    TCNTraceName name;
+
+    /**
+     The identifier passed to the backend, or 0 if no backend was set when the interval started.
+     */
+    uint64_t identifier;
+
+    CFTimeInterval startTime;
+} TCNTraceInterval;
+
+/**
+ Starts an interval, reporting it to @c TCNTrace.backend if one is set. Must be called on the main thread.
+
+ @param name The traced hot path.
+ @return The interval, to be passed to @c TCNTraceEnd.
+ */
+FOUNDATION_EXPORT TCNTraceInterval TCNTraceBegin(TCNTraceName name);
+
+/**
+ Ends an interval started with @c TCNTraceBegin. Must be called on the main thread.
+
+ @param interval The interval to end.
+ @return The duration of the interval, in seconds.
+ */
+FOUNDATION_EXPORT NSTimeInterval TCNTraceEnd(TCNTraceInterval interval);
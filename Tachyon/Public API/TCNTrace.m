@@ -0,0 +1,138 @@
+#import "TCNTrace.h"
+#import <os/signpost.h>
+
+@implementation TCNTrace
+
+/**
+ Only read and written on the main thread, like the identifiers of the intervals it receives.
+ */
+static id<TCNTraceBackend> TCNTraceCurrentBackend = nil;
+static uint64_t TCNTraceLastIdentifier = 0;
+
+#pragma mark - Backend
+
++ (nullable id<TCNTraceBackend>)backend {
+    return TCNTraceCurrentBackend;
+}
+
++ (void)setBackend:(nullable id<TCNTraceBackend>)backend {
+    TCNTraceCurrentBackend = backend;
+}
+
+#pragma mark - Names
+
++ (nonnull NSString *)stringForName:(TCNTraceName)name {
+    switch (name) {
+        case TCNTraceNamePrepareLayout:
+            return @"prepareLayout";
+        case TCNTraceNameOverlapAdjustment:
+            return @"overlapAdjustment";
+        case TCNTraceNameElementsInRect:
+            return @"layoutAttributesForElementsInRect";
+        case TCNTraceNameCellConfiguration:
+            return @"cellConfiguration";
+        case TCNTraceNameReload:
+            return @"reload";
+        case TCNTraceNameWeekRegeneration:
+            return @"weekRegeneration";
+        case TCNTraceNameFirstFrame:
+            return @"firstFrame";
+    }
+    return @"unknown";
+}
+
+@end
+
+#pragma mark - Intervals
+
+TCNTraceInterval TCNTraceBegin(TCNTraceName name) {
+    id<TCNTraceBackend> const backend = TCNTraceCurrentBackend;
+    const uint64_t identifier = backend ? ++TCNTraceLastIdentifier : 0;
+    [backend beginIntervalWithName:name identifier:identifier];
+    return (TCNTraceInterval){name, identifier, CACurrentMediaTime()};
+}
+
+NSTimeInterval TCNTraceEnd(TCNTraceInterval interval) {
+    const NSTimeInterval duration = CACurrentMediaTime() - interval.startTime;
+    // An interval that started before the backend was set was never reported to it
+    if (interval.identifier != 0) {
+        [TCNTraceCurrentBackend endIntervalWithName:interval.name identifier:interval.identifier];
+    }
+    return duration;
+}
+
+#pragma mark - TCNSignpostTraceBackend
+
+@interface TCNSignpostTraceBackend ()
+
+@property (nonatomic, strong, nonnull, readonly) os_log_t log;
+
+@end
+
+@implementation TCNSignpostTraceBackend
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _log = os_log_create("com.linkedin.tachyon", OS_LOG_CATEGORY_POINTS_OF_INTEREST);
+
+    return self;
+}
+
+// Signpost names must be string literals, so each name has its own call
+- (void)beginIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier {
+    switch (name) {
+        case TCNTraceNamePrepareLayout:
+            os_signpost_interval_begin(self.log, identifier, "prepareLayout");
+            break;
+        case TCNTraceNameOverlapAdjustment:
+            os_signpost_interval_begin(self.log, identifier, "overlapAdjustment");
+            break;
+        case TCNTraceNameElementsInRect:
+            os_signpost_interval_begin(self.log, identifier, "layoutAttributesForElementsInRect");
+            break;
+        case TCNTraceNameCellConfiguration:
+            os_signpost_interval_begin(self.log, identifier, "cellConfiguration");
+            break;
+        case TCNTraceNameReload:
+            os_signpost_interval_begin(self.log, identifier, "reload");
+            break;
+        case TCNTraceNameWeekRegeneration:
+            os_signpost_interval_begin(self.log, identifier, "weekRegeneration");
+            break;
+        case TCNTraceNameFirstFrame:
+            os_signpost_interval_begin(self.log, identifier, "firstFrame");
+            break;
+    }
+}
+
+- (void)endIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier {
+    switch (name) {
+        case TCNTraceNamePrepareLayout:
+            os_signpost_interval_end(self.log, identifier, "prepareLayout");
+            break;
+        case TCNTraceNameOverlapAdjustment:
+            os_signpost_interval_end(self.log, identifier, "overlapAdjustment");
+            break;
+        case TCNTraceNameElementsInRect:
+            os_signpost_interval_end(self.log, identifier, "layoutAttributesForElementsInRect");
+            break;
+        case TCNTraceNameCellConfiguration:
+            os_signpost_interval_end(self.log, identifier, "cellConfiguration");
+            break;
+        case TCNTraceNameReload:
+            os_signpost_interval_end(self.log, identifier, "reload");
+            break;
+        case TCNTraceNameWeekRegeneration:
+            os_signpost_interval_end(self.log, identifier, "weekRegeneration");
+            break;
+        case TCNTraceNameFirstFrame:
+            os_signpost_interval_end(self.log, identifier, "firstFrame");
+            break;
+    }
+}
+
+@end
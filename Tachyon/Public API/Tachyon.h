@@ -1,7 +1,14 @@
 #import <Foundation/Foundation.h>
 
+#import "TCNAvailabilityFinder.h"
 #import "TCNDatePickerView.h"
 #import "TCNDateUtil.h"
 #import "TCNDatePickerConfig.h"
 #import "TCNDayView.h"
 #import "TCNDayViewConfig.h"
+#import "TCNEventSnapshot.h"
+#import "TCNEventStore.h"
+#import "TCNPassMetrics.h"
+#import "TCNRecurrenceExpander.h"
+#import "TCNRecurrenceRule.h"
+#import "TCNTrace.h"
@@ -0,0 +1,25 @@
+#import <UIKit/UIKit.h>
+#import "TCNDayViewConfig.h"
+#import "TCNReusableView.h"
+
+/**
+ Displays the number of all day events on a day that don't fit in the rows of a @c TCNDayView's all day view.
+ */
+@interface TCNAllDayOverflowView : UICollectionReusableView <TCNDayViewConfigurable>
+
+/**
+ The reuse identifier for this view type.
+ */
+@property (nonatomic, copy, nonnull, class, readonly) NSString *reuseIdentifier;
+
+/**
+ The supplementary element kind of this view.
+ */
+@property (nonatomic, copy, nonnull, class, readonly) NSString *kind;
+
+/**
+ Setting this property updates the label, e.g. to "+3 more".
+ */
+@property (nonatomic, assign, readwrite) NSInteger hiddenEventCount;
+
+@end
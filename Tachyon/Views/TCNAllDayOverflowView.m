@@ -0,0 +1,65 @@
+#import "TCNAllDayOverflowView.h"
+
+@interface TCNAllDayOverflowView ()
+
+@property (nonatomic, strong, nonnull) UILabel *titleLabel;
+@property (nonatomic, copy, nonnull) NSString *overflowText;
+
+@end
+
+@implementation TCNAllDayOverflowView
+
+static const UIEdgeInsets Padding = {0.0f, 4.0f, 0.0f, 4.0f};
+
++ (nonnull NSString *)reuseIdentifier {
+    return NSStringFromClass([TCNAllDayOverflowView class]);
+}
+
++ (nonnull NSString *)kind {
+    return @"TCNAllDayOverflowViewKind";
+}
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithFrame:(CGRect)frame {
+    self = [super initWithFrame:frame];
+    if (!self) {
+        return nil;
+    }
+
+    _titleLabel = [[UILabel alloc] init];
+    _titleLabel.adjustsFontSizeToFitWidth = YES;
+    [self addSubview:_titleLabel];
+    _overflowText = @"";
+    return self;
+}
+
+#pragma mark - View lifecycle
+
+- (void)layoutSubviews {
+    [super layoutSubviews];
+
+    const CGRect bounds = self.bounds;
+    self.titleLabel.frame = CGRectMake(Padding.left, 0, bounds.size.width - Padding.right - Padding.left, bounds.size.height);
+}
+
+- (void)prepareForReuse {
+    [super prepareForReuse];
+    self.titleLabel.text = @"";
+}
+
+- (void)setHiddenEventCount:(NSInteger)hiddenEventCount {
+    _hiddenEventCount = hiddenEventCount;
+
+    self.titleLabel.text = [NSString stringWithFormat:@"+%ld %@", (long)hiddenEventCount, self.overflowText];
+}
+
+# pragma mark - TCNDayViewConfigurable
+
+- (void)applyStylingFromConfig:(TCNDayViewConfig *)config selected:(__unused BOOL)selected {
+    self.titleLabel.textColor = config.sidebarTextColor;
+    self.titleLabel.font = config.sidebarFont;
+    self.overflowText = config.allDayOverflowLabelText;
+}
+
+@end
@@ -1,6 +1,7 @@
 #import <UIKit/UIKit.h>
 
 #import "TCNDatePickerConfig.h"
+#import "TCNDayDensityCache.h"
 #import "TCNReusableView.h"
 
 /**
@@ -15,4 +16,9 @@
  */
 @property (nonatomic, strong, nonnull, readwrite) NSDate *date;
 
+/**
+ How busy the day is, shown as up to three dots below the date. No dots are shown for a day without events.
+ */
+@property (nonatomic, assign, readwrite) TCNDayDensity eventDensity;
+
 @end
@@ -1,4 +1,6 @@
 #import "TCNDatePickerDayView.h"
+#import "TCNDatePickerDayViewStyle.h"
+#import "TCNCalendarContext.h"
 #import "TCNDateFormatter.h"
 #import "TCNMacros.h"
 
@@ -6,11 +8,28 @@
 
 @property (nonatomic, strong, nonnull) UILabel *dayOfWeekLabel;
 @property (nonatomic, strong, nonnull) UILabel *dateLabel;
+@property (nonatomic, strong, nonnull) NSArray<UIView *> *densityDots;
+
+/**
+ The style last applied to the day, and whether it was applied to a weekend day. Labels and dots keep their styling
+ across reuse.
+ */
+@property (nonatomic, strong, nullable) TCNDatePickerDayViewStyle *appliedStyle;
+@property (nonatomic, assign) BOOL appliedStyleIsWeekend;
 
 @end
 
 @implementation TCNDatePickerDayView
 
+static const CGFloat DensityDotDiameter = 4.0f;
+static const CGFloat DensityDotSpacing = 3.0f;
+static const CGFloat DensityDotBottomMargin = 3.0f;
+
+/**
+ A day is shown with one more dot for every this many busy minutes, up to one dot per event.
+ */
+static const NSInteger BusyMinutesPerDensityDot = 120;
+
 #pragma mark - Properties
 
 + (nonnull NSString *)reuseIdentifier {
@@ -27,6 +46,8 @@
 
     _dayOfWeekLabel = [TCNDatePickerDayView labelWithDayView:self];
     _dateLabel = [TCNDatePickerDayView labelWithDayView:self];
+    _densityDots = [TCNDatePickerDayView densityDotsWithDayView:self];
+    _eventDensity = (TCNDayDensity){0, 0};
 
     return self;
 }
@@ -40,6 +61,29 @@
     return label;
 }
 
++ (nonnull NSArray<UIView *> *)densityDotsWithDayView:(nonnull TCNDatePickerDayView *)dayView {
+    NSMutableArray<UIView *> *const dots = [[NSMutableArray alloc] init];
+    for (NSInteger i = 0; i < 3; i++) {
+        UIView *const dot = [[UIView alloc] init];
+        dot.layer.cornerRadius = DensityDotDiameter / 2;
+        dot.hidden = YES;
+        [dayView.contentView addSubview:dot];
+        [dots addObject:dot];
+    }
+    return dots;
+}
+
+/**
+ The number of dots shown for @c density: one for any event, and more for busier days.
+ */
++ (NSUInteger)numberOfDensityDotsForDensity:(TCNDayDensity)density {
+    if (density.eventCount <= 0) {
+        return 0;
+    }
+    const NSInteger dotCount = MIN(1 + (density.busyMinutes / BusyMinutesPerDensityDot), density.eventCount);
+    return (NSUInteger)MIN(MAX(dotCount, 1), 3);
+}
+
 #pragma mark - View lifecycle
 
 - (void)prepareForReuse {
@@ -47,6 +91,7 @@
 
     self.dayOfWeekLabel.text = @"";
     self.dateLabel.text = @"";
+    self.eventDensity = (TCNDayDensity){0, 0};
 }
 
 - (void)layoutSubviews {
@@ -58,6 +103,23 @@
 
     CGFloat dayOfWeekBottom = self.dayOfWeekLabel.frame.size.height + self.dayOfWeekLabel.frame.origin.y;
     self.dateLabel.frame = CGRectMake(0, dayOfWeekBottom, width, height - dayOfWeekBottom);
+
+    const NSUInteger dotCount = [TCNDatePickerDayView numberOfDensityDotsForDensity:self.eventDensity];
+    const CGFloat dotsWidth = ((CGFloat)dotCount * DensityDotDiameter) + ((CGFloat)(MAX(dotCount, 1u) - 1) * DensityDotSpacing);
+    CGFloat dotX = (width - dotsWidth) / 2;
+    for (UIView *const dot in self.densityDots) {
+        dot.frame = CGRectMake(dotX, height - DensityDotBottomMargin - DensityDotDiameter, DensityDotDiameter, DensityDotDiameter);
+        dotX += DensityDotDiameter + DensityDotSpacing;
+    }
+}
+
+- (void)setEventDensity:(TCNDayDensity)eventDensity {
+    _eventDensity = eventDensity;
+    const NSUInteger dotCount = [TCNDatePickerDayView numberOfDensityDotsForDensity:eventDensity];
+    [self.densityDots enumerateObjectsUsingBlock:^(UIView *dot, NSUInteger index, __unused BOOL *stop) {
+        dot.hidden = index >= dotCount;
+    }];
+    [self setNeedsLayout];
 }
 
 - (void)setDate:(NSDate *)date {
@@ -71,13 +133,24 @@
 # pragma mark - LIDatePickerConfigurable
 
 - (void)applyStylingFromConfig:(TCNDatePickerConfig *)config selected:(BOOL)selected {
-    self.dayOfWeekLabel.font = config.secondaryFont;
-    self.dateLabel.font = config.primaryFont;
+    TCNDatePickerDayViewStyle *const style = [TCNDatePickerDayViewStyle styleWithConfig:config selected:selected];
+    const BOOL isWeekend = [TCNCalendarContext.sharedContext.calendar isDateInWeekend:self.date];
+    if (style == self.appliedStyle && isWeekend == self.appliedStyleIsWeekend) {
+        return;
+    }
 
-    UIColor *const unselectedColor = [[NSCalendar currentCalendar] isDateInWeekend:self.date] ? config.weekendTextColor : config.textColor;
+    self.dayOfWeekLabel.font = style.dayOfWeekFont;
+    self.dateLabel.font = style.dateFont;
+
+    UIColor *const textColor = isWeekend ? style.weekendTextColor : style.textColor;
+    self.dayOfWeekLabel.textColor = textColor;
+    self.dateLabel.textColor = textColor;
+    for (UIView *const dot in self.densityDots) {
+        dot.backgroundColor = style.densityDotColor;
+    }
 
-    self.dayOfWeekLabel.textColor = selected ? config.selectedTextColor : unselectedColor;
-    self.dateLabel.textColor = selected ? config.selectedTextColor : unselectedColor;
+    self.appliedStyle = style;
+    self.appliedStyleIsWeekend = isWeekend;
 }
 
 @end
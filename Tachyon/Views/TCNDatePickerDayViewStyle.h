@@ -0,0 +1,33 @@
+#import <UIKit/UIKit.h>
+#import "TCNDatePickerConfig.h"
+
+/**
+ The styling of a @c TCNDatePickerDayView, resolved once for a @c TCNDatePickerConfig and selection state and shared by
+ every day shown with them. A day view that already has a style skips restyling when it is given the same one again.
+ */
+@interface TCNDatePickerDayViewStyle : NSObject
+
+@property (nonatomic, strong, nonnull, readonly) UIFont *dayOfWeekFont;
+@property (nonatomic, strong, nonnull, readonly) UIFont *dateFont;
+
+/**
+ The color of the labels of weekdays and of weekend days.
+ */
+@property (nonatomic, strong, nonnull, readonly) UIColor *textColor;
+@property (nonatomic, strong, nonnull, readonly) UIColor *weekendTextColor;
+
+@property (nonatomic, strong, nonnull, readonly) UIColor *densityDotColor;
+
+/**
+ The style of days shown with @c config. Resolved the first time it is asked for, and again only once the config's
+ styling has changed.
+
+ @param config The configuration object for UI styling.
+ @param selected Whether the day is selected.
+ @return The shared style.
+ */
++ (nonnull TCNDatePickerDayViewStyle *)styleWithConfig:(nonnull TCNDatePickerConfig *)config selected:(BOOL)selected;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
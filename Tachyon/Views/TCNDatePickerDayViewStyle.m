@@ -0,0 +1,59 @@
+#import "TCNDatePickerDayViewStyle.h"
+#import "TCNStyleCache.h"
+
+@interface TCNDatePickerDayViewStyle ()
+
+@property (nonatomic, assign, readonly) BOOL selected;
+
+@end
+
+@implementation TCNDatePickerDayViewStyle
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithConfig:(nonnull TCNDatePickerConfig *)config selected:(BOOL)selected {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _selected = selected;
+    _dayOfWeekFont = config.secondaryFont;
+    _dateFont = config.primaryFont;
+    _textColor = selected ? config.selectedTextColor : config.textColor;
+    _weekendTextColor = selected ? config.selectedTextColor : config.weekendTextColor;
+    _densityDotColor = selected ? config.selectedTextColor : config.eventDensityColor;
+
+    return self;
+}
+
++ (nonnull TCNDatePickerDayViewStyle *)styleWithConfig:(nonnull TCNDatePickerConfig *)config selected:(BOOL)selected {
+    static TCNStyleCache<TCNDatePickerDayViewStyle *> *styles;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        styles = [[TCNStyleCache alloc] init];
+    });
+
+    TCNDatePickerDayViewStyle *const style = [styles styleForConfig:config selected:selected];
+    if (style && [style isResolvedFromConfig:config]) {
+        return style;
+    }
+    TCNDatePickerDayViewStyle *const resolvedStyle = [[TCNDatePickerDayViewStyle alloc] initWithConfig:config selected:selected];
+    [styles setStyle:resolvedStyle forConfig:config selected:selected];
+    return resolvedStyle;
+}
+
+#pragma mark - Methods
+
+/**
+ Whether the config still has the values this style was resolved from.
+ */
+- (BOOL)isResolvedFromConfig:(nonnull TCNDatePickerConfig *)config {
+    return self.dayOfWeekFont == config.secondaryFont
+        && self.dateFont == config.primaryFont
+        && self.textColor == (self.selected ? config.selectedTextColor : config.textColor)
+        && self.weekendTextColor == (self.selected ? config.selectedTextColor : config.weekendTextColor)
+        && self.densityDotColor == (self.selected ? config.selectedTextColor : config.eventDensityColor);
+}
+
+@end
@@ -0,0 +1,69 @@
+#import <UIKit/UIKit.h>
+#import "TCNDayViewConfig.h"
+
+/**
+ The measurements of a day view's time grid.
+ */
+typedef struct {
+
+    /**
+     The width of the column of hour labels.
+     */
+    CGFloat timeColumnWidth;
+
+    /**
+     The height of one hour, and of each hour label.
+     */
+    CGFloat hourHeight;
+
+    /**
+     The height of the dark and light gridlines.
+     */
+    CGFloat gridlineHeight;
+
+    /**
+     The number of hours in the grid. One more label is drawn, for the end of the last hour.
+     */
+    NSInteger numberOfHours;
+
+} TCNDayViewGridMetrics;
+
+/**
+ Draws the hour labels and gridlines of a @c TCNDayView into images, so that they can be displayed without a view per
+ label and gridline.
+
+ Images are cached by config, metrics and scale, and shared by every day view using the same @c TCNDayViewConfig. They
+ are drawn again when the config's colors or fonts are replaced, or the current locale changes. Neither depends on the
+ width of the day view. This should only be used on the main thread.
+ */
+@interface TCNDayViewGridRenderer : NSObject
+
+/**
+ The column of hour labels, one @c hourHeight tall label per hour, starting with the label centered on the first hour.
+ The column is filled with @c TCNDayViewConfig.sidebarColor, like @c TCNDayViewTimeView.
+
+ @param config The configuration object for UI styling.
+ @param metrics The measurements of the grid.
+ @param scale The scale of the screen the image is displayed on.
+ @return An image @c timeColumnWidth wide and @c hourHeight times @c numberOfHours + 1 tall.
+ */
++ (nonnull UIImage *)timeColumnImageForConfig:(nonnull TCNDayViewConfig *)config
+                                      metrics:(TCNDayViewGridMetrics)metrics
+                                        scale:(CGFloat)scale;
+
+/**
+ One hour of gridlines, to be tiled horizontally and vertically: a dark gridline at the top and a light gridline at
+ half the hour, on a clear background.
+
+ @param config The configuration object for UI styling.
+ @param metrics The measurements of the grid.
+ @param scale The scale of the screen the image is displayed on.
+ @return An image one point wide and @c hourHeight tall.
+ */
++ (nonnull UIImage *)gridlinePatternImageForConfig:(nonnull TCNDayViewConfig *)config
+                                           metrics:(TCNDayViewGridMetrics)metrics
+                                             scale:(CGFloat)scale;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
@@ -0,0 +1,187 @@
+#import "TCNDayViewGridRenderer.h"
+#import "TCNCalendarContext.h"
+#import "TCNDateFormatter.h"
+#import "TCNMacros.h"
+
+/**
+ A rendered image and the config values it was drawn with.
+ */
+@interface TCNDayViewGridCachedImage : NSObject
+
+@property (nonatomic, strong, nonnull, readonly) UIImage *image;
+@property (nonatomic, copy, nonnull, readonly) NSArray *styleValues;
+
+@end
+
+@implementation TCNDayViewGridCachedImage
+
+- (nonnull instancetype)initWithImage:(nonnull UIImage *)image styleValues:(nonnull NSArray *)styleValues {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _image = image;
+    _styleValues = [styleValues copy];
+
+    return self;
+}
+
+/**
+ Whether @c styleValues are the values this image was drawn with. Like the style bundles, values are compared by
+ identity, since a config's fonts and colors are replaced rather than mutated.
+ */
+- (BOOL)isDrawnWithStyleValues:(nonnull NSArray *)styleValues {
+    if (styleValues.count != self.styleValues.count) {
+        return NO;
+    }
+    for (NSUInteger index = 0; index < styleValues.count; index++) {
+        if (styleValues[index] != self.styleValues[index]) {
+            return NO;
+        }
+    }
+    return YES;
+}
+
+@end
+
+@implementation TCNDayViewGridRenderer
+
+/**
+ Matches the label padding of @c TCNDayViewTimeView.
+ */
+static const UIEdgeInsets TimeLabelPadding = {0.0f, 10.0f, 0.0f, 10.0f};
+
+#pragma mark - Class helpers
+
++ (nonnull UIImage *)timeColumnImageForConfig:(nonnull TCNDayViewConfig *)config
+                                      metrics:(TCNDayViewGridMetrics)metrics
+                                        scale:(CGFloat)scale {
+    NSString *const key = [NSString stringWithFormat:@"timeColumn-%@", [TCNDayViewGridRenderer keyForMetrics:metrics scale:scale]];
+    NSArray *const styleValues = @[config.sidebarColor, config.sidebarFont, config.sidebarTextColor];
+    return [TCNDayViewGridRenderer cachedImageForConfig:config key:key styleValues:styleValues render:^UIImage *{
+        const NSInteger numberOfLabels = metrics.numberOfHours + 1;
+        const CGSize size = CGSizeMake(metrics.timeColumnWidth, metrics.hourHeight * numberOfLabels);
+        return [[TCNDayViewGridRenderer rendererWithSize:size scale:scale] imageWithActions:^(UIGraphicsImageRendererContext *context) {
+            [config.sidebarColor setFill];
+            [context fillRect:(CGRect){CGPointZero, size}];
+
+            for (NSInteger hour = 0; hour < numberOfLabels; hour++) {
+                const CGRect labelFrame = CGRectMake(TimeLabelPadding.left,
+                                                     metrics.hourHeight * hour,
+                                                     metrics.timeColumnWidth - TimeLabelPadding.left - TimeLabelPadding.right,
+                                                     metrics.hourHeight);
+                [TCNDayViewGridRenderer drawTimeLabel:[TCNDayViewGridRenderer timeTextForHour:hour] inRect:labelFrame config:config];
+            }
+        }];
+    }];
+}
+
++ (nonnull UIImage *)gridlinePatternImageForConfig:(nonnull TCNDayViewConfig *)config
+                                           metrics:(TCNDayViewGridMetrics)metrics
+                                             scale:(CGFloat)scale {
+    NSString *const key = [NSString stringWithFormat:@"gridline-%@", [TCNDayViewGridRenderer keyForMetrics:metrics scale:scale]];
+    NSArray *const styleValues = @[config.gridlineDarkColor, config.gridlineLightColor];
+    return [TCNDayViewGridRenderer cachedImageForConfig:config key:key styleValues:styleValues render:^UIImage *{
+        const CGSize size = CGSizeMake(1.0f, metrics.hourHeight);
+        return [[TCNDayViewGridRenderer rendererWithSize:size scale:scale] imageWithActions:^(UIGraphicsImageRendererContext *context) {
+            [config.gridlineDarkColor setFill];
+            [context fillRect:CGRectMake(0, 0, size.width, metrics.gridlineHeight)];
+            [config.gridlineLightColor setFill];
+            [context fillRect:CGRectMake(0, metrics.hourHeight / 2, size.width, metrics.gridlineHeight)];
+        }];
+    }];
+}
+
+#pragma mark - Drawing
+
++ (nonnull UIGraphicsImageRenderer *)rendererWithSize:(CGSize)size scale:(CGFloat)scale {
+    UIGraphicsImageRendererFormat *const format = [[UIGraphicsImageRendererFormat alloc] init];
+    format.scale = scale;
+    format.opaque = NO;
+    return [[UIGraphicsImageRenderer alloc] initWithSize:size format:format];
+}
+
+/**
+ Draws @c text the way a @c TCNDayViewTimeView label shows it: right aligned, vertically centered, and shrunk to fit.
+ */
++ (void)drawTimeLabel:(nonnull NSString *)text inRect:(CGRect)rect config:(nonnull TCNDayViewConfig *)config {
+    NSMutableParagraphStyle *const paragraphStyle = [[NSMutableParagraphStyle alloc] init];
+    paragraphStyle.alignment = NSTextAlignmentRight;
+
+    UIFont *font = config.sidebarFont;
+    CGSize textSize = [text sizeWithAttributes:@{NSFontAttributeName: font}];
+    if (textSize.width > CGRectGetWidth(rect) && textSize.width > 0) {
+        font = [font fontWithSize:font.pointSize * CGRectGetWidth(rect) / textSize.width];
+        textSize = [text sizeWithAttributes:@{NSFontAttributeName: font}];
+    }
+
+    const CGRect textRect = CGRectMake(CGRectGetMinX(rect),
+                                       CGRectGetMidY(rect) - (textSize.height / 2),
+                                       CGRectGetWidth(rect),
+                                       textSize.height);
+    [text drawInRect:textRect withAttributes:@{NSFontAttributeName: font,
+                                               NSForegroundColorAttributeName: config.sidebarTextColor,
+                                               NSParagraphStyleAttributeName: paragraphStyle}];
+}
+
++ (nonnull NSString *)timeTextForHour:(NSInteger)hour {
+    NSDateComponents *const dateComponents = [[NSDateComponents alloc] init];
+    dateComponents.hour = hour;
+
+    NSDate *const date = [TCNCalendarContext.sharedContext.calendar dateFromComponents:dateComponents];
+    if (!date) {
+        TCN_ASSERT_FAILURE(@"No date created for hour %ld", (long)hour);
+        return @"";
+    }
+    return [TCNDateFormatter.sidebarTimeFormatter stringFromDate:TCN_FORCE_UNWRAP(date)];
+}
+
+#pragma mark - Caching
+
++ (nonnull NSString *)keyForMetrics:(TCNDayViewGridMetrics)metrics scale:(CGFloat)scale {
+    return [NSString stringWithFormat:@"%g-%g-%g-%ld@%g",
+            (double)metrics.timeColumnWidth,
+            (double)metrics.hourHeight,
+            (double)metrics.gridlineHeight,
+            (long)metrics.numberOfHours,
+            (double)scale];
+}
+
+/**
+ Returns the image cached for @c config under @c key, rendering it first if needed or if it was drawn with other
+ @c styleValues of the config. Images live as long as the config, and are all discarded when the current locale
+ changes, since the hour labels follow it.
+ */
++ (nonnull UIImage *)cachedImageForConfig:(nonnull TCNDayViewConfig *)config
+                                      key:(nonnull NSString *)key
+                              styleValues:(nonnull NSArray *)styleValues
+                                   render:(UIImage *_Nonnull (^_Nonnull)(void))render {
+    static NSMapTable<TCNDayViewConfig *, NSMutableDictionary<NSString *, TCNDayViewGridCachedImage *> *> *imagesByConfig;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        imagesByConfig = [NSMapTable weakToStrongObjectsMapTable];
+        [NSNotificationCenter.defaultCenter addObserverForName:NSCurrentLocaleDidChangeNotification
+                                                        object:nil
+                                                         queue:NSOperationQueue.mainQueue
+                                                    usingBlock:^(__unused NSNotification *notification) {
+            [imagesByConfig removeAllObjects];
+        }];
+    });
+
+    NSMutableDictionary<NSString *, TCNDayViewGridCachedImage *> *images = [imagesByConfig objectForKey:config];
+    if (!images) {
+        images = [[NSMutableDictionary alloc] init];
+        [imagesByConfig setObject:images forKey:config];
+    }
+
+    TCNDayViewGridCachedImage *const cachedImage = images[key];
+    if (cachedImage && [cachedImage isDrawnWithStyleValues:styleValues]) {
+        return cachedImage.image;
+    }
+    UIImage *const image = render();
+    images[key] = [[TCNDayViewGridCachedImage alloc] initWithImage:image styleValues:styleValues];
+    return image;
+}
+
+@end
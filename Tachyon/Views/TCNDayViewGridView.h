@@ -0,0 +1,21 @@
+#import <UIKit/UIKit.h>
+
+#import "TCNReusableView.h"
+
+/**
+ Displays the hour labels and gridlines of one @c TCNDayView section from pre-rendered images, in place of a
+ @c TCNDayViewTimeView per hour and a @c TCNDayViewGridlineView per gridline.
+ */
+@interface TCNDayViewGridView : UICollectionReusableView <TCNReusableView>
+
+/**
+ The reuse identifier for this decoration view.
+ */
+@property (nonatomic, copy, nonnull, class, readonly) NSString *reuseIdentifier;
+
+/**
+ A string identifier for the grid decoration view.
+ */
+@property (nonatomic, copy, nonnull, class, readonly) NSString *kind;
+
+@end
@@ -0,0 +1,57 @@
+#import "TCNDayViewGridView.h"
+#import "TCNDayViewGridLayoutAttributes.h"
+#import "TCNMacros.h"
+
+@interface TCNDayViewGridView ()
+
+@property (nonatomic, strong, nonnull, readonly) UIImageView *timeColumnView;
+@property (nonatomic, strong, nonnull, readonly) UIView *gridlineView;
+
+@end
+
+@implementation TCNDayViewGridView
+
++ (nonnull NSString *)reuseIdentifier {
+    return NSStringFromClass([TCNDayViewGridView class]);
+}
+
++ (nonnull NSString *)kind {
+    return @"TCNDayViewGridViewKind";
+}
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithFrame:(CGRect)frame {
+    self = [super initWithFrame:frame];
+    if (!self) {
+        return nil;
+    }
+
+    _gridlineView = [[UIView alloc] init];
+    _timeColumnView = [[UIImageView alloc] init];
+    [self addSubview:_gridlineView];
+    [self addSubview:_timeColumnView];
+    self.userInteractionEnabled = NO;
+
+    return self;
+}
+
+#pragma mark - UICollectionReusableView
+
+- (void)applyLayoutAttributes:(UICollectionViewLayoutAttributes *)layoutAttributes {
+    [super applyLayoutAttributes:layoutAttributes];
+
+    TCNDayViewGridLayoutAttributes *const attributes = TCN_CAST_OR_NIL(layoutAttributes, TCNDayViewGridLayoutAttributes);
+    if (!attributes) {
+        return;
+    }
+    self.timeColumnView.image = attributes.timeColumnImage;
+    self.timeColumnView.frame = attributes.timeColumnFrame;
+
+    // A pattern color is tiled from the view's origin, which is the first dark gridline
+    UIImage *const gridlinePatternImage = attributes.gridlinePatternImage;
+    self.gridlineView.backgroundColor = gridlinePatternImage ? [UIColor colorWithPatternImage:TCN_FORCE_UNWRAP(gridlinePatternImage)] : nil;
+    self.gridlineView.frame = attributes.gridlineFrame;
+}
+
+@end
@@ -1,11 +1,17 @@
 #import "TCNDayViewTimeView.h"
 #import "TCNDateFormatter.h"
+#import "TCNDayViewTimeViewStyle.h"
 
 @interface TCNDayViewTimeView ()
 
 @property (nonatomic, strong, nonnull) UILabel *titleLabel;
 @property (nonatomic, copy, nullable) NSString *allDayText;
 
+/**
+ The style last applied to the view, which its label keeps across reuse.
+ */
+@property (nonatomic, strong, nullable) TCNDayViewTimeViewStyle *appliedStyle;
+
 @end
 
 @implementation TCNDayViewTimeView
@@ -67,10 +73,16 @@ static const UIEdgeInsets Padding = {0.0f, 10.0f, 0.0f, 10.0f};
 # pragma mark - TCNDayViewConfigurable
 
 - (void)applyStylingFromConfig:(TCNDayViewConfig *)config selected:(__unused BOOL)selected {
-    self.backgroundColor = config.sidebarColor;
-    self.titleLabel.textColor = config.sidebarTextColor;
-    self.titleLabel.font = config.sidebarFont;
-    self.allDayText = config.allDayLabelText;
+    TCNDayViewTimeViewStyle *const style = [TCNDayViewTimeViewStyle styleWithConfig:config];
+    if (style == self.appliedStyle) {
+        return;
+    }
+
+    self.backgroundColor = style.backgroundColor;
+    self.titleLabel.textColor = style.textColor;
+    self.titleLabel.font = style.font;
+    self.allDayText = style.allDayText;
+    self.appliedStyle = style;
 }
 
 @end
@@ -0,0 +1,30 @@
+#import <UIKit/UIKit.h>
+#import "TCNDayViewConfig.h"
+
+/**
+ The styling of a @c TCNDayViewTimeView, resolved once for a @c TCNDayViewConfig and shared by every time view shown with
+ it. A time view that already has a style skips restyling when it is given the same one again.
+ */
+@interface TCNDayViewTimeViewStyle : NSObject
+
+@property (nonatomic, strong, nonnull, readonly) UIColor *backgroundColor;
+@property (nonatomic, strong, nonnull, readonly) UIColor *textColor;
+@property (nonatomic, strong, nonnull, readonly) UIFont *font;
+
+/**
+ The text shown by the all day view's time view.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSString *allDayText;
+
+/**
+ The style of time views shown with @c config. Resolved the first time it is asked for, and again only once the config's
+ sidebar styling has changed.
+
+ @param config The configuration object for UI styling.
+ @return The shared style.
+ */
++ (nonnull TCNDayViewTimeViewStyle *)styleWithConfig:(nonnull TCNDayViewConfig *)config;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
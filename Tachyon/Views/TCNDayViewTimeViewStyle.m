@@ -0,0 +1,50 @@
+#import "TCNDayViewTimeViewStyle.h"
+#import "TCNStyleCache.h"
+
+@implementation TCNDayViewTimeViewStyle
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithConfig:(nonnull TCNDayViewConfig *)config {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _backgroundColor = config.sidebarColor;
+    _textColor = config.sidebarTextColor;
+    _font = config.sidebarFont;
+    _allDayText = [config.allDayLabelText copy];
+
+    return self;
+}
+
++ (nonnull TCNDayViewTimeViewStyle *)styleWithConfig:(nonnull TCNDayViewConfig *)config {
+    static TCNStyleCache<TCNDayViewTimeViewStyle *> *styles;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        styles = [[TCNStyleCache alloc] init];
+    });
+
+    TCNDayViewTimeViewStyle *const style = [styles styleForConfig:config selected:NO];
+    if (style && [style isResolvedFromConfig:config]) {
+        return style;
+    }
+    TCNDayViewTimeViewStyle *const resolvedStyle = [[TCNDayViewTimeViewStyle alloc] initWithConfig:config];
+    [styles setStyle:resolvedStyle forConfig:config selected:NO];
+    return resolvedStyle;
+}
+
+#pragma mark - Methods
+
+/**
+ Whether the config still has the values this style was resolved from.
+ */
+- (BOOL)isResolvedFromConfig:(nonnull TCNDayViewConfig *)config {
+    return self.backgroundColor == config.sidebarColor
+        && self.textColor == config.sidebarTextColor
+        && self.font == config.sidebarFont
+        && [self.allDayText isEqualToString:config.allDayLabelText];
+}
+
+@end
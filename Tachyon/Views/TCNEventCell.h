@@ -1,6 +1,21 @@
 #import <UIKit/UIKit.h>
 #import "TCNEvent.h"
 #import "TCNDayViewConfig.h"
+#import "TCNEventDisplayModel.h"
+
+/**
+ How much of an event a cell shows, depending on how tall it is, e.g. as the day view is zoomed out.
+ */
+typedef NS_ENUM(NSInteger, TCNEventCellDetailLevel) {
+
+    /** The full title, wrapped over as many lines as fit, and the time. */
+    TCNEventCellDetailLevelFull,
+    /** One line of title and the time. */
+    TCNEventCellDetailLevelCompact,
+    /** One line of title only. */
+    TCNEventCellDetailLevelTitleOnly
+
+};
 
 /**
  Represents a @c TCNEvent on a @c TCNDayView.
@@ -12,16 +27,80 @@
  */
 @property (nonatomic, copy, nonnull, class, readonly) NSString *reuseIdentifier;
 
+/**
+ How much of its event the cell shows at its current height. Updated during layout.
+ */
+@property (nonatomic, assign, readonly) TCNEventCellDetailLevel detailLevel;
+
 /**
  A code block that is called when the cancel "x" button is tapped on an event cell.
  */
 @property (nonatomic, copy, nullable, readwrite) void(^cancelHandler)(void);
 
 /**
- Populates the cell with the given @c TCNEvent.
+ Measures the titles of @c events on a background queue, so that cells of width @c cellWidth showing them don't measure
+ text on the main thread.
+
+ @param events The events that will be shown.
+ @param cellWidth The expected width of their cells.
+ @param config The configuration object for UI styling.
+ */
++ (void)prepareTextMeasurementsForEvents:(nonnull NSArray<TCNEvent *> *)events
+                               cellWidth:(CGFloat)cellWidth
+                                  config:(nonnull TCNDayViewConfig *)config;
+
+/**
+ How much of an event a cell of the given height shows, so that shorter cells drop lines rather than clip them.
+
+ @param height The height of the cell.
+ @param font The font its title and time are shown in.
+ @return The detail level of the cell.
+ */
++ (TCNEventCellDetailLevel)detailLevelForHeight:(CGFloat)height font:(nonnull UIFont *)font;
+
+/**
+ Builds everything a cell of width @c cellWidth shows for @c event, including the size of its title. Call on the main
+ thread only, since it reads @c config, which the app changes on the main thread.
+
+ @param event The event to display. Its current @c isSelected value is captured in the model.
+ @param config The configuration object for UI styling.
+ @param cellWidth The expected width of the cell, or 0 to leave the title to be measured during layout.
+ @return A display model to apply with @c applyDisplayModel:.
+ */
++ (nonnull TCNEventDisplayModel *)displayModelForEvent:(nonnull TCNEvent *)event
+                                                config:(nonnull TCNDayViewConfig *)config
+                                             cellWidth:(CGFloat)cellWidth;
+
+/**
+ Builds the same display model as @c displayModelForEvent:config:cellWidth: from a style resolved on the main thread.
+ Safe to call on any thread, so that display models can be prepared ahead of time in the background: the title is
+ measured with Core Text by @c TCNTextMeasurementCache, the times are formatted with the calling thread's formatter, and
+ no view or config is touched.
+
+ @param event The event to display.
+ @param style The style resolved for the event's selection, from @c +[TCNEventCellStyle styleWithConfig:selected:].
+ @param cellWidth The expected width of the cell, or 0 to leave the title to be measured during layout.
+ @return A display model to apply with @c applyDisplayModel:.
+ */
++ (nonnull TCNEventDisplayModel *)displayModelForEvent:(nonnull TCNEvent *)event
+                                                 style:(nonnull TCNEventCellStyle *)style
+                                             cellWidth:(CGFloat)cellWidth;
+
+/**
+ Populates the cell with the given @c TCNEvent. A cell already showing the event's name and times isn't updated or laid
+ out again.
 
  @param event A @c TCNEvent instance.
  */
 - (void)updateWithEvent:(nonnull TCNEvent *)event;
 
+/**
+ Populates and styles the cell from a prepared display model. Equivalent to @c updateWithEvent: followed by
+ @c applyStylingFromConfig:selected:, without formatting, resolving or measuring anything. Text and styling the cell
+ already shows are left as they are.
+
+ @param displayModel A model from @c displayModelForEvent:config:cellWidth:.
+ */
+- (void)applyDisplayModel:(nonnull TCNEventDisplayModel *)displayModel;
+
 @end
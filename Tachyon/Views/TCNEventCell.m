@@ -1,4 +1,6 @@
 #import "TCNEventCell.h"
+#import "TCNEventCellStyle.h"
+#import "TCNTextMeasurementCache.h"
 #import "TCNViewUtils.h"
 
 @interface TCNEventCell ()
@@ -14,6 +16,26 @@
  */
 @property (nonatomic, assign, readwrite) BOOL useCompactDisplay;
 
+@property (nonatomic, assign, readwrite) TCNEventCellDetailLevel detailLevel;
+
+/**
+ The title size measured for @c measuredTitleWidth, reused until the title, its font or the width changes.
+ A negative width means the title needs measuring.
+ */
+@property (nonatomic, assign, readwrite) CGSize measuredTitleSize;
+@property (nonatomic, assign, readwrite) CGFloat measuredTitleWidth;
+
+/**
+ The style last applied to the cell, which its labels and button keep across reuse.
+ */
+@property (nonatomic, strong, nullable, readwrite) TCNEventCellStyle *appliedStyle;
+
+/**
+ The times of the event last shown with @c updateWithEvent:, or nil if the cell's text came from a display model.
+ */
+@property (nonatomic, strong, nullable, readwrite) NSDate *displayedStartDateTime;
+@property (nonatomic, strong, nullable, readwrite) NSDate *displayedEndDateTime;
+
 @end
 
 @implementation TCNEventCell
@@ -37,6 +59,8 @@ static const NSInteger CornerRadius = 2.0f;
     }
 
     _useCompactDisplay = NO;
+    _detailLevel = TCNEventCellDetailLevelFull;
+    _measuredTitleWidth = -1;
     _titleLabel = [TCNEventCell labelWithSuperview:self];
     _timeLabel = [TCNEventCell labelWithSuperview:self];
     _cancelButton = [TCNEventCell cancelButtonWithSuperview:self];
@@ -49,10 +73,63 @@ static const NSInteger CornerRadius = 2.0f;
     _useCompactDisplay = useCompactDisplay;
     self.titleLabel.numberOfLines = useCompactDisplay ? 1 : 0;
     self.timeLabel.numberOfLines = useCompactDisplay ? 1 : 0;
+    self.measuredTitleWidth = -1;
 }
 
 #pragma mark - Class helpers
 
++ (void)prepareTextMeasurementsForEvents:(nonnull NSArray<TCNEvent *> *)events
+                               cellWidth:(CGFloat)cellWidth
+                                  config:(nonnull TCNDayViewConfig *)config {
+    // Compact events are a single line, so only the other titles are ever measured
+    NSMutableArray<NSString *> *const titles = [[NSMutableArray alloc] init];
+    for (TCNEvent *event in events) {
+        if (!event.isAllDay) {
+            [titles addObject:event.name];
+        }
+    }
+    [TCNTextMeasurementCache.sharedCache prepareSizesForTexts:titles
+                                                         font:config.eventFont
+                                                        width:cellWidth - (2 * SidePadding)
+                                                numberOfLines:0];
+}
+
++ (TCNEventCellDetailLevel)detailLevelForHeight:(CGFloat)height font:(nonnull UIFont *)font {
+    if (height < TopPadding + (2 * font.lineHeight)) {
+        return TCNEventCellDetailLevelTitleOnly;
+    } else if (height < TopPadding + (3 * font.lineHeight)) {
+        return TCNEventCellDetailLevelCompact;
+    }
+    return TCNEventCellDetailLevelFull;
+}
+
++ (nonnull TCNEventDisplayModel *)displayModelForEvent:(nonnull TCNEvent *)event
+                                                config:(nonnull TCNDayViewConfig *)config
+                                             cellWidth:(CGFloat)cellWidth {
+    return [TCNEventCell displayModelForEvent:event
+                                        style:[TCNEventCellStyle styleWithConfig:config selected:event.isSelected]
+                                    cellWidth:cellWidth];
+}
+
++ (nonnull TCNEventDisplayModel *)displayModelForEvent:(nonnull TCNEvent *)event
+                                                 style:(nonnull TCNEventCellStyle *)style
+                                             cellWidth:(CGFloat)cellWidth {
+    const BOOL useCompactDisplay = event.isAllDay;
+
+    // Compact titles are laid out at the full width of the cell, so only the other titles are measured
+    const CGFloat titleWidth = useCompactDisplay ? 0 : MAX(0, cellWidth - (2 * SidePadding));
+    const CGSize titleSize = titleWidth > 0
+        ? [TCNTextMeasurementCache.sharedCache sizeForText:event.name font:style.font width:titleWidth numberOfLines:0]
+        : CGSizeZero;
+
+    return [[TCNEventDisplayModel alloc] initWithTitle:event.name
+                                              timeText:event.displayTimeString
+                                     useCompactDisplay:useCompactDisplay
+                                                 style:style
+                                             titleSize:titleSize
+                                            titleWidth:titleWidth];
+}
+
 + (nonnull UILabel *)labelWithSuperview:(nonnull UICollectionViewCell *)superview {
     UILabel *const label = [[UILabel alloc] init];
     label.textAlignment = NSTextAlignmentNatural;
@@ -78,24 +155,30 @@ static const NSInteger CornerRadius = 2.0f;
 
     self.layer.cornerRadius = CornerRadius;
 
+    const CGFloat titleWidth = self.bounds.size.width - (2 * SidePadding);
     self.titleLabel.frame = CGRectMake(
        SidePadding,
        TopPadding,
-       self.bounds.size.width - (2 * SidePadding),
+       titleWidth,
        self.bounds.size.height - (2 * TopPadding));
 
+    self.detailLevel = [TCNEventCell detailLevelForHeight:self.bounds.size.height font:self.titleLabel.font];
     if (!self.useCompactDisplay) {
-        [self.titleLabel sizeToFit];
+        const CGSize titleSize = [self titleSizeForWidth:titleWidth];
 
         // We can't allow the titleLabel's frame to exceed that of the cell itself, or it will not truncate correctly.
+        // Shorter cells keep to one line, so that the time still fits below it.
+        const CGFloat maximumTitleHeight = self.detailLevel == TCNEventCellDetailLevelFull
+            ? self.frame.size.height
+            : self.titleLabel.font.lineHeight;
         self.titleLabel.frame = CGRectMake(
             self.titleLabel.frame.origin.x,
             self.titleLabel.frame.origin.y,
-            self.titleLabel.frame.size.width,
-            MIN(self.frame.size.height, self.titleLabel.frame.size.height));
+            titleSize.width,
+            MIN(maximumTitleHeight, titleSize.height));
     }
 
-    if (self.useCompactDisplay) {
+    if (self.useCompactDisplay || self.detailLevel == TCNEventCellDetailLevelTitleOnly) {
         self.timeLabel.frame = CGRectZero;
     } else {
         const CGFloat titleLabelMaxY = TopPadding + self.titleLabel.frame.size.height;
@@ -121,21 +204,106 @@ static const NSInteger CornerRadius = 2.0f;
     [TCNViewUtils layoutSubviewsForRTL:self];
 }
 
+/**
+ The size the title label would take from @c sizeToFit at @c width, measured at most once per title, font and width.
+ */
+- (CGSize)titleSizeForWidth:(CGFloat)width {
+    if (self.measuredTitleWidth == width) {
+        return self.measuredTitleSize;
+    }
+
+    self.measuredTitleSize = [TCNTextMeasurementCache.sharedCache sizeForText:self.titleLabel.text ?: @""
+                                                                         font:self.titleLabel.font
+                                                                        width:width
+                                                                numberOfLines:self.titleLabel.numberOfLines];
+    self.measuredTitleWidth = width;
+    return self.measuredTitleSize;
+}
+
 - (void)prepareForReuse {
     [super prepareForReuse];
 
     self.titleLabel.text = @"";
     self.timeLabel.text = @"";
+    self.measuredTitleWidth = -1;
+    self.displayedStartDateTime = nil;
+    self.displayedEndDateTime = nil;
 }
 
 - (void)updateWithEvent:(nonnull TCNEvent *)event {
-    self.titleLabel.text = event.name;
-    self.timeLabel.text = event.displayTimeString;
-    self.useCompactDisplay = event.isAllDay;
+    // The time text is only formatted when the times change
+    if ([self.displayedStartDateTime isEqualToDate:event.startDateTime]
+        && [self.displayedEndDateTime isEqualToDate:event.endDateTime]
+        && [self.titleLabel.text isEqualToString:event.name]
+        && self.useCompactDisplay == event.isAllDay) {
+        return;
+    }
+
+    [self updateWithTitle:event.name timeText:event.displayTimeString useCompactDisplay:event.isAllDay];
+    self.displayedStartDateTime = event.startDateTime;
+    self.displayedEndDateTime = event.endDateTime;
+}
+
+- (void)applyDisplayModel:(nonnull TCNEventDisplayModel *)displayModel {
+    [self updateWithTitle:displayModel.title timeText:displayModel.timeText useCompactDisplay:displayModel.useCompactDisplay];
+    self.displayedStartDateTime = nil;
+    self.displayedEndDateTime = nil;
+    [self applyStyle:displayModel.style];
+
+    // The model measured the same title in the same font, so its measurement can replace the cell's
+    if (displayModel.titleWidth > 0) {
+        self.measuredTitleSize = displayModel.titleSize;
+        self.measuredTitleWidth = displayModel.titleWidth;
+    }
+}
+
+/**
+ Shows the given text, unless the cell already shows it, in which case it isn't laid out again.
+ */
+- (void)updateWithTitle:(nonnull NSString *)title timeText:(nonnull NSString *)timeText useCompactDisplay:(BOOL)useCompactDisplay {
+    const BOOL titleChanged = ![self.titleLabel.text isEqualToString:title];
+    if (!titleChanged && [self.timeLabel.text isEqualToString:timeText] && self.useCompactDisplay == useCompactDisplay) {
+        return;
+    }
+
+    if (titleChanged) {
+        self.measuredTitleWidth = -1;
+    }
+    self.titleLabel.text = title;
+    self.timeLabel.text = timeText;
+    self.useCompactDisplay = useCompactDisplay;
 
     [self setNeedsLayout];
 }
 
+/**
+ Styles the cell, unless it already has @c style.
+ */
+- (void)applyStyle:(nonnull TCNEventCellStyle *)style {
+    if (style == self.appliedStyle) {
+        return;
+    }
+
+    self.contentView.backgroundColor = style.backgroundColor;
+    self.titleLabel.textColor = style.textColor;
+    if (![self.titleLabel.font isEqual:style.font]) {
+        self.measuredTitleWidth = -1;
+    }
+    self.titleLabel.font = style.font;
+    self.timeLabel.textColor = style.textColor;
+    self.timeLabel.font = style.font;
+    self.cancelButton.tintColor = style.cancelButtonTintColor;
+
+    self.timeLabel.hidden = !style.showsTimeLabel;
+    self.cancelButton.hidden = !style.showsCancelButton;
+    if (style.cancelButtonImage) {
+        [self.cancelButton setImage:style.cancelButtonImage forState:UIControlStateNormal];
+    }
+
+    self.appliedStyle = style;
+    [self setNeedsLayout];
+}
+
 #pragma mark - Methods and Property Overrides
 
 - (void)setCancelHandler:(void (^_Nullable)(void))cancelHandler {
@@ -154,22 +322,7 @@ static const NSInteger CornerRadius = 2.0f;
 # pragma mark - TCNDayViewConfigurable
 
 - (void)applyStylingFromConfig:(nonnull TCNDayViewConfig *)config selected:(BOOL)selected {
-    self.contentView.backgroundColor = selected ? config.selectedEventColor : config.eventColor;
-    self.titleLabel.textColor = selected ? config.selectedEventTextColor : config.eventTextColor;
-    self.titleLabel.font = config.eventFont;
-
-    self.timeLabel.textColor = selected ? config.selectedEventTextColor : config.eventTextColor;
-    self.timeLabel.font = config.eventFont;
-
-    self.cancelButton.tintColor = config.selectedEventTextColor;
-
-    self.timeLabel.hidden = !selected;
-    self.cancelButton.hidden = !(selected && config.shouldShowCancelButtonOnCreatedEvents);
-
-    UIImage *const image = [config.cancelButtonImage imageWithRenderingMode:(UIImageRenderingModeAlwaysTemplate)];
-    if (image) {
-        [self.cancelButton setImage:image forState:UIControlStateNormal];
-    }
+    [self applyStyle:[TCNEventCellStyle styleWithConfig:config selected:selected]];
 }
 
 @end
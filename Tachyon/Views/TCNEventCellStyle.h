@@ -0,0 +1,42 @@
+#import <UIKit/UIKit.h>
+#import "TCNDayViewConfig.h"
+
+/**
+ The styling of a @c TCNEventCell, resolved once for a @c TCNDayViewConfig and selection state and shared by every cell
+ shown with them. A cell that already has a style skips restyling when it is given the same one again.
+
+ Styles are immutable, so they can be resolved on any thread.
+ */
+@interface TCNEventCellStyle : NSObject
+
+/**
+ Whether the style is for selected events. Selected and unselected events differ in color and visible controls.
+ */
+@property (nonatomic, assign, readonly) BOOL selected;
+
+@property (nonatomic, strong, nonnull, readonly) UIColor *backgroundColor;
+@property (nonatomic, strong, nonnull, readonly) UIColor *textColor;
+@property (nonatomic, strong, nonnull, readonly) UIColor *cancelButtonTintColor;
+@property (nonatomic, strong, nonnull, readonly) UIFont *font;
+
+/**
+ The cancel button image, already in template rendering mode.
+ */
+@property (nonatomic, strong, nullable, readonly) UIImage *cancelButtonImage;
+
+@property (nonatomic, assign, readonly) BOOL showsTimeLabel;
+@property (nonatomic, assign, readonly) BOOL showsCancelButton;
+
+/**
+ The style of events shown with @c config. Resolved the first time it is asked for, and again only once the config's
+ event styling has changed. Safe to call on any thread.
+
+ @param config The configuration object for UI styling.
+ @param selected Whether the events are selected.
+ @return The shared style.
+ */
++ (nonnull TCNEventCellStyle *)styleWithConfig:(nonnull TCNDayViewConfig *)config selected:(BOOL)selected;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
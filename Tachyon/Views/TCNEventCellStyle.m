@@ -0,0 +1,73 @@
+#import "TCNEventCellStyle.h"
+#import "TCNStyleCache.h"
+
+@interface TCNEventCellStyle ()
+
+/**
+ The config's cancel button image the template image was made from.
+ */
+@property (nonatomic, strong, nullable, readonly) UIImage *sourceCancelButtonImage;
+
+@end
+
+@implementation TCNEventCellStyle
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithConfig:(nonnull TCNDayViewConfig *)config selected:(BOOL)selected {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _selected = selected;
+    _backgroundColor = selected ? config.selectedEventColor : config.eventColor;
+    _textColor = selected ? config.selectedEventTextColor : config.eventTextColor;
+    _cancelButtonTintColor = config.selectedEventTextColor;
+    _font = config.eventFont;
+    _sourceCancelButtonImage = config.cancelButtonImage;
+    _cancelButtonImage = [config.cancelButtonImage imageWithRenderingMode:(UIImageRenderingModeAlwaysTemplate)];
+    _showsTimeLabel = selected;
+    _showsCancelButton = selected && config.shouldShowCancelButtonOnCreatedEvents;
+
+    return self;
+}
+
++ (nonnull TCNEventCellStyle *)styleWithConfig:(nonnull TCNDayViewConfig *)config selected:(BOOL)selected {
+    static TCNStyleCache<TCNEventCellStyle *> *styles;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        styles = [[TCNStyleCache alloc] init];
+    });
+
+    TCNEventCellStyle *const style = [styles styleForConfig:config selected:selected];
+    if (style && [style isResolvedFromConfig:config]) {
+        return style;
+    }
+    TCNEventCellStyle *const resolvedStyle = [[TCNEventCellStyle alloc] initWithConfig:config selected:selected];
+    [styles setStyle:resolvedStyle forConfig:config selected:selected];
+    return resolvedStyle;
+}
+
+#pragma mark - Methods
+
+/**
+ Whether the config still has the values this style was resolved from. Compares identities only, so that checking a
+ shared style costs a few property reads.
+ */
+- (BOOL)isResolvedFromConfig:(nonnull TCNDayViewConfig *)config {
+    return self.backgroundColor == (self.selected ? config.selectedEventColor : config.eventColor)
+        && self.textColor == (self.selected ? config.selectedEventTextColor : config.eventTextColor)
+        && self.cancelButtonTintColor == config.selectedEventTextColor
+        && self.font == config.eventFont
+        && self.sourceCancelButtonImage == config.cancelButtonImage
+        && self.showsCancelButton == (self.selected && config.shouldShowCancelButtonOnCreatedEvents);
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"TCNEventCellStyle {\nselected: %d\nfont: %@\n}", self.selected, self.font];
+}
+
+@end
@@ -0,0 +1,47 @@
+#import <UIKit/UIKit.h>
+#import "TCNEventCellStyle.h"
+
+/**
+ Everything a @c TCNEventCell shows for one event, computed ahead of time so that configuring a cell only assigns values.
+
+ Display models are immutable, so they can be built on any thread and shared between cells.
+ */
+@interface TCNEventDisplayModel : NSObject
+
+/**
+ The text of the title label.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSString *title;
+
+/**
+ The text of the time label.
+ */
+@property (nonatomic, copy, nonnull, readonly) NSString *timeText;
+
+/**
+ Whether the event displays as a single line without a time label.
+ */
+@property (nonatomic, assign, readonly) BOOL useCompactDisplay;
+
+/**
+ The shared style of the event's cell, which differs for selected and unselected events.
+ */
+@property (nonatomic, strong, nonnull, readonly) TCNEventCellStyle *style;
+
+/**
+ The size of the title label, measured for a title label @c titleWidth wide. A @c titleWidth of 0 means the title has not
+ been measured.
+ */
+@property (nonatomic, assign, readonly) CGSize titleSize;
+@property (nonatomic, assign, readonly) CGFloat titleWidth;
+
+- (nonnull instancetype)initWithTitle:(nonnull NSString *)title
+                             timeText:(nonnull NSString *)timeText
+                    useCompactDisplay:(BOOL)useCompactDisplay
+                                style:(nonnull TCNEventCellStyle *)style
+                            titleSize:(CGSize)titleSize
+                           titleWidth:(CGFloat)titleWidth NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
@@ -0,0 +1,38 @@
+#import "TCNEventDisplayModel.h"
+
+@implementation TCNEventDisplayModel
+
+#pragma mark - Initialization
+
+- (nonnull instancetype)initWithTitle:(nonnull NSString *)title
+                             timeText:(nonnull NSString *)timeText
+                    useCompactDisplay:(BOOL)useCompactDisplay
+                                style:(nonnull TCNEventCellStyle *)style
+                            titleSize:(CGSize)titleSize
+                           titleWidth:(CGFloat)titleWidth {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _title = [title copy];
+    _timeText = [timeText copy];
+    _useCompactDisplay = useCompactDisplay;
+    _style = style;
+    _titleSize = titleSize;
+    _titleWidth = titleWidth;
+
+    return self;
+}
+
+#pragma mark - NSObject
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"TCNEventDisplayModel {\ntitle: %@\ntimeText: %@\nuseCompactDisplay: %d\nselected: %d\n}",
+            self.title,
+            self.timeText,
+            self.useCompactDisplay,
+            self.style.selected];
+}
+
+@end
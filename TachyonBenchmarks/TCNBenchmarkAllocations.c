@@ -0,0 +1,52 @@
+#include "TCNBenchmarkAllocations.h"
+
+// The benchmark is single threaded, so the counters don't need to be atomic
+static TCNBenchmarkAllocations TCNBenchmarkAllocationCounters;
+
+void *TCNBenchmarkMalloc(size_t size) {
+    void *const pointer = malloc(size);
+    if (pointer) {
+        TCNBenchmarkAllocationCounters.allocationCount++;
+        TCNBenchmarkAllocationCounters.allocatedBytes += size;
+        TCNBenchmarkAllocationCounters.liveAllocationCount++;
+    }
+    return pointer;
+}
+
+void *TCNBenchmarkCalloc(size_t count, size_t size) {
+    void *const pointer = calloc(count, size);
+    if (pointer) {
+        TCNBenchmarkAllocationCounters.allocationCount++;
+        TCNBenchmarkAllocationCounters.allocatedBytes += count * size;
+        TCNBenchmarkAllocationCounters.liveAllocationCount++;
+    }
+    return pointer;
+}
+
+void *TCNBenchmarkRealloc(void *pointer, size_t size) {
+    void *const newPointer = realloc(pointer, size);
+    if (newPointer) {
+        // A reallocation is counted as a new allocation, and as freeing the old one
+        TCNBenchmarkAllocationCounters.allocationCount++;
+        TCNBenchmarkAllocationCounters.allocatedBytes += size;
+        if (!pointer) {
+            TCNBenchmarkAllocationCounters.liveAllocationCount++;
+        }
+    }
+    return newPointer;
+}
+
+void TCNBenchmarkFree(void *pointer) {
+    if (pointer) {
+        TCNBenchmarkAllocationCounters.liveAllocationCount--;
+    }
+    free(pointer);
+}
+
+TCNBenchmarkAllocations TCNBenchmarkAllocationsGet(void) {
+    return TCNBenchmarkAllocationCounters;
+}
+
+void TCNBenchmarkAllocationsReset(void) {
+    TCNBenchmarkAllocationCounters = (TCNBenchmarkAllocations){0, 0, 0};
+}
@@ -0,0 +1,51 @@
+#ifndef TCNBenchmarkAllocations_h
+#define TCNBenchmarkAllocations_h
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ The heap allocations made by the layout engines since the counters were last reset.
+ */
+typedef struct {
+    size_t allocationCount;
+    size_t allocatedBytes;
+
+    /**
+     The number of allocations less the number of frees, which is 0 for work that frees everything it allocates.
+     */
+    long liveAllocationCount;
+} TCNBenchmarkAllocations;
+
+/**
+ Counting replacements of the C allocator functions. The layout engines are compiled with this header included first
+ (@c -include), which routes their calls here without changing their sources or interposing the system allocator.
+ */
+void *TCNBenchmarkMalloc(size_t size);
+void *TCNBenchmarkCalloc(size_t count, size_t size);
+void *TCNBenchmarkRealloc(void *pointer, size_t size);
+void TCNBenchmarkFree(void *pointer);
+
+/**
+ @return The allocations counted since the last call to @c TCNBenchmarkAllocationsReset.
+ */
+TCNBenchmarkAllocations TCNBenchmarkAllocationsGet(void);
+
+void TCNBenchmarkAllocationsReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef TCN_BENCHMARK_COUNT_ALLOCATIONS
+#define malloc(size) TCNBenchmarkMalloc(size)
+#define calloc(count, size) TCNBenchmarkCalloc(count, size)
+#define realloc(pointer, size) TCNBenchmarkRealloc(pointer, size)
+#define free(pointer) TCNBenchmarkFree(pointer)
+#endif
+
+#endif /* TCNBenchmarkAllocations_h */
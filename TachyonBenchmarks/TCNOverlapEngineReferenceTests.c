@@ -0,0 +1,226 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "TCNOverlapEngine.h"
+
+/**
+ Checks @c TCNOverlapEngine against a C port of the @c NSPredicate based overlap adjustment that @c TCNDayViewLayout
+ used before the engine, so that the two can be compared headless on Linux as well as macOS; see run_engine_tests.sh.
+
+ The inputs are start ordered, like the events of a day view, and their clusters are either free of overlaps or have a
+ time that every interval in the cluster shares. Those are the inputs both algorithms place the same way; chained
+ clusters are intentionally laid out differently by the engine.
+ */
+
+#pragma mark - Reference
+
+/**
+ Item frames in a section all start with the same x and width, so two frames intersect when their vertical intervals do.
+ Like @c CGRectIntersectsRect, frames that only share an edge don't intersect, and neither does an empty frame.
+ */
+static int ReferenceIntersects(TCNOverlapInterval a, TCNOverlapInterval b) {
+    const double start = a.start > b.start ? a.start : b.start;
+    const double end = a.end < b.end ? a.end : b.end;
+    return start < end;
+}
+
+/**
+ Ports @c -adjustItemsForOverlap:inSection:sectionMinX:calendarGridMinX:calendarGridMaxX: as it was before
+ @c TCNOverlapEngine. Every adjusted item in one pass has the same width, so frames only intersect horizontally when they
+ share a column. The stack order is the item's zIndex above @c TCNDayViewLayoutZIndexEventItem.
+ */
+static int ReferenceComputePlacements(const TCNOverlapInterval *intervals, size_t count, TCNOverlapPlacement *placements) {
+    int *const adjusted = calloc(count, sizeof(int));
+    size_t *const overlapping = malloc(count * sizeof(size_t));
+    size_t *const divided = malloc(count * sizeof(size_t));
+    if (!adjusted || !overlapping || !divided) {
+        free(adjusted);
+        free(overlapping);
+        free(divided);
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        placements[i] = (TCNOverlapPlacement){0, 1, 0};
+    }
+
+    uint32_t sectionZ = 0;
+    for (size_t item = 0; item < count; item++) {
+        // If an item's already been adjusted, move on to the next one
+        if (adjusted[item]) {
+            continue;
+        }
+
+        // Find the other items that overlap with this item, after the item itself
+        size_t overlappingCount = 0;
+        overlapping[overlappingCount++] = item;
+        for (size_t other = 0; other < count; other++) {
+            if (other != item && ReferenceIntersects(intervals[item], intervals[other])) {
+                overlapping[overlappingCount++] = other;
+            }
+        }
+        if (overlappingCount < 2) {
+            continue;
+        }
+
+        double minY = INFINITY;
+        double maxY = -INFINITY;
+        for (size_t i = 0; i < overlappingCount; i++) {
+            minY = fmin(intervals[overlapping[i]].start, minY);
+            maxY = fmax(intervals[overlapping[i]].end, maxY);
+        }
+
+        // The most items covering any whole point of the set
+        uint32_t divisions = 1;
+        for (long currentY = lround(minY); currentY <= maxY; currentY++) {
+            uint32_t itemsForCurrentY = 0;
+            for (size_t i = 0; i < overlappingCount; i++) {
+                const TCNOverlapInterval interval = intervals[overlapping[i]];
+                if (currentY >= interval.start && currentY < interval.end) {
+                    itemsForCurrentY++;
+                }
+            }
+            divisions = itemsForCurrentY > divisions ? itemsForCurrentY : divisions;
+        }
+
+        size_t dividedCount = 0;
+        for (size_t i = 0; i < overlappingCount; i++) {
+            const size_t division = overlapping[i];
+            if (adjusted[division]) {
+                continue;
+            }
+
+            uint32_t column = 0;
+            uint32_t adjustments = 1;
+            for (size_t j = 0; j < dividedCount; j++) {
+                const size_t dividedItem = divided[j];
+                if (placements[dividedItem].column == column && ReferenceIntersects(intervals[dividedItem], intervals[division])) {
+                    column = adjustments;
+                    adjustments++;
+                }
+            }
+
+            placements[division] = (TCNOverlapPlacement){column, divisions, sectionZ++};
+            divided[dividedCount++] = division;
+            adjusted[division] = 1;
+        }
+    }
+
+    free(adjusted);
+    free(overlapping);
+    free(divided);
+    return 0;
+}
+
+#pragma mark - Checks
+
+static int CheckMatchesReference(const char *name, const TCNOverlapInterval *intervals, size_t count, int printsSuccess) {
+    TCNOverlapPlacement *const placements = malloc((count ? count : 1) * sizeof(TCNOverlapPlacement));
+    TCNOverlapPlacement *const expected = malloc((count ? count : 1) * sizeof(TCNOverlapPlacement));
+    if (!placements || !expected) {
+        free(placements);
+        free(expected);
+        fprintf(stderr, "%s: unable to allocate placements\n", name);
+        return 1;
+    }
+
+    int failures = 0;
+    if (TCNOverlapEngineComputePlacements(intervals, count, placements) != 0 ||
+        ReferenceComputePlacements(intervals, count, expected) != 0) {
+        fprintf(stderr, "%s: unable to compute placements\n", name);
+        failures++;
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            const TCNOverlapPlacement actual = placements[i];
+            const TCNOverlapPlacement reference = expected[i];
+            if (actual.column != reference.column || actual.columnCount != reference.columnCount ||
+                actual.stackOrder != reference.stackOrder) {
+                fprintf(stderr,
+                        "%s: interval %zu [%g, %g) was placed at column %u of %u, stack order %u; expected column %u of %u, stack order %u\n",
+                        name, i, intervals[i].start, intervals[i].end,
+                        actual.column, actual.columnCount, actual.stackOrder,
+                        reference.column, reference.columnCount, reference.stackOrder);
+                failures++;
+            }
+        }
+    }
+
+    free(placements);
+    free(expected);
+    if (failures || printsSuccess) {
+        printf("%s %s\n", failures ? "FAIL" : "ok  ", name);
+    }
+    return failures ? 1 : 0;
+}
+
+#define CHECK_INTERVALS(name, ...)                                                                                     \
+    do {                                                                                                               \
+        const TCNOverlapInterval intervals[] = {__VA_ARGS__};                                                          \
+        failedChecks += CheckMatchesReference(name, intervals, sizeof(intervals) / sizeof(intervals[0]), 1);           \
+    } while (0)
+
+/**
+ A small xorshift generator, so that the random inputs are the same on every platform.
+ */
+static uint32_t NextRandom(uint64_t *state, uint32_t bound) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return (uint32_t)(*state % bound);
+}
+
+/**
+ Builds start ordered clusters of intervals around a shared minute, with empty intervals mixed in, separated by gaps.
+ */
+static size_t RandomClusteredIntervals(uint64_t *state, TCNOverlapInterval *intervals, size_t capacity) {
+    size_t count = 0;
+    double clusterStart = 0;
+    const uint32_t clusterCount = 1 + NextRandom(state, 5);
+    for (uint32_t cluster = 0; cluster < clusterCount; cluster++) {
+        const double sharedMinute = clusterStart + 60;
+        const uint32_t clusterSize = 1 + NextRandom(state, 6);
+        double start = clusterStart;
+        for (uint32_t i = 0; i < clusterSize && count < capacity; i++) {
+            start += NextRandom(state, (uint32_t)(sharedMinute - start) + 1);
+            const double end = NextRandom(state, 8) == 0 ? start : sharedMinute + 1 + NextRandom(state, 60);
+            intervals[count++] = (TCNOverlapInterval){start, end};
+        }
+        clusterStart += 180;
+    }
+    return count;
+}
+
+int main(void) {
+    int failedChecks = 0;
+
+    CHECK_INTERVALS("single", {0, 60});
+    CHECK_INTERVALS("back-to-back", {0, 60}, {60, 120}, {120, 180});
+    CHECK_INTERVALS("back-to-back within a cluster", {0, 120}, {0, 60}, {60, 120});
+    CHECK_INTERVALS("identical", {0, 60}, {0, 60}, {0, 60});
+    CHECK_INTERVALS("nested", {0, 180}, {30, 60}, {90, 120}, {100, 110});
+    CHECK_INTERVALS("nested same start", {0, 180}, {0, 90}, {0, 30});
+    CHECK_INTERVALS("zero-length", {0, 60}, {30, 30}, {30, 90}, {90, 90}, {200, 200});
+    CHECK_INTERVALS("zero-length only", {30, 30}, {30, 30});
+    CHECK_INTERVALS("multi-cluster", {0, 60}, {0, 60}, {30, 90}, {120, 180}, {150, 210}, {300, 360}, {420, 480}, {450, 460});
+
+    enum { RandomCaseCount = 1000, RandomCaseCapacity = 30 };
+    uint64_t state = 42;
+    int failedRandomCases = 0;
+    for (int randomCase = 0; randomCase < RandomCaseCount; randomCase++) {
+        TCNOverlapInterval intervals[RandomCaseCapacity];
+        const size_t count = RandomClusteredIntervals(&state, intervals, RandomCaseCapacity);
+        char name[32];
+        snprintf(name, sizeof(name), "random %d", randomCase);
+        failedRandomCases += CheckMatchesReference(name, intervals, count, 0);
+    }
+    printf("%s %d random clustered inputs\n", failedRandomCases ? "FAIL" : "ok  ", RandomCaseCount);
+    failedChecks += failedRandomCases;
+
+    if (failedChecks) {
+        fprintf(stderr, "%d checks failed\n", failedChecks);
+        return 1;
+    }
+    return 0;
+}
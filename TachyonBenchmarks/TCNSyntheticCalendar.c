@@ -0,0 +1,147 @@
+#include "TCNSyntheticCalendar.h"
+
+#include <string.h>
+
+#pragma mark - Random numbers
+
+/**
+ A SplitMix64 generator, which gives the same sequence on every platform unlike @c rand or @c drand48.
+ */
+typedef struct {
+    uint64_t state;
+} TCNSyntheticCalendarRandom;
+
+static uint64_t TCNSyntheticCalendarRandomNext(TCNSyntheticCalendarRandom *random) {
+    uint64_t value = (random->state += 0x9e3779b97f4a7c15ull);
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+    return value ^ (value >> 31);
+}
+
+/**
+ @return A number in [minimum, maximum].
+ */
+static int64_t TCNSyntheticCalendarRandomInRange(TCNSyntheticCalendarRandom *random, int64_t minimum, int64_t maximum) {
+    return minimum + (int64_t)(TCNSyntheticCalendarRandomNext(random) % (uint64_t)(maximum - minimum + 1));
+}
+
+#pragma mark - Profiles
+
+typedef struct {
+    const char *name;
+    size_t dayCount;
+    size_t minimumEventCount;
+    size_t maximumEventCount;
+    size_t allDayEventCount;
+} TCNSyntheticCalendarProfileInfo;
+
+static const TCNSyntheticCalendarProfileInfo TCNSyntheticCalendarProfiles[TCNSyntheticCalendarProfileCount] = {
+    [TCNSyntheticCalendarProfileSparse] = {"sparse", 7, 2, 4, 2},
+    [TCNSyntheticCalendarProfileTypical] = {"typical", 7, 8, 14, 6},
+    [TCNSyntheticCalendarProfileBackToBack] = {"back-to-back", 7, 24, 24, 6},
+    [TCNSyntheticCalendarProfileHeavyOverlap] = {"heavy-overlap", 7, 60, 60, 40},
+    [TCNSyntheticCalendarProfileStress] = {"stress-10k", 1, 10000, 10000, 10000},
+};
+
+/**
+ Mixed into the seed of all day events, so that they don't repeat the sequence of any day's events.
+ */
+static const uint64_t AllDaySeed = 0x616c6c646179ull;
+
+static const int64_t MinutesPerDay = 24 * 60;
+
+const char *TCNSyntheticCalendarProfileName(TCNSyntheticCalendarProfile profile) {
+    return TCNSyntheticCalendarProfiles[profile].name;
+}
+
+int TCNSyntheticCalendarProfileWithName(const char *name, TCNSyntheticCalendarProfile *profile) {
+    for (int i = 0; i < TCNSyntheticCalendarProfileCount; i++) {
+        if (strcmp(TCNSyntheticCalendarProfiles[i].name, name) == 0) {
+            *profile = (TCNSyntheticCalendarProfile)i;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+size_t TCNSyntheticCalendarProfileDayCount(TCNSyntheticCalendarProfile profile) {
+    return TCNSyntheticCalendarProfiles[profile].dayCount;
+}
+
+size_t TCNSyntheticCalendarProfileMaximumEventCount(TCNSyntheticCalendarProfile profile) {
+    return TCNSyntheticCalendarProfiles[profile].maximumEventCount;
+}
+
+size_t TCNSyntheticCalendarProfileAllDayEventCount(TCNSyntheticCalendarProfile profile) {
+    return TCNSyntheticCalendarProfiles[profile].allDayEventCount;
+}
+
+#pragma mark - Generation
+
+size_t TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfile profile,
+                                       uint64_t seed,
+                                       int64_t day,
+                                       TCNEventGeometryInput *inputs) {
+    // Mix the day into the seed, so that every day has its own sequence
+    TCNSyntheticCalendarRandom dayRandom = {(uint64_t)day};
+    TCNSyntheticCalendarRandom random = {seed ^ TCNSyntheticCalendarRandomNext(&dayRandom)};
+
+    const TCNSyntheticCalendarProfileInfo info = TCNSyntheticCalendarProfiles[profile];
+    const size_t count = (size_t)TCNSyntheticCalendarRandomInRange(&random,
+                                                                   (int64_t)info.minimumEventCount,
+                                                                   (int64_t)info.maximumEventCount);
+    for (size_t i = 0; i < count; i++) {
+        TCNEventGeometryInput input = {0, 0, true};
+        switch (profile) {
+            case TCNSyntheticCalendarProfileSparse:
+                input.startMinute = TCNSyntheticCalendarRandomInRange(&random, 18, 33) * 30;
+                input.endMinute = input.startMinute + (TCNSyntheticCalendarRandomInRange(&random, 1, 2) * 30);
+                break;
+            case TCNSyntheticCalendarProfileTypical: {
+                static const int64_t Durations[] = {15, 30, 30, 45, 60, 60, 90};
+                input.startMinute = TCNSyntheticCalendarRandomInRange(&random, 32, 71) * 15;
+                input.endMinute = input.startMinute + Durations[TCNSyntheticCalendarRandomInRange(&random, 0, 6)];
+                input.shouldAdjustLayout = TCNSyntheticCalendarRandomInRange(&random, 0, 9) != 0;
+                break;
+            }
+            case TCNSyntheticCalendarProfileBackToBack:
+                input.startMinute = (8 * 60) + ((int64_t)i * 30);
+                input.endMinute = input.startMinute + 30;
+                break;
+            case TCNSyntheticCalendarProfileHeavyOverlap:
+                input.startMinute = TCNSyntheticCalendarRandomInRange(&random, 9 * 60, (12 * 60) - 1);
+                input.endMinute = input.startMinute + TCNSyntheticCalendarRandomInRange(&random, 60, 240);
+                break;
+            case TCNSyntheticCalendarProfileStress:
+                input.startMinute = TCNSyntheticCalendarRandomInRange(&random, 0, MinutesPerDay - 15);
+                input.endMinute = input.startMinute + TCNSyntheticCalendarRandomInRange(&random, 15, 240);
+                if (input.endMinute > MinutesPerDay) {
+                    input.endMinute = MinutesPerDay;
+                }
+                break;
+            case TCNSyntheticCalendarProfileCount:
+                break;
+        }
+        inputs[i] = input;
+    }
+
+    // Back-to-back events are generated in time order, but a data source doesn't have to return them that way
+    if (profile == TCNSyntheticCalendarProfileBackToBack) {
+        for (size_t i = count; i > 1; i--) {
+            const size_t j = (size_t)TCNSyntheticCalendarRandomInRange(&random, 0, (int64_t)i - 1);
+            const TCNEventGeometryInput input = inputs[i - 1];
+            inputs[i - 1] = inputs[j];
+            inputs[j] = input;
+        }
+    }
+    return count;
+}
+
+void TCNSyntheticCalendarGenerateAllDaySpans(TCNSyntheticCalendarProfile profile, uint64_t seed, TCNAllDayRowSpan *spans) {
+    TCNSyntheticCalendarRandom random = {seed ^ AllDaySeed};
+    const TCNSyntheticCalendarProfileInfo info = TCNSyntheticCalendarProfiles[profile];
+    for (size_t i = 0; i < info.allDayEventCount; i++) {
+        const int64_t firstDay = TCNSyntheticCalendarRandomInRange(&random, -2, (int64_t)info.dayCount - 1);
+        spans[i] = (TCNAllDayRowSpan){firstDay, firstDay + TCNSyntheticCalendarRandomInRange(&random, 0, 4)};
+    }
+}
@@ -0,0 +1,108 @@
+#ifndef TCNSyntheticCalendar_h
+#define TCNSyntheticCalendar_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "TCNAllDayRowEngine.h"
+#include "TCNEventGeometryEngine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ The shapes of calendar that the synthetic calendar generator can produce.
+ */
+typedef enum {
+    /**
+     A few short events per day during working hours that rarely overlap.
+     */
+    TCNSyntheticCalendarProfileSparse,
+
+    /**
+     A working day of meetings on quarter-hour boundaries, with occasional double bookings and events that keep their
+     full width.
+     */
+    TCNSyntheticCalendarProfileTypical,
+
+    /**
+     Half-hour meetings that follow each other without a gap, which touch but never overlap.
+     */
+    TCNSyntheticCalendarProfileBackToBack,
+
+    /**
+     Many long events crowded into one morning, so that nearly every event is in one large overlap cluster.
+     */
+    TCNSyntheticCalendarProfileHeavyOverlap,
+
+    /**
+     10,000 events of random length at random times of one day.
+     */
+    TCNSyntheticCalendarProfileStress,
+
+    TCNSyntheticCalendarProfileCount,
+} TCNSyntheticCalendarProfile;
+
+/**
+ @return The name of @c profile, e.g. "back-to-back".
+ */
+const char *TCNSyntheticCalendarProfileName(TCNSyntheticCalendarProfile profile);
+
+/**
+ Finds the profile with a name returned by @c TCNSyntheticCalendarProfileName.
+
+ @param name The name of the profile.
+ @param profile Set to the profile with @c name.
+ @return 0 on success, or -1 if there is no profile with @c name.
+ */
+int TCNSyntheticCalendarProfileWithName(const char *name, TCNSyntheticCalendarProfile *profile);
+
+/**
+ @return The number of days that a benchmark of @c profile lays out, e.g. a week for working day profiles.
+ */
+size_t TCNSyntheticCalendarProfileDayCount(TCNSyntheticCalendarProfile profile);
+
+/**
+ @return The largest number of events that @c TCNSyntheticCalendarGenerateDay produces for one day of @c profile.
+ */
+size_t TCNSyntheticCalendarProfileMaximumEventCount(TCNSyntheticCalendarProfile profile);
+
+/**
+ Generates the events of one day of @c profile.
+
+ The events are the same for the same profile, seed and day on every platform, and each day is generated independently,
+ so any day can be reproduced without the days before it. Events are written in the order a data source would return
+ them, which is not sorted by start time.
+
+ @param profile The profile to generate.
+ @param seed The seed of the calendar.
+ @param day The index of the day within the calendar.
+ @param inputs An output buffer with room for @c TCNSyntheticCalendarProfileMaximumEventCount(profile) events.
+ @return The number of events written to @c inputs.
+ */
+size_t TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfile profile,
+                                       uint64_t seed,
+                                       int64_t day,
+                                       TCNEventGeometryInput *inputs);
+
+/**
+ @return The number of all day events that @c TCNSyntheticCalendarGenerateAllDaySpans produces for @c profile.
+ */
+size_t TCNSyntheticCalendarProfileAllDayEventCount(TCNSyntheticCalendarProfile profile);
+
+/**
+ Generates the all day events shown over the days of @c profile, such as time off and conferences, as spans of 1 to 5
+ days. Some start before the first day, and are clipped to the days shown by @c TCNAllDayRowEngine.
+
+ @param profile The profile to generate.
+ @param seed The seed of the calendar.
+ @param spans An output buffer with room for @c TCNSyntheticCalendarProfileAllDayEventCount(profile) spans.
+ */
+void TCNSyntheticCalendarGenerateAllDaySpans(TCNSyntheticCalendarProfile profile, uint64_t seed, TCNAllDayRowSpan *spans);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TCNSyntheticCalendar_h */
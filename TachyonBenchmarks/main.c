@@ -0,0 +1,475 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "TCNAllDayRowEngine.h"
+#include "TCNBenchmarkAllocations.h"
+#include "TCNEventGeometryEngine.h"
+#include "TCNOverlapEngine.h"
+#include "TCNRectIndex.h"
+#include "TCNSyntheticCalendar.h"
+
+/**
+ A headless benchmark of the day view layout's geometry, which runs the same C engines as @c TCNDayViewLayout on
+ synthetic calendars and prints the results as JSON. It doesn't need UIKit, so it runs on Linux as well as Apple
+ platforms; see run_benchmarks.sh.
+
+ Each day of a calendar is one section of a day view, stacked horizontally at the section width as in the layout.
+ */
+
+#pragma mark - Layout model
+
+// The measurements of TCNDayViewLayout
+static const double HourHeight = 88;
+static const double TimeViewWidth = 56;
+static const double HorizontalGridlineHeight = 1;
+static const int HoursInDay = 24;
+static const double ContentMarginTop = 20;
+static const double ContentMarginBottom = 20;
+static const double CellMarginTop = 2;
+static const double CellMarginLeft = 0;
+static const double CellMarginBottom = 2;
+static const double CellMarginRight = 2;
+static const double EventRightInset = 2;
+
+/**
+ Each section has a time view and a dark gridline at every hour and a light gridline at every half hour.
+ */
+static const size_t StaticAttributesPerSection = (2 * 25) + 24;
+
+static const double ViewportHeight = 667;
+static const double ScrollStep = 8;
+
+/**
+ The all day view's row limit, which keeps two rows of events and a row of overflow counts.
+ */
+static const uint32_t AllDayMaximumRowCount = 3;
+
+static double SectionHeight(void) {
+    return ContentMarginTop + (HourHeight * HoursInDay) + ContentMarginBottom;
+}
+
+static TCNEventGeometryMetrics SectionMetrics(size_t section, double sectionWidth) {
+    const double sectionMinX = sectionWidth * (double)section;
+    return (TCNEventGeometryMetrics){
+        .calendarGridMinX = sectionMinX + TimeViewWidth,
+        .calendarGridMaxX = sectionMinX + sectionWidth - EventRightInset,
+        .calendarGridMinY = ContentMarginTop,
+        .hourHeight = HourHeight,
+        .minuteHeight = HourHeight / 60,
+        .marginTop = CellMarginTop,
+        .marginLeft = CellMarginLeft,
+        .marginBottom = CellMarginBottom,
+        .marginRight = CellMarginRight,
+    };
+}
+
+static void SectionStaticRects(size_t section, double sectionWidth, TCNRectIndexRect *rects) {
+    const double sectionMinX = sectionWidth * (double)section;
+    const double gridMinX = sectionMinX + TimeViewWidth;
+    const double gridMaxX = sectionMinX + sectionWidth;
+    size_t index = 0;
+    for (int hour = 0; hour <= HoursInDay; hour++) {
+        const double hourY = ContentMarginTop + (HourHeight * hour);
+        rects[index++] = (TCNRectIndexRect){sectionMinX, hourY - (HourHeight / 2), gridMinX, hourY + (HourHeight / 2)};
+        rects[index++] = (TCNRectIndexRect){gridMinX, hourY, gridMaxX, hourY + HorizontalGridlineHeight};
+        if (hour < HoursInDay) {
+            const double halfHourY = hourY + (HourHeight / 2);
+            rects[index++] = (TCNRectIndexRect){gridMinX, halfHourY, gridMaxX, halfHourY + HorizontalGridlineHeight};
+        }
+    }
+}
+
+#pragma mark - Calendar
+
+typedef struct {
+    TCNSyntheticCalendarProfile profile;
+    size_t dayCount;
+    size_t maximumEventCount;
+    size_t eventCount;
+
+    /**
+     @c maximumEventCount slots per day, of which the first @c eventCounts[day] are used.
+     */
+    TCNEventGeometryInput *inputs;
+    size_t *eventCounts;
+
+    /**
+     The all day events shown over every day of the calendar.
+     */
+    TCNAllDayRowSpan *allDaySpans;
+    size_t allDayEventCount;
+
+    /**
+     Scratch and output buffers, allocated up front so that only the engines' own allocations are counted.
+     */
+    TCNEventGeometryFrame *frames;
+    TCNOverlapInterval *intervals;
+    size_t *intervalCounts;
+    TCNOverlapPlacement *placements;
+    TCNRectIndexRect *rects;
+    uint32_t *queryResults;
+    uint32_t *allDayRows;
+    uint32_t *allDayOverflowCounts;
+} Calendar;
+
+static void CalendarDestroy(Calendar *calendar) {
+    free(calendar->inputs);
+    free(calendar->eventCounts);
+    free(calendar->frames);
+    free(calendar->intervals);
+    free(calendar->intervalCounts);
+    free(calendar->placements);
+    free(calendar->rects);
+    free(calendar->queryResults);
+    free(calendar->allDaySpans);
+    free(calendar->allDayRows);
+    free(calendar->allDayOverflowCounts);
+}
+
+static int CalendarCreate(TCNSyntheticCalendarProfile profile, uint64_t seed, Calendar *calendar) {
+    const size_t dayCount = TCNSyntheticCalendarProfileDayCount(profile);
+    const size_t maximumEventCount = TCNSyntheticCalendarProfileMaximumEventCount(profile);
+    const size_t slotCount = dayCount * maximumEventCount;
+    const size_t rectCount = slotCount + (dayCount * StaticAttributesPerSection);
+    const size_t allDayEventCount = TCNSyntheticCalendarProfileAllDayEventCount(profile);
+    *calendar = (Calendar){
+        .profile = profile,
+        .dayCount = dayCount,
+        .maximumEventCount = maximumEventCount,
+        .inputs = malloc(slotCount * sizeof(TCNEventGeometryInput)),
+        .eventCounts = malloc(dayCount * sizeof(size_t)),
+        .frames = malloc(slotCount * sizeof(TCNEventGeometryFrame)),
+        .intervals = malloc(slotCount * sizeof(TCNOverlapInterval)),
+        .intervalCounts = malloc(dayCount * sizeof(size_t)),
+        .placements = malloc(slotCount * sizeof(TCNOverlapPlacement)),
+        .rects = malloc(rectCount * sizeof(TCNRectIndexRect)),
+        .queryResults = malloc(rectCount * sizeof(uint32_t)),
+        .allDaySpans = malloc(allDayEventCount * sizeof(TCNAllDayRowSpan)),
+        .allDayEventCount = allDayEventCount,
+        .allDayRows = malloc(allDayEventCount * sizeof(uint32_t)),
+        .allDayOverflowCounts = malloc(dayCount * sizeof(uint32_t)),
+    };
+    if (!calendar->inputs || !calendar->eventCounts || !calendar->frames || !calendar->intervals || !calendar->intervalCounts
+        || !calendar->placements || !calendar->rects || !calendar->queryResults || !calendar->allDaySpans || !calendar->allDayRows
+        || !calendar->allDayOverflowCounts) {
+        CalendarDestroy(calendar);
+        return -1;
+    }
+
+    for (size_t day = 0; day < dayCount; day++) {
+        const size_t count = TCNSyntheticCalendarGenerateDay(profile, seed, (int64_t)day, &calendar->inputs[day * maximumEventCount]);
+        calendar->eventCounts[day] = count;
+        calendar->eventCount += count;
+    }
+    TCNSyntheticCalendarGenerateAllDaySpans(profile, seed, calendar->allDaySpans);
+    return 0;
+}
+
+#pragma mark - Benchmarks
+
+typedef struct {
+    double minimumNanoseconds;
+    double medianNanoseconds;
+    double meanNanoseconds;
+    TCNBenchmarkAllocations allocations;
+} Measurement;
+
+typedef int (*BenchmarkFunction)(Calendar *calendar, double sectionWidth, uint64_t *checksum);
+
+static double NowInNanoseconds(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((double)time.tv_sec * 1e9) + (double)time.tv_nsec;
+}
+
+static int CompareDoubles(const void *first, const void *second) {
+    const double firstValue = *(const double *)first;
+    const double secondValue = *(const double *)second;
+    return (firstValue > secondValue) - (firstValue < secondValue);
+}
+
+/**
+ Runs @c function once to warm up, then @c iterations times. The allocations and checksum are those of the last
+ iteration, which every iteration repeats exactly.
+ */
+static int Measure(BenchmarkFunction function,
+                   Calendar *calendar,
+                   double sectionWidth,
+                   size_t iterations,
+                   Measurement *measurement,
+                   uint64_t *checksum) {
+    double *const durations = malloc(iterations * sizeof(double));
+    if (!durations || function(calendar, sectionWidth, checksum) != 0) {
+        free(durations);
+        return -1;
+    }
+
+    double totalDuration = 0;
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        TCNBenchmarkAllocationsReset();
+        *checksum = 0;
+        const double start = NowInNanoseconds();
+        if (function(calendar, sectionWidth, checksum) != 0) {
+            free(durations);
+            return -1;
+        }
+        durations[iteration] = NowInNanoseconds() - start;
+        totalDuration += durations[iteration];
+        measurement->allocations = TCNBenchmarkAllocationsGet();
+    }
+
+    qsort(durations, iterations, sizeof(double), CompareDoubles);
+    measurement->minimumNanoseconds = durations[0];
+    measurement->medianNanoseconds = durations[iterations / 2];
+    measurement->meanNanoseconds = totalDuration / (double)iterations;
+    free(durations);
+    return 0;
+}
+
+/**
+ What @c -[TCNDayViewLayout prepareLayout] computes on the main thread for every section: the frames of the events with
+ overlap adjustment, which a full pass computes with @c TCNEventGeometryEngine like the background and snapshot passes,
+ and an index of all frames for rect queries. The index is kept until the next layout, as the layout keeps it.
+ */
+static TCNRectIndex *PreparedIndex;
+
+static int PrepareLayout(Calendar *calendar, double sectionWidth, uint64_t *checksum) {
+    TCNRectIndexDestroy(PreparedIndex);
+    PreparedIndex = NULL;
+
+    size_t rectCount = 0;
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        const TCNEventGeometryMetrics metrics = SectionMetrics(day, sectionWidth);
+        const size_t count = calendar->eventCounts[day];
+        TCNEventGeometryFrame *const frames = &calendar->frames[day * calendar->maximumEventCount];
+        if (TCNEventGeometryEngineComputeFrames(&metrics, &calendar->inputs[day * calendar->maximumEventCount], count, frames) != 0) {
+            return -1;
+        }
+
+        SectionStaticRects(day, sectionWidth, &calendar->rects[rectCount]);
+        rectCount += StaticAttributesPerSection;
+        for (size_t i = 0; i < count; i++) {
+            const TCNEventGeometryFrame frame = frames[i];
+            calendar->rects[rectCount++] = (TCNRectIndexRect){frame.minX, frame.minY, frame.minX + frame.width, frame.minY + frame.height};
+        }
+    }
+
+    PreparedIndex = TCNRectIndexCreate(calendar->rects, rectCount);
+    if (!PreparedIndex) {
+        return -1;
+    }
+    *checksum += TCNRectIndexCount(PreparedIndex);
+    return 0;
+}
+
+/**
+ Only the column placement of the adjustable events, from the event frames that @c PrepareLayout computed.
+ */
+static int AdjustForOverlap(Calendar *calendar, double sectionWidth, uint64_t *checksum) {
+    (void)sectionWidth;
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        const size_t offset = day * calendar->maximumEventCount;
+        if (TCNOverlapEngineComputePlacements(&calendar->intervals[offset], calendar->intervalCounts[day], &calendar->placements[offset]) != 0) {
+            return -1;
+        }
+        for (size_t i = 0; i < calendar->intervalCounts[day]; i++) {
+            *checksum += calendar->placements[offset + i].columnCount;
+        }
+    }
+    return 0;
+}
+
+/**
+ A vertical scroll through every section, with one query of the prepared index per scroll step.
+ */
+static int QueryRects(Calendar *calendar, double sectionWidth, uint64_t *checksum) {
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        const double minX = sectionWidth * (double)day;
+        for (double offset = 0; offset + ViewportHeight <= SectionHeight(); offset += ScrollStep) {
+            const TCNRectIndexRect rect = {minX, offset, minX + sectionWidth, offset + ViewportHeight};
+            *checksum += TCNRectIndexQuery(PreparedIndex, rect, calendar->queryResults);
+        }
+    }
+    return 0;
+}
+
+/**
+ What @c TCNAllDayViewLayout computes when its events change: the row of every all day event, and the number of events
+ on each day that don't fit under the row limit.
+ */
+static int PackAllDayRows(Calendar *calendar, double sectionWidth, uint64_t *checksum) {
+    (void)sectionWidth;
+    uint32_t rowCount = 0;
+    if (TCNAllDayRowEngineComputeRows(calendar->allDaySpans,
+                                      calendar->allDayEventCount,
+                                      calendar->dayCount,
+                                      AllDayMaximumRowCount,
+                                      calendar->allDayRows,
+                                      calendar->allDayOverflowCounts,
+                                      &rowCount) != 0) {
+        return -1;
+    }
+    *checksum += rowCount;
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        *checksum += calendar->allDayOverflowCounts[day];
+    }
+    return 0;
+}
+
+static void PrepareIntervals(Calendar *calendar) {
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        const size_t offset = day * calendar->maximumEventCount;
+        size_t intervalCount = 0;
+        for (size_t i = 0; i < calendar->eventCounts[day]; i++) {
+            if (calendar->inputs[offset + i].shouldAdjustLayout) {
+                const TCNEventGeometryFrame frame = calendar->frames[offset + i];
+                calendar->intervals[offset + intervalCount++] = (TCNOverlapInterval){frame.minY, frame.minY + frame.height};
+            }
+        }
+        calendar->intervalCounts[day] = intervalCount;
+    }
+}
+
+static uint32_t MaximumColumnCount(const Calendar *calendar) {
+    uint32_t maximumColumnCount = 0;
+    for (size_t day = 0; day < calendar->dayCount; day++) {
+        for (size_t i = 0; i < calendar->eventCounts[day]; i++) {
+            const uint32_t columnCount = calendar->frames[(day * calendar->maximumEventCount) + i].placement.columnCount;
+            maximumColumnCount = columnCount > maximumColumnCount ? columnCount : maximumColumnCount;
+        }
+    }
+    return maximumColumnCount;
+}
+
+#pragma mark - Output
+
+static void PrintMeasurement(const char *name, const Measurement *measurement, uint64_t checksum, size_t iterations, int isLast) {
+    printf("        \"%s\": {\n", name);
+    printf("          \"iterations\": %zu,\n", iterations);
+    printf("          \"minNanoseconds\": %.0f,\n", measurement->minimumNanoseconds);
+    printf("          \"medianNanoseconds\": %.0f,\n", measurement->medianNanoseconds);
+    printf("          \"meanNanoseconds\": %.0f,\n", measurement->meanNanoseconds);
+    printf("          \"allocations\": %zu,\n", measurement->allocations.allocationCount);
+    printf("          \"allocatedBytes\": %zu,\n", measurement->allocations.allocatedBytes);
+    printf("          \"liveAllocations\": %ld,\n", measurement->allocations.liveAllocationCount);
+    printf("          \"checksum\": %" PRIu64 "\n", checksum);
+    printf("        }%s\n", isLast ? "" : ",");
+}
+
+static int RunProfile(TCNSyntheticCalendarProfile profile, uint64_t seed, size_t iterations, double sectionWidth, int isLast) {
+    Calendar calendar;
+    if (CalendarCreate(profile, seed, &calendar) != 0) {
+        return -1;
+    }
+
+    Measurement prepareLayout = {0};
+    Measurement overlapAdjustment = {0};
+    Measurement rectQuery = {0};
+    Measurement allDayPacking = {0};
+    uint64_t prepareLayoutChecksum = 0;
+    uint64_t overlapAdjustmentChecksum = 0;
+    uint64_t rectQueryChecksum = 0;
+    uint64_t allDayPackingChecksum = 0;
+    int result = Measure(PrepareLayout, &calendar, sectionWidth, iterations, &prepareLayout, &prepareLayoutChecksum);
+    if (result == 0) {
+        PrepareIntervals(&calendar);
+        result = Measure(AdjustForOverlap, &calendar, sectionWidth, iterations, &overlapAdjustment, &overlapAdjustmentChecksum);
+    }
+    if (result == 0) {
+        result = Measure(QueryRects, &calendar, sectionWidth, iterations, &rectQuery, &rectQueryChecksum);
+    }
+    if (result == 0) {
+        result = Measure(PackAllDayRows, &calendar, sectionWidth, iterations, &allDayPacking, &allDayPackingChecksum);
+    }
+
+    if (result == 0) {
+        printf("    {\n");
+        printf("      \"name\": \"%s\",\n", TCNSyntheticCalendarProfileName(profile));
+        printf("      \"days\": %zu,\n", calendar.dayCount);
+        printf("      \"events\": %zu,\n", calendar.eventCount);
+        printf("      \"allDayEvents\": %zu,\n", calendar.allDayEventCount);
+        printf("      \"maximumColumnCount\": %" PRIu32 ",\n", MaximumColumnCount(&calendar));
+        printf("      \"benchmarks\": {\n");
+        PrintMeasurement("prepareLayout", &prepareLayout, prepareLayoutChecksum, iterations, 0);
+        PrintMeasurement("overlapAdjustment", &overlapAdjustment, overlapAdjustmentChecksum, iterations, 0);
+        PrintMeasurement("rectQuery", &rectQuery, rectQueryChecksum, iterations, 0);
+        PrintMeasurement("allDayPacking", &allDayPacking, allDayPackingChecksum, iterations, 1);
+        printf("      }\n");
+        printf("    }%s\n", isLast ? "" : ",");
+    }
+
+    TCNRectIndexDestroy(PreparedIndex);
+    PreparedIndex = NULL;
+    CalendarDestroy(&calendar);
+    return result;
+}
+
+#pragma mark - Main
+
+static void PrintUsage(const char *program) {
+    fprintf(stderr, "Usage: %s [--profile NAME]... [--seed N] [--iterations N] [--width POINTS]\n", program);
+    fprintf(stderr, "Profiles:");
+    for (int i = 0; i < TCNSyntheticCalendarProfileCount; i++) {
+        fprintf(stderr, " %s", TCNSyntheticCalendarProfileName((TCNSyntheticCalendarProfile)i));
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char *argv[]) {
+    int selectedProfiles[TCNSyntheticCalendarProfileCount] = {0};
+    int hasSelectedProfiles = 0;
+    uint64_t seed = 42;
+    size_t iterations = 10;
+    double sectionWidth = 375;
+
+    for (int i = 1; i < argc; i++) {
+        const char *const option = argv[i];
+        const char *const value = i + 1 < argc ? argv[i + 1] : NULL;
+        TCNSyntheticCalendarProfile profile;
+        if (strcmp(option, "--profile") == 0 && value && TCNSyntheticCalendarProfileWithName(value, &profile) == 0) {
+            selectedProfiles[profile] = 1;
+            hasSelectedProfiles = 1;
+        } else if (strcmp(option, "--seed") == 0 && value) {
+            seed = strtoull(value, NULL, 10);
+        } else if (strcmp(option, "--iterations") == 0 && value && strtoul(value, NULL, 10) > 0) {
+            iterations = strtoul(value, NULL, 10);
+        } else if (strcmp(option, "--width") == 0 && value && strtod(value, NULL) > TimeViewWidth) {
+            sectionWidth = strtod(value, NULL);
+        } else {
+            PrintUsage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    int lastProfile = -1;
+    for (int i = 0; i < TCNSyntheticCalendarProfileCount; i++) {
+        if (!hasSelectedProfiles || selectedProfiles[i]) {
+            lastProfile = i;
+        }
+    }
+
+    printf("{\n");
+    printf("  \"seed\": %" PRIu64 ",\n", seed);
+    printf("  \"iterations\": %zu,\n", iterations);
+    printf("  \"sectionWidth\": %g,\n", sectionWidth);
+    printf("  \"viewportHeight\": %g,\n", ViewportHeight);
+    printf("  \"profiles\": [\n");
+    for (int i = 0; i < TCNSyntheticCalendarProfileCount; i++) {
+        if (hasSelectedProfiles && !selectedProfiles[i]) {
+            continue;
+        }
+        if (RunProfile((TCNSyntheticCalendarProfile)i, seed, iterations, sectionWidth, i == lastProfile) != 0) {
+            fprintf(stderr, "Unable to run the %s profile\n", TCNSyntheticCalendarProfileName((TCNSyntheticCalendarProfile)i));
+            return 1;
+        }
+    }
+    printf("  ]\n");
+    printf("}\n");
+    return 0;
+}
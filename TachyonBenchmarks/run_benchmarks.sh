@@ -0,0 +1,32 @@
+#!/bin/sh
+#
+# Builds and runs the headless layout benchmarks, printing their results as JSON. Only a C compiler is needed, so this
+# runs on Linux as well as macOS. Arguments are passed on to the benchmark, e.g.:
+#
+#   TachyonBenchmarks/run_benchmarks.sh --profile typical --profile stress-10k --iterations 20 > results.json
+#
+# The engines are C99, and are built as strict C99 so that a later language feature fails the build.
+# Set CC to choose the compiler and BUILD_DIR to keep the build somewhere other than a temporary directory.
+
+set -e
+
+BENCHMARKS_DIR=$(cd "$(dirname "$0")" && pwd)
+ENGINE_DIR="$BENCHMARKS_DIR/../Tachyon/LayoutEngine"
+CC=${CC:-cc}
+BUILD_DIR=${BUILD_DIR:-"${TMPDIR:-/tmp}/TachyonBenchmarks"}
+CFLAGS="-std=c99 -pedantic -O2 -Wall -Wextra -Wno-unknown-pragmas -I$ENGINE_DIR -I$BENCHMARKS_DIR"
+
+mkdir -p "$BUILD_DIR"
+
+# The engines' allocations are routed to the counters in TCNBenchmarkAllocations.c
+for SOURCE in TCNAllDayRowEngine TCNEventGeometryEngine TCNOverlapEngine TCNRectIndex; do
+    $CC $CFLAGS -DTCN_BENCHMARK_COUNT_ALLOCATIONS -include "$BENCHMARKS_DIR/TCNBenchmarkAllocations.h" \
+        -c "$ENGINE_DIR/$SOURCE.c" -o "$BUILD_DIR/$SOURCE.o"
+done
+for SOURCE in TCNBenchmarkAllocations TCNSyntheticCalendar main; do
+    $CC $CFLAGS -c "$BENCHMARKS_DIR/$SOURCE.c" -o "$BUILD_DIR/$SOURCE.o"
+done
+
+$CC -o "$BUILD_DIR/TachyonBenchmarks" "$BUILD_DIR"/*.o -lm
+
+"$BUILD_DIR/TachyonBenchmarks" "$@"
@@ -0,0 +1,24 @@
+#!/bin/sh
+#
+# Builds and runs the headless checks of the layout engines. Only a C compiler is needed, so this runs on Linux as well
+# as macOS, and exits with a non-zero status if a check fails:
+#
+#   TachyonBenchmarks/run_engine_tests.sh
+#
+# The engines are C99, and are built as strict C99 so that a later language feature fails the build.
+# Set CC to choose the compiler and BUILD_DIR to keep the build somewhere other than a temporary directory.
+
+set -e
+
+BENCHMARKS_DIR=$(cd "$(dirname "$0")" && pwd)
+ENGINE_DIR="$BENCHMARKS_DIR/../Tachyon/LayoutEngine"
+CC=${CC:-cc}
+BUILD_DIR=${BUILD_DIR:-"${TMPDIR:-/tmp}/TachyonEngineTests"}
+CFLAGS="-std=c99 -pedantic -O2 -Wall -Wextra -Werror -Wno-unknown-pragmas -I$ENGINE_DIR"
+
+mkdir -p "$BUILD_DIR"
+
+$CC $CFLAGS -o "$BUILD_DIR/TCNOverlapEngineReferenceTests" \
+    "$ENGINE_DIR/TCNOverlapEngine.c" "$BENCHMARKS_DIR/TCNOverlapEngineReferenceTests.c" -lm
+
+"$BUILD_DIR/TCNOverlapEngineReferenceTests"
@@ -14,6 +14,7 @@ class ViewController: UIViewController {
         config.selectedColor = .blue
         config.backgroundColor = lightGrayBackgroundColor
         config.weekendTextColor = .lightGray
+        config.scrollsContinuously = true
         return config
     }
 
@@ -25,6 +26,11 @@ class ViewController: UIViewController {
         config.selectedEventColor = .blue
         config.selectedEventTextColor = .white
         config.cancelButtonImage = UIImage(named: "ic_cancel_16dp")
+        config.layoutsEventsInBackground = true
+        config.rendersStaticGrid = true
+        config.layoutSnapshotDirectoryURL = FileManager.default.urls(for: .cachesDirectory, in: .userDomainMask).first
+        config.createsAllDayViewLazily = true
+        config.prewarmsViews = true
         config.customAllDayViewConfig = { (view) in
             view.layer.borderColor = lightGrayBackgroundColor.cgColor
             view.layer.borderWidth = 1.0
@@ -36,7 +42,7 @@ class ViewController: UIViewController {
 
     var currentDate: Date = Date()
 
-    private var createdEvents: [TCNEvent] = []
+    private let createdEvents: TCNEventStore = TCNEventStore()
     private let datePicker: TCNDatePickerView = TCNDatePickerView(frame: CGRect.zero, config: ViewController.datePickerConfig)
     private let dayView: TCNDayView = TCNDayView(frame: CGRect.zero, config: ViewController.dayViewConfig)
 
@@ -57,6 +63,7 @@ class ViewController: UIViewController {
         super.viewDidLoad()
 
         datePicker.datePickerDelegate = self
+        datePicker.densityDataSource = self
         view.addSubview(datePicker)
 
         // update day view
@@ -101,7 +108,8 @@ class ViewController: UIViewController {
     @objc
     private func applicationDidBecomeActive() {
         currentDate = Date()
-        createdEvents = []
+        createdEvents.removeAllEvents()
+        datePicker.reloadAllEventDensities()
     }
 
 }
@@ -119,25 +127,49 @@ extension ViewController: TCNDatePickerDelegate {
 
 }
 
+// MARK: - TCNDatePickerDensityDataSource
+
+extension ViewController: TCNDatePickerDensityDataSource {
+
+    func datePickerView(_ datePickerView: TCNDatePickerView, eventsFrom startDate: Date, to endDate: Date) -> [TCNEvent] {
+        var events: [TCNEvent] = []
+        var date = startDate
+        while date < endDate {
+            events += getSampleEvents(for: date) + createdEvents(for: date)
+            guard let nextDate = Calendar.current.date(byAdding: .day, value: 1, to: date) else {
+                break
+            }
+            date = nextDate
+        }
+        return events
+    }
+
+}
+
 // MARK: - TCNDayViewDelegate
 
 extension ViewController: TCNDayViewDelegate {
 
     func dayView(_ dayView: TCNDayView, didSelectAvailabilityWith event: TCNEvent) {
-        if createdEvents.contains(where: { $0.startDateTime == event.startDateTime }) {
+        if createdEvents.events.contains(where: { $0.startDateTime == event.startDateTime }) {
             return
         }
-        createdEvents.append(event)
-        dayView.reload(resetScrolling: false)
+        createdEvents.add(event)
+        datePicker.reloadEventDensities(from: event.startDateTime, to: event.endDateTime)
+        if let index = dayEvents.firstIndex(of: event) {
+            dayView.insertEvent(at: index, isAllDay: false)
+        }
 
         print("Selected time: \(ViewController.displayText(for: event))")
     }
 
     func dayView(_ dayView: TCNDayView, didCancel event: TCNEvent) {
-        createdEvents.removeAll { (createdEvent) -> Bool in
-            event == createdEvent
+        guard createdEvents.events.contains(event), let index = dayEvents.firstIndex(of: event) else {
+            return
         }
-        dayView.reload(resetScrolling: false)
+        createdEvents.remove(event)
+        datePicker.reloadEventDensities(from: event.startDateTime, to: event.endDateTime)
+        dayView.removeEvent(at: index, isAllDay: false)
     }
 
     private static func displayText(for event: TCNEvent) -> String {
@@ -172,8 +204,16 @@ extension ViewController: TCNDayViewDataSource {
         return (getSampleEvents(for: currentDate) + createdEvents(for: currentDate)).filter { $0.isAllDay }
     }
 
+    /**
+     The sample events never change, so only the events created on the day tell its versions apart. A snapshot of
+     different events with the same count is still replaced once it's verified.
+     */
+    func dataVersion(for date: Date) -> UInt64 {
+        return UInt64(createdEvents(for: date).count)
+    }
+
     private func createdEvents(for date: Date) -> [TCNEvent] {
-        return createdEvents.filter { $0.occurs(onDay: date) }
+        return createdEvents.events(onDay: date)
     }
 
     /**
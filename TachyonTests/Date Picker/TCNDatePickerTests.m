@@ -3,6 +3,7 @@
 #import <LayoutTestBase/LYTViewProvider.h>
 
 #import "TCNDatePickerView.h"
+#import "TCNDatePickerDataSource.h"
 #import "TCNDatePickerDayView.h"
 #import "TCNDateUtil.h"
 #import "TCNDatePickerSelectionIndicatorView.h"
@@ -41,6 +42,39 @@
     XCTAssertTrue([TCNDateUtil isDate:date inSameDayAsDate:datePicker.selectedDate]);
 }
 
+- (void)testContinuousDataSourceDatesAreConsecutive {
+    TCNDatePickerConfig *const config = [[TCNDatePickerConfig alloc] init];
+    config.scrollsContinuously = YES;
+    config.continuousScrollingWeekRange = 4;
+    TCNDatePickerDataSource *const dataSource = [[TCNDatePickerDataSource alloc] initWithConfig:config];
+
+    NSDateFormatter *const formatter = [[NSDateFormatter alloc] init];
+    formatter.dateFormat = @"yyyy-MM-dd HH:mm:ss";
+    NSDate *const date = [formatter dateFromString:@"2019-03-10 13:30:23"];
+    [dataSource setupWeekDatesWithCurrentlyVisibleDate:date];
+
+    UICollectionView *const collectionView = [[UICollectionView alloc] initWithFrame:CGRectZero
+                                                                collectionViewLayout:[[UICollectionViewFlowLayout alloc] init]];
+    XCTAssertEqual([dataSource numberOfSectionsInCollectionView:collectionView], 9);
+    XCTAssertEqual([dataSource indexPathForDate:date].section, dataSource.activeWeekSection);
+
+    NSDate *previousDate;
+    for (NSInteger week = 0; week < 9; week++) {
+        for (NSInteger day = 0; day < 7; day++) {
+            NSIndexPath *const indexPath = [NSIndexPath indexPathForRow:day inSection:week];
+            NSDate *const dayDate = [dataSource dateForItemAtIndexPath:indexPath];
+            XCTAssertNotNil(dayDate);
+            XCTAssertEqualObjects([dataSource indexPathForDate:dayDate], indexPath);
+            if (previousDate) {
+                XCTAssertTrue([TCNDateUtil isDate:dayDate inSameDayAsDate:[TCNDateUtil dateByAddingDays:1 toDate:previousDate]]);
+            }
+            previousDate = dayDate;
+        }
+    }
+
+    XCTAssertNil([dataSource indexPathForDate:[TCNDateUtil dateByAddingWeeks:10 toDate:date]]);
+}
+
 #pragma mark - LYTViewProvider
 
 + (NSDictionary *)dataSpecForTest {
@@ -0,0 +1,89 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNDayDensityCache.h"
+#import "TCNDateUtil.h"
+
+@interface TCNDayDensityCacheTests : XCTestCase
+
+@property (nonatomic, strong, nonnull) NSMutableArray<NSArray<NSDate *> *> *requestedRanges;
+@property (nonatomic, strong, nonnull) TCNDayDensityCache *cache;
+@property (nonatomic, strong, nonnull) NSDate *day;
+
+#pragma mark - Helpers
+
+- (nonnull TCNEvent *)eventWithStartDate:(nonnull NSDate *)startDate endDate:(nonnull NSDate *)endDate isAllDay:(BOOL)isAllDay {
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Event"
+                                             startDateTime:startDate
+                                               endDateTime:endDate
+                                                  location:nil
+                                                  timezone:nil
+                                                  isAllDay:isAllDay];
+    XCTAssertNotNil(event);
+    return event ?: [[TCNEvent alloc] initWithName:@"Event" startDateTime:startDate];
+}
+
+@end
+
+@implementation TCNDayDensityCacheTests
+
+- (void)setUp {
+    [super setUp];
+    self.day = [[NSCalendar currentCalendar] startOfDayForDate:[NSDate date]];
+    self.requestedRanges = [[NSMutableArray alloc] init];
+
+    // Two overlapping hour-long events on the day, and an all-day event on the next day
+    NSDate *const nextDay = [TCNDateUtil dateByAddingDays:1 toDate:self.day];
+    NSArray<TCNEvent *> *const events = @[
+        [self eventWithStartDate:[self.day dateByAddingTimeInterval:3600] endDate:[self.day dateByAddingTimeInterval:7200] isAllDay:NO],
+        [self eventWithStartDate:[self.day dateByAddingTimeInterval:5400] endDate:[self.day dateByAddingTimeInterval:9000] isAllDay:NO],
+        [self eventWithStartDate:nextDay endDate:[nextDay dateByAddingTimeInterval:3600] isAllDay:YES],
+    ];
+
+    __weak TCNDayDensityCacheTests *const weakSelf = self;
+    self.cache = [[TCNDayDensityCache alloc] initWithEventsProvider:^NSArray<TCNEvent *> *(NSDate *startDate, NSDate *endDate) {
+        [weakSelf.requestedRanges addObject:@[startDate, endDate]];
+        return events;
+    }];
+}
+
+- (void)testPreparedWeeksAreFetchedOnce {
+    [self.cache prepareDensitiesFromDate:self.day toDate:[TCNDateUtil dateByAddingDays:20 toDate:self.day]];
+    XCTAssertEqual(self.requestedRanges.count, 1u);
+
+    const TCNDayDensity density = [self.cache densityForDate:self.day];
+    XCTAssertEqual(density.eventCount, 2);
+    XCTAssertEqual(density.busyMinutes, 90);
+
+    const TCNDayDensity nextDayDensity = [self.cache densityForDate:[TCNDateUtil dateByAddingDays:1 toDate:self.day]];
+    XCTAssertEqual(nextDayDensity.eventCount, 1);
+    XCTAssertEqual(nextDayDensity.busyMinutes, 0);
+
+    [self.cache prepareDensitiesFromDate:[TCNDateUtil dateByAddingDays:5 toDate:self.day] toDate:[TCNDateUtil dateByAddingDays:15 toDate:self.day]];
+    XCTAssertEqual(self.requestedRanges.count, 1u);
+}
+
+- (void)testInvalidationOnlyRefetchesChangedDays {
+    [self.cache prepareDensitiesFromDate:self.day toDate:[TCNDateUtil dateByAddingDays:20 toDate:self.day]];
+    NSDate *const changedDay = [TCNDateUtil dateByAddingDays:10 toDate:self.day];
+    [self.cache invalidateDensitiesFromDate:changedDay toDate:changedDay];
+
+    [self.cache prepareDensitiesFromDate:self.day toDate:[TCNDateUtil dateByAddingDays:20 toDate:self.day]];
+    XCTAssertEqual(self.requestedRanges.count, 2u);
+    XCTAssertEqualObjects(self.requestedRanges.lastObject.firstObject, [[NSCalendar currentCalendar] startOfDayForDate:changedDay]);
+    XCTAssertEqual([self.cache densityForDate:self.day].eventCount, 2);
+}
+
+#pragma mark - Helpers
+
+- (nonnull TCNEvent *)eventWithStartDate:(nonnull NSDate *)startDate endDate:(nonnull NSDate *)endDate isAllDay:(BOOL)isAllDay {
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Event"
+                                             startDateTime:startDate
+                                               endDateTime:endDate
+                                                  location:nil
+                                                  timezone:nil
+                                                  isAllDay:isAllDay];
+    XCTAssertNotNil(event);
+    return event ?: [[TCNEvent alloc] initWithName:@"Event" startDateTime:startDate];
+}
+
+@end
@@ -0,0 +1,97 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNAllDayRowEngine.h"
+
+@interface TCNAllDayRowEngineTests : XCTestCase
+
+@end
+
+/**
+ @c TCNAllDayRowEngine is plain C with no UIKit dependency, so these tests only exercise day spans and row output.
+ */
+@implementation TCNAllDayRowEngineTests
+
+- (void)testEmptyInput {
+    uint32_t rowCount = 1;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(NULL, 0, 7, 0, NULL, NULL, &rowCount), 0);
+    XCTAssertEqual(rowCount, 0u);
+}
+
+- (void)testEventsOnDifferentDaysShareARow {
+    const TCNAllDayRowSpan spans[] = {{0, 1}, {2, 4}, {5, 5}};
+    uint32_t rows[3];
+    uint32_t rowCount = 0;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, 3, 7, 0, rows, NULL, &rowCount), 0);
+
+    XCTAssertEqual(rowCount, 1u);
+    for (NSUInteger index = 0; index < 3; index++) {
+        XCTAssertEqual(rows[index], 0u);
+    }
+}
+
+- (void)testRowsAreReusedOnceFree {
+    // A week-long event on top, then shorter events fill the row below it as each one ends
+    const TCNAllDayRowSpan spans[] = {{0, 0}, {0, 6}, {1, 2}, {1, 1}, {2, 3}, {3, 3}};
+    uint32_t rows[6];
+    uint32_t rowCount = 0;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, 6, 7, 0, rows, NULL, &rowCount), 0);
+
+    XCTAssertEqual(rowCount, 3u);
+    XCTAssertEqual(rows[1], 0u);
+    XCTAssertEqual(rows[0], 1u);
+    XCTAssertEqual(rows[2], 1u);
+    XCTAssertEqual(rows[3], 2u);
+    XCTAssertEqual(rows[4], 2u);
+    XCTAssertEqual(rows[5], 1u);
+}
+
+- (void)testSpansAreClippedToDaysShown {
+    // A span that ends before it starts covers its first day, and spans outside of the days aren't shown
+    const TCNAllDayRowSpan spans[] = {{-3, 1}, {1, 0}, {5, 30}, {-5, -1}, {7, 9}};
+    uint32_t rows[5];
+    uint32_t rowCount = 0;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, 5, 7, 0, rows, NULL, &rowCount), 0);
+
+    XCTAssertEqual(rowCount, 2u);
+    XCTAssertEqual(rows[0], 0u);
+    XCTAssertEqual(rows[1], 1u);
+    XCTAssertEqual(rows[2], 0u);
+    XCTAssertEqual(rows[3], TCNAllDayRowNone);
+    XCTAssertEqual(rows[4], TCNAllDayRowNone);
+}
+
+- (void)testOverflowRowCountsHiddenEventsPerDay {
+    const TCNAllDayRowSpan spans[] = {{0, 6}, {0, 2}, {1, 1}, {2, 3}, {5, 5}};
+    uint32_t rows[5];
+    uint32_t overflowCounts[7];
+    uint32_t rowCount = 0;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, 5, 7, 2, rows, overflowCounts, &rowCount), 0);
+
+    // Three rows are needed, so the second row is kept for the count of the events in rows 1 and 2
+    XCTAssertEqual(rowCount, 2u);
+    XCTAssertEqual(rows[0], 0u);
+    for (NSUInteger index = 1; index < 5; index++) {
+        XCTAssertEqual(rows[index], TCNAllDayRowNone);
+    }
+    const uint32_t expectedCounts[] = {1, 2, 2, 1, 0, 1, 0};
+    for (NSUInteger day = 0; day < 7; day++) {
+        XCTAssertEqual(overflowCounts[day], expectedCounts[day]);
+    }
+}
+
+- (void)testNoOverflowRowWhenRowsFit {
+    const TCNAllDayRowSpan spans[] = {{0, 6}, {0, 2}};
+    uint32_t rows[2];
+    uint32_t overflowCounts[7];
+    uint32_t rowCount = 0;
+    XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, 2, 7, 2, rows, overflowCounts, &rowCount), 0);
+
+    XCTAssertEqual(rowCount, 2u);
+    XCTAssertEqual(rows[0], 0u);
+    XCTAssertEqual(rows[1], 1u);
+    for (NSUInteger day = 0; day < 7; day++) {
+        XCTAssertEqual(overflowCounts[day], 0u);
+    }
+}
+
+@end
@@ -0,0 +1,59 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNDayViewConfig.h"
+#import "TCNDayViewGridRenderer.h"
+
+@interface TCNDayViewGridRendererTests : XCTestCase
+
+@end
+
+@implementation TCNDayViewGridRendererTests
+
+static const TCNDayViewGridMetrics Metrics = {56.0f, 88.0f, 1.0f, 24};
+
+- (void)testTimeColumnImageCoversEveryHourLabel {
+    UIImage *const image = [TCNDayViewGridRenderer timeColumnImageForConfig:[[TCNDayViewConfig alloc] init] metrics:Metrics scale:2];
+    XCTAssertEqual(image.size.width, 56.0f);
+    XCTAssertEqual(image.size.height, 88.0f * 25);
+    XCTAssertEqual(image.scale, 2.0f);
+}
+
+- (void)testGridlinePatternImageIsOneHour {
+    UIImage *const image = [TCNDayViewGridRenderer gridlinePatternImageForConfig:[[TCNDayViewConfig alloc] init] metrics:Metrics scale:3];
+    XCTAssertEqual(image.size.width, 1.0f);
+    XCTAssertEqual(image.size.height, 88.0f);
+}
+
+- (void)testImagesAreSharedForTheSameConfigAndScale {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    XCTAssertEqual([TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2],
+                   [TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2]);
+    XCTAssertEqual([TCNDayViewGridRenderer gridlinePatternImageForConfig:config metrics:Metrics scale:2],
+                   [TCNDayViewGridRenderer gridlinePatternImageForConfig:config metrics:Metrics scale:2]);
+
+    XCTAssertNotEqual([TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2],
+                      [TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:3]);
+    XCTAssertNotEqual([TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2],
+                      [TCNDayViewGridRenderer timeColumnImageForConfig:[[TCNDayViewConfig alloc] init] metrics:Metrics scale:2]);
+}
+
+- (void)testImagesAreDrawnAgainWhenTheConfigStyleChanges {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    UIImage *const timeColumnImage = [TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2];
+    UIImage *const gridlineImage = [TCNDayViewGridRenderer gridlinePatternImageForConfig:config metrics:Metrics scale:2];
+
+    config.sidebarTextColor = [UIColor redColor];
+    config.gridlineLightColor = [UIColor blueColor];
+    XCTAssertNotEqual([TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2], timeColumnImage);
+    XCTAssertNotEqual([TCNDayViewGridRenderer gridlinePatternImageForConfig:config metrics:Metrics scale:2], gridlineImage);
+}
+
+- (void)testImagesAreDrawnAgainWhenTheLocaleChanges {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    UIImage *const image = [TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2];
+
+    [NSNotificationCenter.defaultCenter postNotificationName:NSCurrentLocaleDidChangeNotification object:nil];
+    XCTAssertNotEqual([TCNDayViewGridRenderer timeColumnImageForConfig:config metrics:Metrics scale:2], image);
+}
+
+@end
@@ -7,12 +7,13 @@
 #import "TCNDayViewTimeView.h"
 #import "TCNDateUtil.h"
 #import "TCNEvent.h"
+#import "TCNMacros.h"
 #import "TCNTestUtils.h"
 
 @interface TCNDayView (Testing) <LYTViewProvider>
 
 @property (nonatomic, strong, nonnull, readonly) UICollectionView *collectionView;
-@property (nonatomic, strong, nonnull, readonly) UICollectionView *allDayCollectionView;
+@property (nonatomic, strong, nullable, readonly) UICollectionView *allDayCollectionView;
 
 @end
 
@@ -99,13 +100,101 @@
 
     [self runLayoutTestsWithViewProvider:TCNDayViewTestsViewProvider.self
         validation:^(TCNDayView *_Nonnull view, NSDictionary * _Nonnull data, NSArray<TCNEvent *> * context) {
-            [self ignoreAllTimeViewsOnCollectionView:view.allDayCollectionView];
+            [self ignoreAllTimeViewsOnCollectionView:TCN_FORCE_UNWRAP(view.allDayCollectionView)];
             [self ignoreTopAndBottomTimeViewsOnDayViewCollectionView:view.collectionView];
         }];
 }
 
+- (void)testIncrementalEventUpdatesMatchReload {
+    NSDate *const today = [NSDate date];
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] init];
+    for (NSArray<NSString *> *times in @[@[@"2:00", @"6:00"], @[@"3:00", @"7:00"], @[@"9:00", @"13:00"]]) {
+        [events addObject:[[TCNEvent alloc] initWithName:@"Hello!"
+                                           startDateTime:[TCNTestUtils dateWithTime:times[0] onDay:today]
+                                             endDateTime:[TCNTestUtils dateWithTime:times[1] onDay:today]
+                                                location:nil
+                                                timezone:nil
+                                                isAllDay:NO]];
+    }
+    TCNDayViewTestsViewProvider.sharedInstance.events = events;
+
+    TCNDayView *const view = (TCNDayView *)[TCNDayViewTestsViewProvider viewForData:@{} reuseView:nil size:nil context:nil];
+    [view reloadAndResetScrolling:NO];
+    [view layoutIfNeeded];
+
+    // Insert an event overlapping the first two, but not the third
+    [events insertObject:[[TCNEvent alloc] initWithName:@"Hello!"
+                                          startDateTime:[TCNTestUtils dateWithTime:@"1:00" onDay:today]
+                                            endDateTime:[TCNTestUtils dateWithTime:@"4:00" onDay:today]
+                                               location:nil
+                                               timezone:nil
+                                               isAllDay:NO]
+                 atIndex:1];
+    TCNDayViewTestsViewProvider.sharedInstance.events = events;
+    [view insertEventAtIndex:1 isAllDay:NO];
+    [view layoutIfNeeded];
+    NSArray<NSValue *> *const insertedFrames = [self eventFramesInCollectionView:view.collectionView];
+    [view reloadAndResetScrolling:NO];
+    [view layoutIfNeeded];
+    XCTAssertEqualObjects(insertedFrames, [self eventFramesInCollectionView:view.collectionView]);
+
+    [events removeObjectAtIndex:0];
+    TCNDayViewTestsViewProvider.sharedInstance.events = events;
+    [view removeEventAtIndex:0 isAllDay:NO];
+    [view layoutIfNeeded];
+    NSArray<NSValue *> *const removedFrames = [self eventFramesInCollectionView:view.collectionView];
+    [view reloadAndResetScrolling:NO];
+    [view layoutIfNeeded];
+    XCTAssertEqualObjects(removedFrames, [self eventFramesInCollectionView:view.collectionView]);
+}
+
+- (void)testAllDayViewIsCreatedLazily {
+    NSDate *const today = [NSDate date];
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] init];
+    [events addObject:[[TCNEvent alloc] initWithName:@"Hello!"
+                                       startDateTime:[TCNTestUtils dateWithTime:@"2:00" onDay:today]
+                                         endDateTime:[TCNTestUtils dateWithTime:@"6:00" onDay:today]
+                                            location:nil
+                                            timezone:nil
+                                            isAllDay:NO]];
+    TCNDayViewTestsViewProvider.sharedInstance.events = events;
+
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    config.createsAllDayViewLazily = YES;
+    TCNDayView *const view = [[TCNDayView alloc] initWithFrame:UIScreen.mainScreen.bounds config:config];
+    view.dataSource = TCNDayViewTestsViewProvider.sharedInstance;
+    [view willMoveToSuperview:[[UIView alloc] init]];
+    [view reloadAndResetScrolling:NO];
+    [view layoutIfNeeded];
+    XCTAssertNil(view.allDayCollectionView);
+    XCTAssertEqualWithAccuracy(CGRectGetHeight(view.collectionView.frame), CGRectGetHeight(view.bounds), 0.001);
+
+    // The first all day event creates the all day view, which shows it without a reload
+    [events addObject:[[TCNEvent alloc] initWithName:@"Hello!"
+                                       startDateTime:today
+                                         endDateTime:today
+                                            location:nil
+                                            timezone:nil
+                                            isAllDay:YES]];
+    TCNDayViewTestsViewProvider.sharedInstance.events = events;
+    [view insertEventAtIndex:0 isAllDay:YES];
+    [view layoutIfNeeded];
+    XCTAssertNotNil(view.allDayCollectionView);
+    XCTAssertEqual([view.allDayCollectionView numberOfItemsInSection:0], 1);
+    XCTAssertGreaterThan(CGRectGetHeight(view.allDayCollectionView.frame), 0);
+}
+
 #pragma mark - Helpers
 
+- (nonnull NSArray<NSValue *> *)eventFramesInCollectionView:(nonnull UICollectionView *)collectionView {
+    NSMutableArray<NSValue *> *const frames = [[NSMutableArray alloc] init];
+    for (NSInteger item = 0; item < [collectionView numberOfItemsInSection:0]; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:0];
+        [frames addObject:[NSValue valueWithCGRect:[collectionView layoutAttributesForItemAtIndexPath:indexPath].frame]];
+    }
+    return frames;
+}
+
 /**
  The topmost and bottommost @c TCNDayViewTimeView views may extend off-screen. Ignore them.
  */
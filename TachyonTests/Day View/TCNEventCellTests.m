@@ -2,6 +2,8 @@
 #import <LayoutTest/LYTLayoutTestCase.h>
 
 #import "TCNEventCell.h"
+#import "TCNEventCellStyle.h"
+#import "TCNTextMeasurementCache.h"
 
 
 @interface TCNEventCellTests : LYTLayoutTestCase <LYTViewProvider>
@@ -42,6 +44,109 @@
     }];
 }
 
+- (void)testDisplayModelDisplay {
+    [self runLayoutTestsWithViewProvider:[self class] validation:^(TCNEventCell *_Nonnull eventCell, NSDictionary * _Nonnull data, id  _Nullable context) {
+        TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Test" startDateTime:[NSDate date]];
+        [eventCell applyDisplayModel:[TCNEventCell displayModelForEvent:event
+                                                                 config:[[TCNDayViewConfig alloc] init]
+                                                              cellWidth:eventCell.bounds.size.width]];
+        [eventCell layoutSubviews];
+    }];
+}
+
+- (void)testDisplayModelCapturesEventAndSelection {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Test" startDateTime:[NSDate date]];
+
+    TCNEventDisplayModel *const unselectedModel = [TCNEventCell displayModelForEvent:event config:config cellWidth:200];
+    XCTAssertEqualObjects(unselectedModel.title, event.name);
+    XCTAssertEqualObjects(unselectedModel.timeText, event.displayTimeString);
+    XCTAssertFalse(unselectedModel.style.selected);
+    XCTAssertFalse(unselectedModel.useCompactDisplay);
+    XCTAssertFalse(unselectedModel.style.showsTimeLabel);
+    XCTAssertEqualObjects(unselectedModel.style.backgroundColor, config.eventColor);
+    XCTAssertEqual(unselectedModel.titleWidth, 184);
+    XCTAssertGreaterThan(unselectedModel.titleSize.height, 0);
+
+    event.isSelected = YES;
+    TCNEventDisplayModel *const selectedModel = [TCNEventCell displayModelForEvent:event config:config cellWidth:200];
+    XCTAssertTrue(selectedModel.style.selected);
+    XCTAssertTrue(selectedModel.style.showsTimeLabel);
+    XCTAssertEqualObjects(selectedModel.style.backgroundColor, config.selectedEventColor);
+    XCTAssertEqual(selectedModel.style.showsCancelButton, config.shouldShowCancelButtonOnCreatedEvents);
+}
+
+- (void)testStyleIsSharedUntilConfigChanges {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    config.cancelButtonImage = [[UIImage alloc] init];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Test" startDateTime:[NSDate date]];
+    TCNEvent *const otherEvent = [[TCNEvent alloc] initWithName:@"Other" startDateTime:[NSDate date]];
+
+    // Every display model of the same config and selection holds the same style and template image
+    TCNEventCellStyle *const style = [TCNEventCell displayModelForEvent:event config:config cellWidth:200].style;
+    XCTAssertEqual([TCNEventCell displayModelForEvent:otherEvent config:config cellWidth:200].style, style);
+    XCTAssertEqual([TCNEventCellStyle styleWithConfig:config selected:NO].cancelButtonImage, style.cancelButtonImage);
+    XCTAssertNotEqual([TCNEventCellStyle styleWithConfig:config selected:YES], style);
+
+    config.eventColor = [UIColor redColor];
+    TCNEventCellStyle *const changedStyle = [TCNEventCellStyle styleWithConfig:config selected:NO];
+    XCTAssertNotEqual(changedStyle, style);
+    XCTAssertEqualObjects(changedStyle.backgroundColor, [UIColor redColor]);
+    XCTAssertEqual([TCNEventCellStyle styleWithConfig:config selected:NO], changedStyle);
+}
+
+- (void)testDisplayModelBuiltInBackgroundMatchesMainThread {
+    TCNDayViewConfig *const config = [[TCNDayViewConfig alloc] init];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"A long event title that wraps onto more than one line" startDateTime:[NSDate date]];
+    TCNEventDisplayModel *const mainThreadModel = [TCNEventCell displayModelForEvent:event config:config cellWidth:120];
+    TCNEventCellStyle *const style = [TCNEventCellStyle styleWithConfig:config selected:event.isSelected];
+    [TCNTextMeasurementCache.sharedCache removeAllSizes];
+
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Display model built"];
+    __block TCNEventDisplayModel *backgroundModel;
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        backgroundModel = [TCNEventCell displayModelForEvent:event style:style cellWidth:120];
+        [expectation fulfill];
+    });
+    [self waitForExpectationsWithTimeout:5 handler:nil];
+
+    XCTAssertEqualObjects(backgroundModel.timeText, mainThreadModel.timeText);
+    XCTAssertEqual(backgroundModel.style, mainThreadModel.style);
+    XCTAssertTrue(CGSizeEqualToSize(backgroundModel.titleSize, mainThreadModel.titleSize));
+}
+
+- (void)testMeasuredTitleMatchesSizeToFit {
+    UIFont *const font = [[TCNDayViewConfig alloc] init].eventFont;
+    NSString *const text = @"A long event title that wraps onto more than one line of the event cell";
+    const CGFloat width = 120;
+
+    UILabel *const label = [[UILabel alloc] initWithFrame:CGRectMake(0, 0, width, 1000)];
+    label.font = font;
+    label.numberOfLines = 0;
+    label.text = text;
+    [label sizeToFit];
+
+    const CGSize measuredSize = [TCNTextMeasurementCache.sharedCache sizeForText:text font:font width:width numberOfLines:0];
+    XCTAssertEqualWithAccuracy(measuredSize.width, label.frame.size.width, 1);
+    XCTAssertEqualWithAccuracy(measuredSize.height, label.frame.size.height, 1);
+
+    const CGSize singleLineSize = [TCNTextMeasurementCache.sharedCache sizeForText:text font:font width:width numberOfLines:1];
+    XCTAssertEqual(singleLineSize.width, width);
+    XCTAssertEqualWithAccuracy(singleLineSize.height, ceil(font.lineHeight), 1);
+}
+
+- (void)testDetailLevelForHeight {
+    UIFont *const font = [[TCNDayViewConfig alloc] init].eventFont;
+    XCTAssertEqual([TCNEventCell detailLevelForHeight:font.lineHeight font:font], TCNEventCellDetailLevelTitleOnly);
+    XCTAssertEqual([TCNEventCell detailLevelForHeight:font.lineHeight * 2.5 font:font], TCNEventCellDetailLevelCompact);
+    XCTAssertEqual([TCNEventCell detailLevelForHeight:font.lineHeight * 4 font:font], TCNEventCellDetailLevelFull);
+
+    TCNEventCell *const eventCell = [[TCNEventCell alloc] initWithFrame:CGRectMake(0, 0, 200, font.lineHeight)];
+    [eventCell updateWithEvent:[[TCNEvent alloc] initWithName:@"Test" startDateTime:[NSDate date]]];
+    [eventCell layoutSubviews];
+    XCTAssertEqual(eventCell.detailLevel, TCNEventCellDetailLevelTitleOnly);
+}
+
 - (void)ignoreAccessibilityCheckForEventCell:(nonnull TCNEventCell *)eventCell {
     for (UIView *view in eventCell.contentView.subviews) {
         if ([view isKindOfClass:UIButton.self]) {
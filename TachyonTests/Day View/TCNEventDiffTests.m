@@ -0,0 +1,157 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNEventDiff.h"
+#import "TCNEventSnapshot.h"
+#import "TCNMacros.h"
+#import "TCNRecurrenceRule.h"
+#import "TCNTestUtils.h"
+
+@interface TCNEventDiffTests : XCTestCase
+
+@end
+
+/**
+ Checks that @c TCNEventDiff matches events by identifier and describes the fewest moves, since every change it reports
+ is a cell the day view animates or lays out again.
+ */
+@implementation TCNEventDiffTests
+
+- (void)testNoChanges {
+    NSArray<TCNEvent *> *const events = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b", @"c"]];
+    TCNEventDiff *const diff = [TCNEventDiff diffFromEvents:events toEvents:[TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b", @"c"]]];
+    XCTAssertNotNil(diff);
+    XCTAssertFalse(diff.hasChanges);
+}
+
+- (void)testInsertionsAndDeletions {
+    NSArray<TCNEvent *> *const oldEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b", @"c", @"d"]];
+    NSArray<TCNEvent *> *const newEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"e", @"a", @"c", @"f"]];
+    TCNEventDiff *const diff = [TCNEventDiff diffFromEvents:oldEvents toEvents:newEvents];
+
+    NSMutableIndexSet *const expectedDeletedIndexes = [[NSMutableIndexSet alloc] initWithIndex:1];
+    [expectedDeletedIndexes addIndex:3];
+    NSMutableIndexSet *const expectedInsertedIndexes = [[NSMutableIndexSet alloc] initWithIndex:0];
+    [expectedInsertedIndexes addIndex:3];
+    XCTAssertEqualObjects(diff.deletedIndexes, expectedDeletedIndexes);
+    XCTAssertEqualObjects(diff.insertedIndexes, expectedInsertedIndexes);
+    XCTAssertEqual(diff.movedIndexes.count, 0u);
+    XCTAssertEqual(diff.updatedIndexes.count, 0u);
+}
+
+- (void)testFewestMoves {
+    // Moving "a" to the end keeps the other four in order, so only "a" moves
+    NSArray<TCNEvent *> *const oldEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b", @"c", @"d", @"e"]];
+    NSArray<TCNEvent *> *const newEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"b", @"c", @"d", @"e", @"a"]];
+    TCNEventDiff *const diff = [TCNEventDiff diffFromEvents:oldEvents toEvents:newEvents];
+
+    XCTAssertEqualObjects(diff.movedIndexes, @{@0: @4});
+    XCTAssertEqual(diff.deletedIndexes.count, 0u);
+    XCTAssertEqual(diff.insertedIndexes.count, 0u);
+}
+
+- (void)testEditedEventIsUpdated {
+    NSDate *const today = [NSDate date];
+    NSArray<TCNEvent *> *const oldEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b"]];
+    TCNEvent *const editedEvent = [[TCNEvent alloc] initWithIdentifier:@"a"
+                                                                  name:@"Renamed"
+                                                         startDateTime:[TCNTestUtils dateWithTime:@"09:00" onDay:today]
+                                                           endDateTime:[TCNTestUtils dateWithTime:@"10:00" onDay:today]
+                                                              location:nil
+                                                              timezone:nil
+                                                              isAllDay:NO
+                                                        recurrenceRule:nil];
+    XCTAssertNotNil(editedEvent);
+    NSArray<TCNEvent *> *const newEvents = @[oldEvents[1], TCN_FORCE_UNWRAP(editedEvent)];
+    TCNEventDiff *const diff = [TCNEventDiff diffFromEvents:oldEvents toEvents:newEvents];
+
+    // An updated event is never also reported as moved
+    XCTAssertEqualObjects(diff.updatedIndexes, @{@0: @1});
+    XCTAssertEqual(diff.movedIndexes.count, 0u);
+    XCTAssertTrue(diff.hasChanges);
+}
+
+- (void)testOptionalContentIsCompared {
+    NSSet<NSDate *> *const exceptionDates = [NSSet setWithObject:[NSDate dateWithTimeIntervalSinceReferenceDate:0]];
+    TCNRecurrenceRule *const rule = [TCNRecurrenceRule ruleWithRRuleString:@"FREQ=WEEKLY;COUNT=10" exceptionDates:exceptionDates];
+    TCNRecurrenceRule *const equalRule = [TCNRecurrenceRule ruleWithRRuleString:@"FREQ=WEEKLY;COUNT=10" exceptionDates:exceptionDates];
+    XCTAssertEqualObjects(rule, equalRule);
+    XCTAssertEqual(rule.hash, equalRule.hash);
+
+    // Equal rules are the same content, but a location that was added isn't
+    TCNEvent *const event = [TCNEventDiffTests eventWithIdentifier:@"a" location:nil recurrenceRule:rule];
+    TCNEvent *const sameEvent = [TCNEventDiffTests eventWithIdentifier:@"a" location:nil recurrenceRule:equalRule];
+    TCNEvent *const locatedEvent = [TCNEventDiffTests eventWithIdentifier:@"a" location:@"Room 1" recurrenceRule:equalRule];
+    XCTAssertFalse([TCNEventDiff diffFromEvents:@[event] toEvents:@[sameEvent]].hasChanges);
+    XCTAssertEqualObjects([TCNEventDiff diffFromEvents:@[event] toEvents:@[locatedEvent]].updatedIndexes, @{@0: @0});
+    XCTAssertEqualObjects([TCNEventDiff diffFromEvents:@[locatedEvent] toEvents:@[event]].updatedIndexes, @{@0: @0});
+}
+
+- (void)testDuplicateIdentifiers {
+    NSArray<TCNEvent *> *const events = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"b"]];
+    NSArray<TCNEvent *> *const duplicateEvents = [TCNEventDiffTests eventsWithIdentifiers:@[@"a", @"a"]];
+    XCTAssertNil([TCNEventDiff diffFromEvents:events toEvents:duplicateEvents]);
+    XCTAssertNil([TCNEventDiff diffFromEvents:duplicateEvents toEvents:events]);
+}
+
+- (void)testOccurrencesHaveStableIdentifiers {
+    NSDate *const today = [NSDate date];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Standup" startDateTime:[TCNTestUtils dateWithTime:@"09:00" onDay:today]];
+    NSDate *const occurrenceStart = [TCNTestUtils dateWithTime:@"09:00" onDay:today daysToAdd:1];
+    XCTAssertEqualObjects([event occurrenceWithStartDateTime:occurrenceStart].identifier,
+                          [event occurrenceWithStartDateTime:occurrenceStart].identifier);
+    XCTAssertNotEqualObjects([event occurrenceWithStartDateTime:occurrenceStart].identifier, event.identifier);
+}
+
+- (void)testSnapshotColumns {
+    NSDate *const today = [NSDate date];
+    NSDate *const tomorrow = [TCNTestUtils dateWithTime:@"00:00" onDay:today daysToAdd:1];
+    NSArray<TCNEvent *> *const events = [TCNEventDiffTests eventsWithIdentifiers:@[@"a"]];
+    TCNEventSnapshot *const snapshot = [[TCNEventSnapshot alloc] initWithDates:@[today, tomorrow]
+                                                             dayEventsByColumn:@[events, @[]]
+                                                                  allDayEvents:@[]];
+    XCTAssertEqual(snapshot.numberOfColumns, 2);
+    XCTAssertEqualObjects(snapshot.currentDate, today);
+    XCTAssertEqualObjects([snapshot dayEventsForColumn:0], events);
+    XCTAssertEqual([snapshot dayEventsForColumn:1].count, 0u);
+
+    XCTAssertNil([[TCNEventSnapshot alloc] initWithDates:@[today, tomorrow] dayEventsByColumn:@[events] allDayEvents:@[]]);
+}
+
+#pragma mark - Helpers
+
+/**
+ One-hour events starting at 9:00 today, one per identifier, with the same content apart from their identifiers.
+ */
++ (nonnull NSArray<TCNEvent *> *)eventsWithIdentifiers:(nonnull NSArray<NSString *> *)identifiers {
+    NSDate *const today = [NSDate date];
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] initWithCapacity:identifiers.count];
+    for (NSString *identifier in identifiers) {
+        TCNEvent *const event = [[TCNEvent alloc] initWithIdentifier:identifier
+                                                                name:@"Meeting"
+                                                       startDateTime:[TCNTestUtils dateWithTime:@"09:00" onDay:today]
+                                                         endDateTime:[TCNTestUtils dateWithTime:@"10:00" onDay:today]
+                                                            location:nil
+                                                            timezone:nil
+                                                            isAllDay:NO
+                                                      recurrenceRule:nil];
+        [events addObject:TCN_FORCE_UNWRAP(event)];
+    }
+    return events;
+}
+
++ (nonnull TCNEvent *)eventWithIdentifier:(nonnull NSString *)identifier
+                                 location:(nullable NSString *)location
+                           recurrenceRule:(nullable TCNRecurrenceRule *)recurrenceRule {
+    NSDate *const today = [NSDate date];
+    TCNEvent *const event = [[TCNEvent alloc] initWithIdentifier:identifier
+                                                            name:@"Meeting"
+                                                   startDateTime:[TCNTestUtils dateWithTime:@"09:00" onDay:today]
+                                                     endDateTime:[TCNTestUtils dateWithTime:@"10:00" onDay:today]
+                                                        location:location
+                                                        timezone:nil
+                                                        isAllDay:NO
+                                                  recurrenceRule:recurrenceRule];
+    return TCN_FORCE_UNWRAP(event);
+}
+
+@end
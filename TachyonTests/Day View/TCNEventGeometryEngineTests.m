@@ -0,0 +1,77 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNEventGeometryEngine.h"
+
+@interface TCNEventGeometryEngineTests : XCTestCase
+
+@end
+
+/**
+ @c TCNEventGeometryEngine is plain C with no UIKit dependency, so these tests only exercise time ranges and frames.
+ Parity with @c TCNDayViewLayout is covered by @c TCNDayViewLayoutPerformanceTests.
+ */
+@implementation TCNEventGeometryEngineTests
+
+static const TCNEventGeometryMetrics Metrics = {
+    .calendarGridMinX = 56,
+    .calendarGridMaxX = 373,
+    .calendarGridMinY = 20,
+    .hourHeight = 88,
+    .minuteHeight = 88.0 / 60.0,
+    .marginTop = 2,
+    .marginLeft = 0,
+    .marginBottom = 2,
+    .marginRight = 2,
+};
+
+- (void)testEmptyInput {
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, NULL, 0, NULL), 0);
+}
+
+- (void)testSingleEventUsesFullWidth {
+    const TCNEventGeometryInput inputs[] = {{60, 120, true}};
+    TCNEventGeometryFrame frames[1];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 1, frames), 0);
+
+    XCTAssertEqual(frames[0].minX, 56);
+    XCTAssertEqual(frames[0].minY, 110);
+    XCTAssertEqual(frames[0].width, 315);
+    XCTAssertEqual(frames[0].height, 84);
+    XCTAssertEqual(frames[0].placement.columnCount, 1u);
+}
+
+- (void)testEmptyTimeRangeHasEmptyFrame {
+    const TCNEventGeometryInput inputs[] = {{60, 60, true}, {30, 90, true}};
+    TCNEventGeometryFrame frames[2];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 2, frames), 0);
+
+    XCTAssertEqual(frames[0].width, 0);
+    XCTAssertEqual(frames[0].height, 0);
+    XCTAssertEqual(frames[1].placement.columnCount, 1u);
+}
+
+- (void)testOverlappingEventsShareGridWidth {
+    const TCNEventGeometryInput inputs[] = {{60, 180, true}, {120, 240, true}};
+    TCNEventGeometryFrame frames[2];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 2, frames), 0);
+
+    const double divisionWidth = (Metrics.calendarGridMaxX - Metrics.calendarGridMinX) / 2;
+    XCTAssertEqual(frames[0].minX, Metrics.calendarGridMinX);
+    XCTAssertEqual(frames[1].minX, Metrics.calendarGridMinX + divisionWidth);
+    XCTAssertEqual(frames[0].width, divisionWidth - Metrics.marginRight);
+    XCTAssertEqual(frames[1].placement.column, 1u);
+    XCTAssertEqual(frames[1].placement.columnCount, 2u);
+    XCTAssertEqual(frames[1].placement.stackOrder, 1u);
+}
+
+- (void)testUnadjustedEventsKeepFullWidthAndDontDivideOthers {
+    const TCNEventGeometryInput inputs[] = {{60, 180, true}, {120, 240, false}};
+    TCNEventGeometryFrame frames[2];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 2, frames), 0);
+
+    XCTAssertEqual(frames[0].width, frames[1].width);
+    XCTAssertEqual(frames[0].placement.columnCount, 1u);
+    XCTAssertEqual(frames[1].placement.columnCount, 1u);
+}
+
+@end
@@ -0,0 +1,123 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNLayoutSnapshot.h"
+
+@interface TCNLayoutSnapshotTests : XCTestCase
+
+@end
+
+/**
+ @c TCNLayoutSnapshot is plain C with no UIKit dependency, so these tests only exercise records and encoded bytes.
+ Showing snapshots in @c TCNDayViewLayout is covered by @c TCNDayViewLayoutPerformanceTests.
+ */
+@implementation TCNLayoutSnapshotTests
+
+static const TCNEventGeometryMetrics Metrics = {
+    .calendarGridMinX = 56,
+    .calendarGridMaxX = 373,
+    .calendarGridMinY = 20,
+    .hourHeight = 88,
+    .minuteHeight = 88.0 / 60.0,
+    .marginTop = 2,
+    .marginLeft = 0,
+    .marginBottom = 2,
+    .marginRight = 2,
+};
+
+static const TCNLayoutSnapshotKey Key = {.day = 7000, .dataVersion = 3, .configHash = 42};
+
+- (void)testEncodedSnapshotDecodesWithoutCopying {
+    const TCNLayoutSnapshotRecord records[] = {{1, 110, 84, 0, 2, 0, 0}, {2, 154, 84, 1, 2, 1, TCNLayoutSnapshotRecordFlagUnadjusted}};
+    uint64_t buffer[32];
+    const size_t length = TCNLayoutSnapshotEncodedLength(2);
+    XCTAssertEqual(TCNLayoutSnapshotEncode(&Key, records, 2, buffer, sizeof(buffer)), 0);
+
+    TCNLayoutSnapshotKey key;
+    const TCNLayoutSnapshotRecord *decodedRecords;
+    size_t count;
+    XCTAssertEqual(TCNLayoutSnapshotDecode(buffer, length, &key, &decodedRecords, &count), 0);
+    XCTAssertEqual(key.day, Key.day);
+    XCTAssertEqual(key.dataVersion, Key.dataVersion);
+    XCTAssertEqual(key.configHash, Key.configHash);
+    XCTAssertEqual(count, 2u);
+    XCTAssertTrue(TCNLayoutSnapshotRecordsEqual(decodedRecords, records, 2));
+    XCTAssertTrue((const void *)decodedRecords > (const void *)buffer && (const void *)decodedRecords < (const void *)(buffer + 32));
+}
+
+- (void)testIncompleteSnapshotIsRejected {
+    const TCNLayoutSnapshotRecord records[] = {{1, 110, 84, 0, 1, 0, 0}};
+    uint64_t buffer[32];
+    const size_t length = TCNLayoutSnapshotEncodedLength(1);
+    XCTAssertEqual(TCNLayoutSnapshotEncode(&Key, records, 1, buffer, length - 1), -1);
+    XCTAssertEqual(TCNLayoutSnapshotEncode(&Key, records, 1, buffer, sizeof(buffer)), 0);
+
+    TCNLayoutSnapshotKey key;
+    const TCNLayoutSnapshotRecord *decodedRecords;
+    size_t count;
+    XCTAssertEqual(TCNLayoutSnapshotDecode(buffer, length - 1, &key, &decodedRecords, &count), -1);
+    XCTAssertEqual(TCNLayoutSnapshotDecode(buffer, length + 8, &key, &decodedRecords, &count), -1);
+    XCTAssertEqual(TCNLayoutSnapshotDecode(buffer, 8, &key, &decodedRecords, &count), -1);
+
+    // Anything but a snapshot
+    memset(buffer, 0xab, sizeof(buffer));
+    XCTAssertEqual(TCNLayoutSnapshotDecode(buffer, length, &key, &decodedRecords, &count), -1);
+}
+
+- (void)testSnapshotFramesMatchEngineAtAnyWidth {
+    const TCNEventGeometryInput inputs[] = {{60, 180, true}, {120, 240, true}, {300, 300, true}, {150, 200, false}, {600, 660, true}};
+    TCNEventGeometryFrame frames[5];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 5, frames), 0);
+    TCNLayoutSnapshotRecord records[5];
+    TCNLayoutSnapshotMakeRecords(inputs, frames, NULL, 5, records);
+    XCTAssertEqual(records[2].flags, (uint32_t)TCNLayoutSnapshotRecordFlagEmpty);
+    XCTAssertEqual(records[3].flags, (uint32_t)TCNLayoutSnapshotRecordFlagUnadjusted);
+
+    // A wider section further to the right
+    TCNEventGeometryMetrics wideMetrics = Metrics;
+    wideMetrics.calendarGridMinX += 768;
+    wideMetrics.calendarGridMaxX += 1024;
+    TCNEventGeometryFrame engineFrames[5];
+    TCNEventGeometryFrame snapshotFrames[5];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&wideMetrics, inputs, 5, engineFrames), 0);
+    TCNLayoutSnapshotComputeFrames(&wideMetrics, records, 5, snapshotFrames);
+    for (size_t i = 0; i < 5; i++) {
+        XCTAssertEqual(snapshotFrames[i].minX, engineFrames[i].minX);
+        XCTAssertEqual(snapshotFrames[i].minY, engineFrames[i].minY);
+        XCTAssertEqual(snapshotFrames[i].width, engineFrames[i].width);
+        XCTAssertEqual(snapshotFrames[i].height, engineFrames[i].height);
+        XCTAssertEqual(snapshotFrames[i].placement.columnCount, engineFrames[i].placement.columnCount);
+        XCTAssertEqual(snapshotFrames[i].placement.stackOrder, engineFrames[i].placement.stackOrder);
+    }
+}
+
+- (void)testChangedEventsDontMatchRecords {
+    const TCNEventGeometryInput inputs[] = {{60, 180, true}, {120, 240, true}};
+    const TCNEventGeometryInput movedInputs[] = {{60, 180, true}, {240, 300, true}};
+    const uint64_t identifiers[] = {1, 2};
+    const uint64_t otherIdentifiers[] = {1, 3};
+    TCNEventGeometryFrame frames[2];
+    TCNEventGeometryFrame movedFrames[2];
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, inputs, 2, frames), 0);
+    XCTAssertEqual(TCNEventGeometryEngineComputeFrames(&Metrics, movedInputs, 2, movedFrames), 0);
+
+    TCNLayoutSnapshotRecord records[2];
+    TCNLayoutSnapshotRecord otherRecords[2];
+    TCNLayoutSnapshotMakeRecords(inputs, frames, identifiers, 2, records);
+    TCNLayoutSnapshotMakeRecords(movedInputs, movedFrames, identifiers, 2, otherRecords);
+    XCTAssertFalse(TCNLayoutSnapshotRecordsEqual(records, otherRecords, 2));
+
+    TCNLayoutSnapshotMakeRecords(inputs, frames, otherIdentifiers, 2, otherRecords);
+    XCTAssertFalse(TCNLayoutSnapshotRecordsEqual(records, otherRecords, 2));
+
+    TCNLayoutSnapshotMakeRecords(inputs, frames, identifiers, 2, otherRecords);
+    XCTAssertTrue(TCNLayoutSnapshotRecordsEqual(records, otherRecords, 2));
+}
+
+- (void)testHashIsStable {
+    XCTAssertEqual(TCNLayoutSnapshotHash(NULL, 0, TCNLayoutSnapshotHashSeed), TCNLayoutSnapshotHashSeed);
+    XCTAssertEqual(TCNLayoutSnapshotHash("a", 1, TCNLayoutSnapshotHashSeed), 0xaf63dc4c8601ec8cull);
+    XCTAssertEqual(TCNLayoutSnapshotHash("b", 1, TCNLayoutSnapshotHash("a", 1, TCNLayoutSnapshotHashSeed)),
+                   TCNLayoutSnapshotHash("ab", 2, TCNLayoutSnapshotHashSeed));
+}
+
+@end
@@ -0,0 +1,106 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNOverlapEngine.h"
+
+@interface TCNOverlapEngineTests : XCTestCase
+
+@end
+
+/**
+ @c TCNOverlapEngine is plain C with no UIKit dependency, so these tests only exercise interval input and placement output.
+ */
+@implementation TCNOverlapEngineTests
+
+- (void)testEmptyInput {
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(NULL, 0, NULL), 0);
+}
+
+- (void)testNonOverlappingIntervalsKeepFullWidth {
+    const TCNOverlapInterval intervals[] = {{0, 10}, {10, 20}, {30, 40}};
+    TCNOverlapPlacement placements[3];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 3, placements), 0);
+
+    for (NSUInteger index = 0; index < 3; index++) {
+        XCTAssertEqual(placements[index].column, 0u);
+        XCTAssertEqual(placements[index].columnCount, 1u);
+        XCTAssertEqual(placements[index].stackOrder, 0u);
+    }
+}
+
+- (void)testFullyOverlappingIntervalsUseOneColumnEach {
+    const TCNOverlapInterval intervals[] = {{0, 100}, {10, 100}, {20, 50}};
+    TCNOverlapPlacement placements[3];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 3, placements), 0);
+
+    for (uint32_t index = 0; index < 3; index++) {
+        XCTAssertEqual(placements[index].column, index);
+        XCTAssertEqual(placements[index].columnCount, 3u);
+        XCTAssertEqual(placements[index].stackOrder, index);
+    }
+}
+
+- (void)testChainedIntervalsShareClusterWidthAndReuseColumns {
+    // 0 and 1 overlap, 1 and 2 overlap, but 0 and 2 don't, so 2 reuses column 0.
+    const TCNOverlapInterval intervals[] = {{0, 10}, {5, 15}, {12, 20}, {30, 40}};
+    TCNOverlapPlacement placements[4];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 4, placements), 0);
+
+    XCTAssertEqual(placements[0].column, 0u);
+    XCTAssertEqual(placements[1].column, 1u);
+    XCTAssertEqual(placements[2].column, 0u);
+    XCTAssertEqual(placements[0].columnCount, 2u);
+    XCTAssertEqual(placements[1].columnCount, 2u);
+    XCTAssertEqual(placements[2].columnCount, 2u);
+    XCTAssertEqual(placements[2].stackOrder, 2u);
+
+    XCTAssertEqual(placements[3].column, 0u);
+    XCTAssertEqual(placements[3].columnCount, 1u);
+    XCTAssertEqual(placements[3].stackOrder, 0u);
+}
+
+- (void)testUnsortedInputIsPlacedByStartTime {
+    const TCNOverlapInterval intervals[] = {{20, 40}, {0, 30}};
+    TCNOverlapPlacement placements[2];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 2, placements), 0);
+
+    XCTAssertEqual(placements[1].column, 0u);
+    XCTAssertEqual(placements[1].stackOrder, 0u);
+    XCTAssertEqual(placements[0].column, 1u);
+    XCTAssertEqual(placements[0].stackOrder, 1u);
+}
+
+- (void)testEmptyIntervalsNeverOverlap {
+    const TCNOverlapInterval intervals[] = {{0, 0}, {0, 10}, {5, 5}};
+    TCNOverlapPlacement placements[3];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 3, placements), 0);
+
+    for (NSUInteger index = 0; index < 3; index++) {
+        XCTAssertEqual(placements[index].columnCount, 1u);
+    }
+}
+
+- (void)testStackOrderContinuesAcrossClusters {
+    const TCNOverlapInterval intervals[] = {{0, 10}, {5, 15}, {20, 30}, {25, 35}};
+    TCNOverlapPlacement placements[4];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 4, placements), 0);
+
+    XCTAssertEqual(placements[2].stackOrder, 2u);
+    XCTAssertEqual(placements[3].stackOrder, 3u);
+    XCTAssertEqual(placements[3].column, 1u);
+}
+
+- (void)testClusterPlacedAloneFromItsStackOrderMatchesTheSection {
+    const TCNOverlapInterval intervals[] = {{0, 10}, {5, 15}, {20, 30}, {25, 35}, {28, 40}};
+    TCNOverlapPlacement sectionPlacements[5];
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, 5, sectionPlacements), 0);
+
+    TCNOverlapPlacement clusterPlacements[3];
+    XCTAssertEqual(TCNOverlapEngineComputePlacementsFromStackOrder(&intervals[2], 3, 2, clusterPlacements), 0);
+    for (NSUInteger index = 0; index < 3; index++) {
+        XCTAssertEqual(clusterPlacements[index].column, sectionPlacements[index + 2].column);
+        XCTAssertEqual(clusterPlacements[index].columnCount, sectionPlacements[index + 2].columnCount);
+        XCTAssertEqual(clusterPlacements[index].stackOrder, sectionPlacements[index + 2].stackOrder);
+    }
+}
+
+@end
@@ -0,0 +1,90 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNRectIndex.h"
+
+@interface TCNRectIndexTests : XCTestCase
+
+@end
+
+/**
+ @c TCNRectIndex is plain C with no UIKit dependency, so these tests compare its results with a brute force scan.
+ */
+@implementation TCNRectIndexTests
+
+- (void)testEmptyIndex {
+    TCNRectIndex *const index = TCNRectIndexCreate(NULL, 0);
+    XCTAssertTrue(index != NULL);
+    XCTAssertEqual(TCNRectIndexCount(index), 0u);
+    XCTAssertEqual(TCNRectIndexQuery(index, (TCNRectIndexRect){0, 0, 100, 100}, NULL), 0u);
+    TCNRectIndexDestroy(index);
+}
+
+- (void)testQueryReturnsOnlyIntersectingRects {
+    const TCNRectIndexRect rects[] = {
+        {0, 0, 100, 10},
+        {0, 20, 100, 30},
+        {0, 5, 100, 200},
+        {200, 0, 300, 300},
+    };
+    TCNRectIndex *const index = TCNRectIndexCreate(rects, 4);
+    uint32_t results[4];
+
+    const size_t count = TCNRectIndexQuery(index, (TCNRectIndexRect){0, 15, 100, 25}, results);
+    XCTAssertEqual(count, 2u);
+    XCTAssertEqualObjects([TCNRectIndexTests setWithResults:results count:count], ([NSSet setWithArray:@[@1, @2]]));
+
+    TCNRectIndexDestroy(index);
+}
+
+- (void)testTouchingEdgesAreReturned {
+    const TCNRectIndexRect rects[] = {{0, 0, 10, 10}};
+    TCNRectIndex *const index = TCNRectIndexCreate(rects, 1);
+    uint32_t results[1];
+
+    XCTAssertEqual(TCNRectIndexQuery(index, (TCNRectIndexRect){10, 10, 20, 20}, results), 1u);
+    XCTAssertEqual(TCNRectIndexQuery(index, (TCNRectIndexRect){10.5, 10.5, 20, 20}, results), 0u);
+
+    TCNRectIndexDestroy(index);
+}
+
+- (void)testQueryMatchesBruteForce {
+    const size_t rectCount = 1000;
+    TCNRectIndexRect *const rects = malloc(rectCount * sizeof(TCNRectIndexRect));
+    srand48(7);
+    for (size_t rect = 0; rect < rectCount; rect++) {
+        const double minX = drand48() * 300;
+        const double minY = drand48() * 2000;
+        rects[rect] = (TCNRectIndexRect){minX, minY, minX + (drand48() * 100), minY + (drand48() * 300)};
+    }
+    TCNRectIndex *const index = TCNRectIndexCreate(rects, rectCount);
+    uint32_t *const results = malloc(rectCount * sizeof(uint32_t));
+
+    for (double offset = -200; offset < 2400; offset += 37) {
+        const TCNRectIndexRect query = {50, offset, 250, offset + 400};
+        NSMutableSet<NSNumber *> *const expected = [[NSMutableSet alloc] init];
+        for (size_t rect = 0; rect < rectCount; rect++) {
+            if (rects[rect].minX <= query.maxX && rects[rect].maxX >= query.minX &&
+                rects[rect].minY <= query.maxY && rects[rect].maxY >= query.minY) {
+                [expected addObject:@(rect)];
+            }
+        }
+        const size_t count = TCNRectIndexQuery(index, query, results);
+        XCTAssertEqualObjects([TCNRectIndexTests setWithResults:results count:count], expected);
+    }
+
+    free(results);
+    TCNRectIndexDestroy(index);
+    free(rects);
+}
+
+#pragma mark - Helpers
+
++ (nonnull NSSet<NSNumber *> *)setWithResults:(const uint32_t *)results count:(size_t)count {
+    NSMutableSet<NSNumber *> *const set = [[NSMutableSet alloc] initWithCapacity:count];
+    for (size_t result = 0; result < count; result++) {
+        [set addObject:@(results[result])];
+    }
+    return set;
+}
+
+@end
@@ -0,0 +1,113 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNEventStore.h"
+#import "TCNTestUtils.h"
+
+@interface TCNEventStoreTests : XCTestCase
+
+@end
+
+/**
+ Compares @c TCNEventStore queries with a scan of every event.
+ */
+@implementation TCNEventStoreTests
+
+- (void)testEmptyStore {
+    TCNEventStore *const store = [[TCNEventStore alloc] init];
+    XCTAssertEqual([store eventsOnDay:[NSDate date]].count, 0u);
+    XCTAssertEqual(store.dayEvents.count, 0u);
+    XCTAssertEqual(store.allDayEvents.count, 0u);
+}
+
+- (void)testEventsOnDayMatchOccursOnDay {
+    NSDate *const today = [NSDate date];
+    NSArray<TCNEvent *> *const events = [TCNEventStoreTests randomEventsAroundDate:today count:2000];
+    TCNEventStore *const store = [[TCNEventStore alloc] initWithEvents:events];
+
+    for (NSInteger days = -3; days <= 3; days++) {
+        NSDate *const day = [TCNTestUtils dateWithTime:@"12:00" onDay:today daysToAdd:days];
+        NSMutableSet<TCNEvent *> *const expectedEvents = [[NSMutableSet alloc] init];
+        for (TCNEvent *event in events) {
+            if ([event occursOnDay:day]) {
+                [expectedEvents addObject:event];
+            }
+        }
+        XCTAssertEqualObjects([NSSet setWithArray:[store eventsOnDay:day]], expectedEvents);
+    }
+}
+
+- (void)testEventsOverlappingRange {
+    NSDate *const today = [NSDate date];
+    TCNEvent *const morning = [self eventFrom:@"09:00" to:@"10:00" onDay:today];
+    TCNEvent *const noon = [self eventFrom:@"12:00" to:@"13:00" onDay:today];
+    TCNEvent *const instant = [self eventFrom:@"11:00" to:@"11:00" onDay:today];
+    TCNEventStore *const store = [[TCNEventStore alloc] initWithEvents:@[noon, morning, instant]];
+
+    NSArray<TCNEvent *> *const events = [store eventsOverlappingStartDate:[TCNTestUtils dateWithTime:@"09:30" onDay:today]
+                                                                  endDate:[TCNTestUtils dateWithTime:@"12:00" onDay:today]];
+    XCTAssertEqualObjects(events, (@[morning, instant]));
+}
+
+- (void)testDataSourceEventsFollowChanges {
+    NSDate *const today = [NSDate date];
+    TCNEvent *const event = [self eventFrom:@"09:00" to:@"10:00" onDay:today];
+    TCNEvent *const allDayEvent = [[TCNEvent alloc] initWithName:@"All day"
+                                                   startDateTime:[TCNTestUtils dateWithTime:@"00:00" onDay:today]
+                                                     endDateTime:[TCNTestUtils dateWithTime:@"23:59" onDay:today]
+                                                        location:nil
+                                                        timezone:nil
+                                                        isAllDay:YES];
+    TCNEventStore *const store = [[TCNEventStore alloc] initWithEvents:@[event]];
+    store.currentDate = today;
+    XCTAssertEqualObjects(store.dayEvents, @[event]);
+
+    [store addEvent:allDayEvent];
+    XCTAssertEqualObjects(store.dayEvents, @[event]);
+    XCTAssertEqualObjects(store.allDayEvents, @[allDayEvent]);
+
+    [store removeEvent:event];
+    XCTAssertEqual(store.dayEvents.count, 0u);
+
+    store.currentDate = [TCNTestUtils dateWithTime:@"12:00" onDay:today daysToAdd:2];
+    XCTAssertEqual(store.allDayEvents.count, 0u);
+}
+
+#pragma mark - Helpers
+
+- (nonnull TCNEvent *)eventFrom:(nonnull NSString *)startTime to:(nonnull NSString *)endTime onDay:(nonnull NSDate *)day {
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Event"
+                                             startDateTime:[TCNTestUtils dateWithTime:startTime onDay:day]
+                                               endDateTime:[TCNTestUtils dateWithTime:endTime onDay:day]
+                                                  location:nil
+                                                  timezone:nil
+                                                  isAllDay:NO];
+    XCTAssertNotNil(event);
+    return event ?: [[TCNEvent alloc] initWithName:@"Event" startDateTime:day];
+}
+
+/**
+ Events starting within three days of @c date, lasting from zero minutes to two days, on a five minute grid so that
+ many start or end exactly at midnight.
+ */
++ (nonnull NSArray<TCNEvent *> *)randomEventsAroundDate:(nonnull NSDate *)date count:(NSUInteger)count {
+    NSDate *const start = [TCNTestUtils dateWithTime:@"00:00" onDay:date daysToAdd:-3];
+    NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] initWithCapacity:count];
+    srand48(7);
+    for (NSUInteger i = 0; i < count; i++) {
+        const NSTimeInterval startOffset = (NSTimeInterval)((NSInteger)(drand48() * 6 * 24 * 12) * 5 * 60);
+        const NSTimeInterval duration = (NSTimeInterval)((NSInteger)(drand48() * drand48() * 2 * 24 * 12) * 5 * 60);
+        NSDate *const startDateTime = [start dateByAddingTimeInterval:startOffset];
+        TCNEvent *const event = [[TCNEvent alloc] initWithName:[NSString stringWithFormat:@"Event %lu", (unsigned long)i]
+                                                 startDateTime:startDateTime
+                                                   endDateTime:[startDateTime dateByAddingTimeInterval:duration]
+                                                      location:nil
+                                                      timezone:nil
+                                                      isAllDay:NO];
+        if (event) {
+            [events addObject:event];
+        }
+    }
+    return events;
+}
+
+@end
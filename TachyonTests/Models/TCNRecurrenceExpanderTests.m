@@ -0,0 +1,182 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNEventStore.h"
+#import "TCNRecurrenceExpander.h"
+
+@interface TCNRecurrenceExpanderTests : XCTestCase
+
+@property (nonatomic, strong, nonnull) NSCalendar *calendar;
+
+@end
+
+@implementation TCNRecurrenceExpanderTests
+
+- (void)setUp {
+    [super setUp];
+    self.calendar = [NSCalendar calendarWithIdentifier:NSCalendarIdentifierGregorian];
+    self.calendar.timeZone = [NSTimeZone localTimeZone];
+}
+
+- (void)testDailyCountLimitsOccurrences {
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:1 rule:[self ruleWithFrequency:TCNRecurrenceFrequencyDaily interval:2 count:5]];
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:@[event]];
+
+    NSArray<TCNEvent *> *const occurrences = [expander occurrencesOverlappingStartDate:[self dateOnMonth:1 day:1 hour:0]
+                                                                               endDate:[self dateOnMonth:2 day:1 hour:0]];
+    XCTAssertEqualObjects([self daysOfOccurrences:occurrences], (@[@1, @3, @5, @7, @9]));
+}
+
+- (void)testWeeklyUntilDateAndExceptions {
+    TCNRecurrenceRule *const rule = [[TCNRecurrenceRule alloc] initWithFrequency:TCNRecurrenceFrequencyWeekly
+                                                                        interval:1
+                                                                           count:0
+                                                                       untilDate:[self dateOnMonth:1 day:29 hour:9]
+                                                                  exceptionDates:[NSSet setWithObject:[self dateOnMonth:1 day:15 hour:9]]];
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:1 rule:rule];
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:@[event]];
+
+    NSArray<TCNEvent *> *const occurrences = [expander occurrencesOverlappingStartDate:[self dateOnMonth:1 day:1 hour:0]
+                                                                               endDate:[self dateOnMonth:3 day:1 hour:0]];
+    XCTAssertEqualObjects([self daysOfOccurrences:occurrences], (@[@1, @8, @22, @29]));
+}
+
+- (void)testMonthlySkipsMonthsWithoutTheDay {
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:31 rule:[self ruleWithFrequency:TCNRecurrenceFrequencyMonthly interval:1 count:4]];
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:@[event]];
+
+    NSArray<TCNEvent *> *const occurrences = [expander occurrencesOverlappingStartDate:[self dateOnMonth:1 day:1 hour:0]
+                                                                               endDate:[self dateOnMonth:12 day:1 hour:0]];
+    NSMutableArray<NSNumber *> *const months = [[NSMutableArray alloc] init];
+    for (TCNEvent *const occurrence in occurrences) {
+        [months addObject:@([self.calendar component:NSCalendarUnitMonth fromDate:occurrence.startDateTime])];
+    }
+    XCTAssertEqualObjects(months, (@[@1, @3, @5, @7]));
+}
+
+- (void)testMonthlyOnLeapDaySkipsTheCenturyYear {
+    // 2100 isn't a leap year, so the rule skips the 95 months between February 2096 and February 2104
+    NSDateComponents *const components = [[NSDateComponents alloc] init];
+    components.year = 2096;
+    components.month = 2;
+    components.day = 29;
+    components.hour = 9;
+    NSDate *const startDate = [self.calendar dateFromComponents:components] ?: [NSDate date];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Standup"
+                                             startDateTime:startDate
+                                               endDateTime:[startDate dateByAddingTimeInterval:1800]
+                                                  location:nil
+                                                  timezone:nil
+                                                  isAllDay:NO
+                                            recurrenceRule:[self ruleWithFrequency:TCNRecurrenceFrequencyMonthly interval:1 count:3]];
+    XCTAssertNotNil(event);
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:event ? @[event] : @[]];
+
+    NSArray<TCNEvent *> *const occurrences = [expander occurrencesOverlappingStartDate:startDate
+                                                                               endDate:[self.calendar dateByAddingUnit:NSCalendarUnitYear value:20 toDate:startDate options:0] ?: startDate];
+    NSMutableArray<NSNumber *> *const years = [[NSMutableArray alloc] init];
+    for (TCNEvent *const occurrence in occurrences) {
+        [years addObject:@([self.calendar component:NSCalendarUnitYear fromDate:occurrence.startDateTime])];
+    }
+    XCTAssertEqualObjects(years, (@[@2096, @2104, @2108]));
+}
+
+- (void)testDistantWindowKeepsWallClockTime {
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:1 rule:[self ruleWithFrequency:TCNRecurrenceFrequencyDaily interval:1 count:0]];
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:@[event]];
+
+    NSDate *const distantDay = [self.calendar dateByAddingUnit:NSCalendarUnitYear value:10 toDate:[self dateOnMonth:7 day:4 hour:12] options:0];
+    NSArray<TCNEvent *> *const occurrences = [expander occurrencesOnDay:distantDay];
+    XCTAssertEqual(occurrences.count, 1u);
+    XCTAssertEqual([self.calendar component:NSCalendarUnitHour fromDate:occurrences.firstObject.startDateTime], 9);
+    XCTAssertTrue([self.calendar isDate:occurrences.firstObject.startDateTime inSameDayAsDate:distantDay]);
+}
+
+- (void)testOccurrencesAreReused {
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:1 rule:[self ruleWithFrequency:TCNRecurrenceFrequencyDaily interval:1 count:0]];
+    TCNRecurrenceExpander *const expander = [[TCNRecurrenceExpander alloc] initWithEvents:@[event]];
+
+    NSDate *const day = [self dateOnMonth:2 day:10 hour:12];
+    TCNEvent *const occurrence = [expander occurrencesOnDay:day].firstObject;
+    XCTAssertEqual(occurrence.seriesEvent, event);
+    XCTAssertNil(occurrence.recurrenceRule);
+    XCTAssertEqual([expander occurrencesOnDay:day].firstObject, occurrence);
+    XCTAssertEqual([expander occurrencesOverlappingStartDate:[self dateOnMonth:2 day:10 hour:0]
+                                                     endDate:[self dateOnMonth:2 day:11 hour:0]].firstObject, occurrence);
+}
+
+- (void)testEventStoreReturnsOccurrences {
+    TCNEvent *const event = [self eventStartingOnMonth:1 day:1 rule:[self ruleWithFrequency:TCNRecurrenceFrequencyWeekly interval:1 count:0]];
+    TCNEventStore *const store = [[TCNEventStore alloc] initWithEvents:@[event]];
+
+    NSArray<TCNEvent *> *const events = [store eventsOnDay:[self dateOnMonth:1 day:8 hour:12]];
+    XCTAssertEqual(events.count, 1u);
+    XCTAssertEqual(events.firstObject.seriesEvent, event);
+    XCTAssertEqual([store eventsOnDay:[self dateOnMonth:1 day:9 hour:12]].count, 0u);
+
+    [store removeEvent:event];
+    XCTAssertEqual([store eventsOnDay:[self dateOnMonth:1 day:8 hour:12]].count, 0u);
+}
+
+- (void)testRRuleStrings {
+    TCNRecurrenceRule *const rule = [TCNRecurrenceRule ruleWithRRuleString:@"RRULE:FREQ=WEEKLY;INTERVAL=2;COUNT=10" exceptionDates:[NSSet set]];
+    XCTAssertEqual(rule.frequency, TCNRecurrenceFrequencyWeekly);
+    XCTAssertEqual(rule.interval, 2);
+    XCTAssertEqual(rule.count, 10);
+    XCTAssertNil(rule.untilDate);
+
+    NSDate *const untilDate = [TCNRecurrenceRule ruleWithRRuleString:@"FREQ=DAILY;UNTIL=20190301T120000Z" exceptionDates:[NSSet set]].untilDate;
+    XCTAssertEqualObjects(untilDate, [NSDate dateWithTimeIntervalSince1970:1551441600]);
+
+    XCTAssertNil([TCNRecurrenceRule ruleWithRRuleString:@"FREQ=YEARLY" exceptionDates:[NSSet set]]);
+    XCTAssertNil([TCNRecurrenceRule ruleWithRRuleString:@"FREQ=WEEKLY;BYDAY=MO,WE" exceptionDates:[NSSet set]]);
+    XCTAssertNil([TCNRecurrenceRule ruleWithRRuleString:@"FREQ=DAILY;INTERVAL=0" exceptionDates:[NSSet set]]);
+}
+
+#pragma mark - Helpers
+
+- (nonnull NSDate *)dateOnMonth:(NSInteger)month day:(NSInteger)day hour:(NSInteger)hour {
+    NSDateComponents *const components = [[NSDateComponents alloc] init];
+    components.year = 2019;
+    components.month = month;
+    components.day = day;
+    components.hour = hour;
+    NSDate *const date = [self.calendar dateFromComponents:components];
+    XCTAssertNotNil(date);
+    return date ?: [NSDate date];
+}
+
+- (nonnull TCNRecurrenceRule *)ruleWithFrequency:(TCNRecurrenceFrequency)frequency interval:(NSInteger)interval count:(NSInteger)count {
+    TCNRecurrenceRule *const rule = [[TCNRecurrenceRule alloc] initWithFrequency:frequency
+                                                                        interval:interval
+                                                                           count:count
+                                                                       untilDate:nil
+                                                                  exceptionDates:[NSSet set]];
+    XCTAssertNotNil(rule);
+    return rule ?: [[TCNRecurrenceRule alloc] initWithFrequency:frequency interval:1 count:0 untilDate:nil exceptionDates:[NSSet set]];
+}
+
+/**
+ A half hour event at 9:00 on the given day of 2019.
+ */
+- (nonnull TCNEvent *)eventStartingOnMonth:(NSInteger)month day:(NSInteger)day rule:(nonnull TCNRecurrenceRule *)rule {
+    NSDate *const startDate = [self dateOnMonth:month day:day hour:9];
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"Standup"
+                                             startDateTime:startDate
+                                               endDateTime:[startDate dateByAddingTimeInterval:1800]
+                                                  location:nil
+                                                  timezone:nil
+                                                  isAllDay:NO
+                                            recurrenceRule:rule];
+    XCTAssertNotNil(event);
+    return event ?: [[TCNEvent alloc] initWithName:@"Standup" startDateTime:startDate];
+}
+
+- (nonnull NSArray<NSNumber *> *)daysOfOccurrences:(nonnull NSArray<TCNEvent *> *)occurrences {
+    NSMutableArray<NSNumber *> *const days = [[NSMutableArray alloc] init];
+    for (TCNEvent *const occurrence in occurrences) {
+        [days addObject:@([self.calendar component:NSCalendarUnitDay fromDate:occurrence.startDateTime])];
+    }
+    return days;
+}
+
+@end
@@ -0,0 +1,68 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNAvailabilityEngine.h"
+
+@interface TCNAvailabilityEngineTests : XCTestCase
+
+@end
+
+/**
+ @c TCNAvailabilityEngine is plain C with no Foundation dependency, so these tests use small integer timestamps.
+ */
+@implementation TCNAvailabilityEngineTests
+
+- (void)testNoBusyTimeReturnsBounds {
+    const TCNAvailabilityInterval bounds[] = {{0, 10}, {20, 30}};
+    TCNAvailabilityInterval windows[4];
+    size_t windowCount = 0;
+    XCTAssertEqual(TCNAvailabilityEngineFindFreeWindows(NULL, 0, bounds, 2, 1, windows, 4, &windowCount), 0);
+
+    XCTAssertEqual(windowCount, 2u);
+    XCTAssertEqual(windows[1].start, 20);
+    XCTAssertEqual(windows[1].end, 30);
+}
+
+- (void)testBusyTimeOfEveryCalendarIsMerged {
+    const TCNAvailabilityInterval first[] = {{10, 20}, {30, 40}};
+    const TCNAvailabilityInterval second[] = {{15, 25}, {50, 60}};
+    const TCNAvailabilityCalendar calendars[] = {{first, 2}, {second, 2}};
+    const TCNAvailabilityInterval bounds[] = {{0, 35}, {45, 100}};
+    TCNAvailabilityInterval windows[8];
+    size_t windowCount = 0;
+    XCTAssertEqual(TCNAvailabilityEngineFindFreeWindows(calendars, 2, bounds, 2, 5, windows, 8, &windowCount), 0);
+
+    const TCNAvailabilityInterval expected[] = {{0, 10}, {25, 30}, {45, 50}, {60, 100}};
+    XCTAssertEqual(windowCount, 4u);
+    for (size_t i = 0; i < 4; i++) {
+        XCTAssertEqual(windows[i].start, expected[i].start);
+        XCTAssertEqual(windows[i].end, expected[i].end);
+    }
+}
+
+- (void)testShortWindowsAreSkipped {
+    const TCNAvailabilityInterval busy[] = {{2, 8}, {9, 20}};
+    const TCNAvailabilityCalendar calendars[] = {{busy, 2}};
+    const TCNAvailabilityInterval bounds[] = {{0, 30}};
+    TCNAvailabilityInterval windows[4];
+    size_t windowCount = 0;
+    XCTAssertEqual(TCNAvailabilityEngineFindFreeWindows(calendars, 1, bounds, 1, 3, windows, 4, &windowCount), 0);
+
+    XCTAssertEqual(windowCount, 1u);
+    XCTAssertEqual(windows[0].start, 20);
+    XCTAssertEqual(windows[0].end, 30);
+}
+
+- (void)testSearchStopsAtMaximumWindowCount {
+    const TCNAvailabilityInterval busy[] = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    const TCNAvailabilityCalendar calendars[] = {{busy, 4}};
+    const TCNAvailabilityInterval bounds[] = {{0, 10}};
+    TCNAvailabilityInterval windows[2];
+    size_t windowCount = 0;
+    XCTAssertEqual(TCNAvailabilityEngineFindFreeWindows(calendars, 1, bounds, 1, 1, windows, 2, &windowCount), 0);
+
+    XCTAssertEqual(windowCount, 2u);
+    XCTAssertEqual(windows[0].start, 0);
+    XCTAssertEqual(windows[1].start, 2);
+}
+
+@end
@@ -0,0 +1,134 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNCalendarContext.h"
+
+@interface TCNCalendarContextTests : XCTestCase
+
+@property (nonatomic, strong, nonnull) NSCalendar *calendar;
+
+@end
+
+/**
+ Compares the context's table lookups with @c NSCalendar, in a time zone with daylight saving time.
+ */
+@implementation TCNCalendarContextTests
+
+- (void)setUp {
+    [super setUp];
+    [NSTimeZone setDefaultTimeZone:[NSTimeZone timeZoneWithName:@"America/Los_Angeles"]];
+    [TCNCalendarContext.sharedContext invalidate];
+    self.calendar = TCNCalendarContext.sharedContext.calendar;
+}
+
+- (void)tearDown {
+    [NSTimeZone setDefaultTimeZone:[NSTimeZone systemTimeZone]];
+    [TCNCalendarContext.sharedContext invalidate];
+    [super tearDown];
+}
+
+- (void)testMatchesCalendarAcrossDaylightSavingTime {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    NSDate *const startDate = [self dateWithYear:2019 month:3 day:9];
+    NSDate *const endDate = [self dateWithYear:2019 month:11 day:4];
+    [context prepareDaysFromDate:startDate toDate:endDate];
+
+    // Every 7 minutes, so each minute of the day is hit across the range
+    for (NSTimeInterval interval = -86400; interval < [endDate timeIntervalSinceDate:startDate] + (2 * 86400); interval += 7 * 60) {
+        NSDate *const date = [startDate dateByAddingTimeInterval:interval];
+        NSDateComponents *const components = [self.calendar components:NSCalendarUnitHour | NSCalendarUnitMinute fromDate:date];
+        XCTAssertEqual([context minuteOfDayForDate:date], (components.hour * 60) + components.minute, @"%@", date);
+        XCTAssertEqualObjects([context startOfDayForDate:date], [self.calendar startOfDayForDate:date], @"%@", date);
+    }
+}
+
+- (void)testDaysAreConsecutive {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    NSDate *const date = [self dateWithYear:2019 month:3 day:10];
+    [context prepareDaysFromDate:date toDate:date];
+
+    NSDate *const nextDay = [self.calendar dateByAddingUnit:NSCalendarUnitDay value:1 toDate:date options:0];
+    XCTAssertEqual([context dayMinuteForDate:nextDay].day, [context dayMinuteForDate:date].day + 1);
+    XCTAssertEqual([context dayMinuteForDate:[nextDay dateByAddingTimeInterval:-60]].day, [context dayMinuteForDate:date].day);
+}
+
+- (void)testStartOfDayAndWeekdayOfDay {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    NSDate *const date = [self dateWithYear:2019 month:11 day:1];
+    const NSInteger firstDay = [context dayMinuteForDate:date].day;
+
+    for (NSInteger day = firstDay - 10; day < firstDay + 10; day++) {
+        NSDate *const startOfDay = [context startOfDay:day];
+        XCTAssertEqual([context dayMinuteForDate:startOfDay].day, day);
+        XCTAssertEqualObjects(startOfDay, [self.calendar startOfDayForDate:startOfDay]);
+        XCTAssertEqual([context weekdayOfDay:day], [self.calendar component:NSCalendarUnitWeekday fromDate:startOfDay]);
+    }
+}
+
+- (void)testDateAtMinuteOfDayUsesClockTimeAcrossDaylightSavingTime {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    NSDate *const springForward = [self dateWithYear:2019 month:3 day:10];
+    NSDate *const fallBack = [self dateWithYear:2019 month:11 day:3];
+    [context prepareDaysFromDate:springForward toDate:fallBack];
+
+    for (NSDate *day in @[springForward, fallBack]) {
+        NSDate *const date = [context dateAtMinuteOfDay:600 ofDate:day];
+        XCTAssertNotNil(date);
+        XCTAssertEqual([context minuteOfDayForDate:date ?: day], 600);
+        XCTAssertEqualObjects([self.calendar startOfDayForDate:date ?: [NSDate date]], day);
+    }
+
+    // 2:30 doesn't exist on the day clocks go forward
+    NSDate *const skippedDate = [context dateAtMinuteOfDay:150 ofDate:springForward];
+    XCTAssertEqual([context minuteOfDayForDate:skippedDate ?: springForward], 210);
+
+    NSDate *const nextDay = [self.calendar dateByAddingUnit:NSCalendarUnitDay value:1 toDate:fallBack options:0];
+    XCTAssertEqualObjects([context dateAtMinuteOfDay:1440 ofDate:fallBack], nextDay);
+}
+
+- (void)testRangeEndingOnDaylightSavingTimeChange {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    for (NSDate *day in @[[self dateWithYear:2019 month:3 day:10], [self dateWithYear:2019 month:11 day:3]]) {
+        [context invalidate];
+        [context prepareDaysFromDate:day toDate:day];
+
+        // Around the end of the last prepared day, which is 23 or 25 hours long
+        NSDate *const nextDay = [self.calendar dateByAddingUnit:NSCalendarUnitDay value:1 toDate:day options:0];
+        for (NSTimeInterval interval = -2 * 3600; interval < 2 * 3600; interval += 15 * 60) {
+            NSDate *const date = [nextDay dateByAddingTimeInterval:interval];
+            NSDateComponents *const components = [self.calendar components:NSCalendarUnitHour | NSCalendarUnitMinute fromDate:date];
+            XCTAssertEqual([context minuteOfDayForDate:date], (components.hour * 60) + components.minute, @"%@", date);
+            XCTAssertEqualObjects([context startOfDayForDate:date], [self.calendar startOfDayForDate:date], @"%@", date);
+        }
+    }
+}
+
+- (void)testInvalidatePostsNotificationWithNewTimeZone {
+    TCNCalendarContext *const context = TCNCalendarContext.sharedContext;
+    __block NSTimeZone *notifiedTimeZone;
+    id<NSObject> const observer = [NSNotificationCenter.defaultCenter addObserverForName:TCNCalendarContextDidInvalidateNotification
+                                                                                  object:context
+                                                                                   queue:nil
+                                                                              usingBlock:^(__unused NSNotification *notification) {
+        notifiedTimeZone = context.timeZone;
+    }];
+
+    [NSTimeZone setDefaultTimeZone:[NSTimeZone timeZoneWithName:@"America/New_York"]];
+    [context invalidate];
+    [NSNotificationCenter.defaultCenter removeObserver:observer];
+
+    XCTAssertEqualObjects(notifiedTimeZone.name, @"America/New_York");
+}
+
+#pragma mark - Helpers
+
+- (nonnull NSDate *)dateWithYear:(NSInteger)year month:(NSInteger)month day:(NSInteger)day {
+    NSDateComponents *const components = [[NSDateComponents alloc] init];
+    components.year = year;
+    components.month = month;
+    components.day = day;
+    NSDate *const date = [self.calendar dateFromComponents:components];
+    XCTAssertNotNil(date);
+    return date ?: [NSDate date];
+}
+
+@end
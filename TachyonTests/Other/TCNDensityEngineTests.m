@@ -0,0 +1,56 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNDensityEngine.h"
+
+@interface TCNDensityEngineTests : XCTestCase
+
+@end
+
+/**
+ @c TCNDensityEngine is plain C with no Foundation dependency, so these tests use days 100 seconds long.
+ */
+@implementation TCNDensityEngineTests
+
+static const double DayBoundaries[] = {0, 100, 200, 300};
+
+- (void)testNoEvents {
+    TCNDensityDay days[3];
+    XCTAssertEqual(TCNDensityEngineComputeDays(NULL, 0, DayBoundaries, 3, days), 0);
+
+    XCTAssertEqual(days[0].eventCount, 0u);
+    XCTAssertEqual(days[2].busySeconds, 0);
+}
+
+- (void)testEventsAreCountedOnEveryDayTheyOverlap {
+    const TCNDensityInterval intervals[] = {{50, 250, true}, {120, 130, false}, {-50, 0, true}, {200, 200, true}};
+    TCNDensityDay days[3];
+    XCTAssertEqual(TCNDensityEngineComputeDays(intervals, 4, DayBoundaries, 3, days), 0);
+
+    // The event ending at 0 ends before the first day, and the empty event is only on the day it starts
+    XCTAssertEqual(days[0].eventCount, 1u);
+    XCTAssertEqual(days[1].eventCount, 2u);
+    XCTAssertEqual(days[2].eventCount, 2u);
+}
+
+- (void)testOverlappingBusyTimeIsCountedOnce {
+    const TCNDensityInterval intervals[] = {{110, 150, true}, {130, 170, true}, {160, 220, true}, {140, 190, false}};
+    TCNDensityDay days[3];
+    XCTAssertEqual(TCNDensityEngineComputeDays(intervals, 4, DayBoundaries, 3, days), 0);
+
+    XCTAssertEqual(days[0].busySeconds, 0);
+    XCTAssertEqual(days[1].busySeconds, 90);
+    XCTAssertEqual(days[2].busySeconds, 20);
+    XCTAssertEqual(days[1].eventCount, 4u);
+}
+
+- (void)testEventsOutsideTheDaysAreClipped {
+    const TCNDensityInterval intervals[] = {{-100, 50, true}, {280, 400, true}, {500, 600, true}};
+    TCNDensityDay days[3];
+    XCTAssertEqual(TCNDensityEngineComputeDays(intervals, 3, DayBoundaries, 3, days), 0);
+
+    XCTAssertEqual(days[0].busySeconds, 50);
+    XCTAssertEqual(days[2].busySeconds, 20);
+    XCTAssertEqual(days[2].eventCount, 1u);
+}
+
+@end
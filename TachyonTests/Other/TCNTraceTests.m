@@ -0,0 +1,102 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNPassMetrics.h"
+#import "TCNTrace.h"
+
+/**
+ Records the intervals it receives as "begin <name> <identifier>" and "end <name> <identifier>".
+ */
+@interface TCNRecordingTraceBackend : NSObject <TCNTraceBackend>
+
+@property (nonatomic, strong, nonnull, readonly) NSMutableArray<NSString *> *events;
+
+@end
+
+@implementation TCNRecordingTraceBackend
+
+- (nonnull instancetype)init {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    _events = [[NSMutableArray alloc] init];
+
+    return self;
+}
+
+- (void)beginIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier {
+    [self.events addObject:[NSString stringWithFormat:@"begin %@ %llu", [TCNTrace stringForName:name], identifier]];
+}
+
+- (void)endIntervalWithName:(TCNTraceName)name identifier:(uint64_t)identifier {
+    [self.events addObject:[NSString stringWithFormat:@"end %@ %llu", [TCNTrace stringForName:name], identifier]];
+}
+
+@end
+
+@interface TCNTraceTests : XCTestCase
+
+@end
+
+@implementation TCNTraceTests
+
+- (void)tearDown {
+    TCNTrace.backend = nil;
+    [super tearDown];
+}
+
+- (void)testNoBackendByDefault {
+    XCTAssertNil(TCNTrace.backend);
+
+    const TCNTraceInterval interval = TCNTraceBegin(TCNTraceNameReload);
+    XCTAssertEqual(interval.identifier, 0u);
+    XCTAssertGreaterThanOrEqual(TCNTraceEnd(interval), 0);
+}
+
+- (void)testNestedIntervalsAreBalanced {
+    TCNRecordingTraceBackend *const backend = [[TCNRecordingTraceBackend alloc] init];
+    TCNTrace.backend = backend;
+
+    const TCNTraceInterval outerInterval = TCNTraceBegin(TCNTraceNamePrepareLayout);
+    const TCNTraceInterval innerInterval = TCNTraceBegin(TCNTraceNameOverlapAdjustment);
+    TCNTraceEnd(innerInterval);
+    TCNTraceEnd(outerInterval);
+
+    XCTAssertNotEqual(outerInterval.identifier, innerInterval.identifier);
+    NSArray<NSString *> *const expectedEvents = @[
+        [NSString stringWithFormat:@"begin prepareLayout %llu", outerInterval.identifier],
+        [NSString stringWithFormat:@"begin overlapAdjustment %llu", innerInterval.identifier],
+        [NSString stringWithFormat:@"end overlapAdjustment %llu", innerInterval.identifier],
+        [NSString stringWithFormat:@"end prepareLayout %llu", outerInterval.identifier],
+    ];
+    XCTAssertEqualObjects(backend.events, expectedEvents);
+}
+
+- (void)testIntervalStartedWithoutBackendIsNotEnded {
+    const TCNTraceInterval interval = TCNTraceBegin(TCNTraceNameElementsInRect);
+
+    TCNRecordingTraceBackend *const backend = [[TCNRecordingTraceBackend alloc] init];
+    TCNTrace.backend = backend;
+    TCNTraceEnd(interval);
+
+    XCTAssertEqual(backend.events.count, 0u);
+}
+
+- (void)testCacheHitRate {
+    TCNPassMetrics *const metrics = [[TCNPassMetrics alloc] initWithName:TCNTraceNameWeekRegeneration
+                                                                duration:0.001
+                                                            elementCount:21
+                                                           cacheHitCount:14
+                                                        cacheLookupCount:21];
+    XCTAssertEqualWithAccuracy(metrics.cacheHitRate, 14.0 / 21.0, 0.0001);
+
+    TCNPassMetrics *const uncachedMetrics = [[TCNPassMetrics alloc] initWithName:TCNTraceNameElementsInRect
+                                                                        duration:0.001
+                                                                    elementCount:10
+                                                                   cacheHitCount:0
+                                                                cacheLookupCount:0];
+    XCTAssertEqual(uncachedMetrics.cacheHitRate, 0);
+}
+
+@end
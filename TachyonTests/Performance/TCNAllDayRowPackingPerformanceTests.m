@@ -0,0 +1,200 @@
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+
+#import "TCNAllDayRowEngine.h"
+#import "TCNAllDayViewLayout.h"
+
+#pragma mark - TCNAllDayRowPackingDelegate
+
+/**
+ Provides multi-day all day events, like the time off and conferences on a team calendar, through
+ @c collectionView:layout:daysForItemAtIndexPath:.
+ */
+@interface TCNAllDayRowPackingDelegate : NSObject <TCNDayViewLayoutDelegate, UICollectionViewDataSource>
+
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSValue *> *days;
+
+- (nonnull instancetype)initWithEventCount:(NSInteger)eventCount dayCount:(NSInteger)dayCount;
+
+@end
+
+@implementation TCNAllDayRowPackingDelegate
+
+static const uint32_t Seed = 42;
+
+- (nonnull instancetype)initWithEventCount:(NSInteger)eventCount dayCount:(NSInteger)dayCount {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    NSMutableArray<NSValue *> *const days = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)eventCount];
+    srand48(Seed);
+    for (NSInteger event = 0; event < eventCount; event++) {
+        // Events of 1 to 5 days, some starting before the days shown
+        const NSInteger firstDay = (NSInteger)(drand48() * (double)(dayCount + 2)) - 2;
+        const NSInteger length = 1 + (NSInteger)(drand48() * 5);
+        const NSInteger location = MAX(0, firstDay);
+        [days addObject:[NSValue valueWithRange:NSMakeRange((NSUInteger)location, (NSUInteger)MAX(1, firstDay + length - location))]];
+    }
+    _days = days;
+
+    return self;
+}
+
+- (NSInteger)collectionView:(__unused UICollectionView *)collectionView numberOfItemsInSection:(__unused NSInteger)section {
+    return (NSInteger)self.days.count;
+}
+
+- (UICollectionViewCell *)collectionView:(__unused UICollectionView *)collectionView cellForItemAtIndexPath:(__unused NSIndexPath *)indexPath {
+    return [[UICollectionViewCell alloc] init];
+}
+
+- (nonnull NSDate *)collectionView:(nullable __unused UICollectionView *)collectionView
+                            layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+       startTimeForItemAtIndexPath:(nonnull __unused NSIndexPath *)indexPath {
+    return [NSDate date];
+}
+
+- (nonnull NSDate *)collectionView:(nullable __unused UICollectionView *)collectionView
+                            layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+         endTimeForItemAtIndexPath:(nonnull __unused NSIndexPath *)indexPath {
+    return [NSDate date];
+}
+
+- (BOOL)collectionView:(nullable __unused UICollectionView *)collectionView
+                                layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+  shouldAdjustLayoutForItemAtIndexPath:(nonnull __unused NSIndexPath *)indexPath {
+    return NO;
+}
+
+- (NSRange)collectionView:(nullable __unused UICollectionView *)collectionView
+                   layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+   daysForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    return self.days[(NSUInteger)indexPath.item].rangeValue;
+}
+
+@end
+
+#pragma mark - TCNAllDayRowPackingPerformanceTests
+
+@interface TCNAllDayRowPackingPerformanceTests : XCTestCase
+
+@end
+
+/**
+ Measures packing multi-day all day events into rows, on its own over a year of days and as part of a
+ @c TCNAllDayViewLayout pass over a week, in a collection view that is never put in a window. The layout is checked to
+ use as many rows as the most events on any one day, and to count every event that doesn't fit under a row limit.
+ */
+@implementation TCNAllDayRowPackingPerformanceTests
+
+static const NSInteger DaysInWeek = 7;
+static const NSInteger DaysInYear = 365;
+
+#pragma mark - Engine
+
+- (void)testComputeRows10000EventsOverAYear {
+    const size_t count = 10000;
+    TCNAllDayRowSpan *const spans = malloc(count * sizeof(TCNAllDayRowSpan));
+    uint32_t *const rows = malloc(count * sizeof(uint32_t));
+    uint32_t *const overflowCounts = malloc(DaysInYear * sizeof(uint32_t));
+    srand48(Seed);
+    for (size_t index = 0; index < count; index++) {
+        const int64_t firstDay = (int64_t)(drand48() * DaysInYear);
+        spans[index] = (TCNAllDayRowSpan){firstDay, firstDay + (int64_t)(drand48() * 14)};
+    }
+
+    [self measureBlock:^{
+        uint32_t rowCount = 0;
+        XCTAssertEqual(TCNAllDayRowEngineComputeRows(spans, count, DaysInYear, 4, rows, overflowCounts, &rowCount), 0);
+    }];
+
+    free(spans);
+    free(rows);
+    free(overflowCounts);
+}
+
+#pragma mark - Layout
+
+- (void)testRowsMatchBusiestDay {
+    TCNAllDayRowPackingDelegate *const delegate = [[TCNAllDayRowPackingDelegate alloc] initWithEventCount:200 dayCount:DaysInWeek];
+    UICollectionView *const collectionView = [TCNAllDayRowPackingPerformanceTests collectionViewWithDelegate:delegate maximumRowCount:0];
+    TCNAllDayViewLayout *const layout = (TCNAllDayViewLayout *)collectionView.collectionViewLayout;
+    [layout prepareLayout];
+
+    XCTAssertEqual(layout.rowCount, [TCNAllDayRowPackingPerformanceTests busiestDayEventCountForDelegate:delegate]);
+
+    // Events sharing a row never overlap
+    NSMutableArray<NSValue *> *const frames = [[NSMutableArray alloc] init];
+    for (NSUInteger item = 0; item < delegate.days.count; item++) {
+        const CGRect frame = [layout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:(NSInteger)item inSection:0]].frame;
+        for (NSValue *otherFrame in frames) {
+            XCTAssertFalse(CGRectIntersectsRect(frame, otherFrame.CGRectValue));
+        }
+        [frames addObject:[NSValue valueWithCGRect:frame]];
+    }
+}
+
+- (void)testOverflowRowCountsHiddenEvents {
+    TCNAllDayRowPackingDelegate *const delegate = [[TCNAllDayRowPackingDelegate alloc] initWithEventCount:200 dayCount:DaysInWeek];
+    UICollectionView *const collectionView = [TCNAllDayRowPackingPerformanceTests collectionViewWithDelegate:delegate maximumRowCount:3];
+    TCNAllDayViewLayout *const layout = (TCNAllDayViewLayout *)collectionView.collectionViewLayout;
+    [layout prepareLayout];
+    XCTAssertEqual(layout.rowCount, 3);
+
+    // Every event on a day is either shown or counted in that day's overflow view
+    for (NSInteger day = 0; day < DaysInWeek; day++) {
+        NSInteger shownEventCount = 0;
+        NSInteger eventCount = 0;
+        for (NSUInteger item = 0; item < delegate.days.count; item++) {
+            if (!NSLocationInRange((NSUInteger)day, delegate.days[item].rangeValue)) {
+                continue;
+            }
+            eventCount++;
+            if (![layout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:(NSInteger)item inSection:0]].hidden) {
+                shownEventCount++;
+            }
+        }
+        XCTAssertLessThanOrEqual(shownEventCount, 2);
+        XCTAssertEqual(shownEventCount + [layout hiddenEventCountForDay:day], eventCount);
+    }
+}
+
+- (void)testPrepareLayoutWith5000EventsOverAWeek {
+    TCNAllDayRowPackingDelegate *const delegate = [[TCNAllDayRowPackingDelegate alloc] initWithEventCount:5000 dayCount:DaysInWeek];
+    UICollectionView *const collectionView = [TCNAllDayRowPackingPerformanceTests collectionViewWithDelegate:delegate maximumRowCount:4];
+    [self measureBlock:^{
+        [collectionView.collectionViewLayout invalidateLayout];
+        [collectionView.collectionViewLayout prepareLayout];
+    }];
+}
+
+#pragma mark - Helpers
+
++ (NSInteger)busiestDayEventCountForDelegate:(nonnull TCNAllDayRowPackingDelegate *)delegate {
+    NSInteger busiestDayEventCount = 0;
+    for (NSInteger day = 0; day < DaysInWeek; day++) {
+        NSInteger eventCount = 0;
+        for (NSValue *days in delegate.days) {
+            if (NSLocationInRange((NSUInteger)day, days.rangeValue)) {
+                eventCount++;
+            }
+        }
+        busiestDayEventCount = MAX(busiestDayEventCount, eventCount);
+    }
+    return busiestDayEventCount;
+}
+
++ (nonnull UICollectionView *)collectionViewWithDelegate:(nonnull TCNAllDayRowPackingDelegate *)delegate maximumRowCount:(NSInteger)maximumRowCount {
+    TCNAllDayViewLayout *const layout = [[TCNAllDayViewLayout alloc] initWithConfig:[[TCNDayViewConfig alloc] init]];
+    layout.delegate = delegate;
+    layout.numberOfDays = DaysInWeek;
+    layout.maximumRowCount = maximumRowCount;
+    UICollectionView *const collectionView = [[UICollectionView alloc] initWithFrame:CGRectMake(0, 0, 375, 200) collectionViewLayout:layout];
+    collectionView.dataSource = delegate;
+    [collectionView reloadData];
+    return collectionView;
+}
+
+@end
@@ -0,0 +1,178 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNAvailabilityFinder.h"
+#import "TCNDateUtil.h"
+
+@interface TCNAvailabilityPerformanceTests : XCTestCase
+
+@end
+
+/**
+ Measures how finding common free time scales with the number of attendees and the length of the horizon, against
+ merging every attendee's events with @c +[TCNEvent mergedEventsForEvents:] and scanning the gaps.
+
+ Each attendee has about twenty events per working day, so a two week horizon holds hundreds of events per attendee.
+ */
+@implementation TCNAvailabilityPerformanceTests
+
+static const NSInteger EventsPerDay = 20;
+static const NSUInteger WindowCount = 5;
+static const NSTimeInterval MinimumDuration = 30 * 60;
+
+#pragma mark - Finder
+
+- (void)testFinder10AttendeesOneWeek {
+    [self measureFinderWithAttendeeCount:10 days:7];
+}
+
+- (void)testFinder50AttendeesOneWeek {
+    [self measureFinderWithAttendeeCount:50 days:7];
+}
+
+- (void)testFinder10AttendeesTwoWeeks {
+    [self measureFinderWithAttendeeCount:10 days:14];
+}
+
+- (void)testFinder50AttendeesTwoWeeks {
+    [self measureFinderWithAttendeeCount:50 days:14];
+}
+
+- (void)testFinder50AttendeesEightWeeks {
+    [self measureFinderWithAttendeeCount:50 days:56];
+}
+
+#pragma mark - Merged events
+
+- (void)testMergedEvents10AttendeesTwoWeeks {
+    [self measureMergedEventsWithAttendeeCount:10 days:14];
+}
+
+- (void)testMergedEvents50AttendeesTwoWeeks {
+    [self measureMergedEventsWithAttendeeCount:50 days:14];
+}
+
+- (void)testFinderMatchesMergedEvents {
+    NSDate *const startDate = [TCNAvailabilityPerformanceTests startDate];
+    NSDate *const endDate = [TCNDateUtil dateByAddingDays:14 toDate:startDate];
+    NSArray<NSArray<TCNEvent *> *> *const eventsByAttendee = [TCNAvailabilityPerformanceTests eventsByAttendeeWithCount:10 startDate:startDate days:14];
+
+    TCNAvailabilityFinder *const finder = [[TCNAvailabilityFinder alloc] initWithEventsByAttendee:eventsByAttendee];
+    finder.includesWeekends = YES;
+    NSArray<TCNEvent *> *const freeEvents = [finder freeEventsWithName:@"" fromDate:startDate toDate:endDate minimumDuration:MinimumDuration maximumCount:WindowCount];
+    NSArray<TCNEvent *> *const expectedEvents = [TCNAvailabilityPerformanceTests mergedFreeEventsForEventsByAttendee:eventsByAttendee
+                                                                                                           startDate:startDate
+                                                                                                             endDate:endDate];
+
+    XCTAssertEqual(freeEvents.count, expectedEvents.count);
+    for (NSUInteger i = 0; i < MIN(freeEvents.count, expectedEvents.count); i++) {
+        XCTAssertEqualObjects(freeEvents[i].startDateTime, expectedEvents[i].startDateTime);
+        XCTAssertEqualObjects(freeEvents[i].endDateTime, expectedEvents[i].endDateTime);
+    }
+}
+
+#pragma mark - Measurement
+
+- (void)measureFinderWithAttendeeCount:(NSInteger)attendeeCount days:(NSInteger)days {
+    NSDate *const startDate = [TCNAvailabilityPerformanceTests startDate];
+    NSDate *const endDate = [TCNDateUtil dateByAddingDays:days toDate:startDate];
+    NSArray<NSArray<TCNEvent *> *> *const eventsByAttendee = [TCNAvailabilityPerformanceTests eventsByAttendeeWithCount:attendeeCount startDate:startDate days:days];
+    [self measureBlock:^{
+        TCNAvailabilityFinder *const finder = [[TCNAvailabilityFinder alloc] initWithEventsByAttendee:eventsByAttendee];
+        finder.includesWeekends = YES;
+        [finder freeEventsWithName:@"" fromDate:startDate toDate:endDate minimumDuration:MinimumDuration maximumCount:WindowCount];
+    }];
+}
+
+- (void)measureMergedEventsWithAttendeeCount:(NSInteger)attendeeCount days:(NSInteger)days {
+    NSDate *const startDate = [TCNAvailabilityPerformanceTests startDate];
+    NSDate *const endDate = [TCNDateUtil dateByAddingDays:days toDate:startDate];
+    NSArray<NSArray<TCNEvent *> *> *const eventsByAttendee = [TCNAvailabilityPerformanceTests eventsByAttendeeWithCount:attendeeCount startDate:startDate days:days];
+    [self measureBlock:^{
+        [TCNAvailabilityPerformanceTests mergedFreeEventsForEventsByAttendee:eventsByAttendee startDate:startDate endDate:endDate];
+    }];
+}
+
+#pragma mark - Helpers
+
++ (nonnull NSDate *)startDate {
+    return [[NSCalendar currentCalendar] startOfDayForDate:[NSDate date]];
+}
+
+/**
+ Events from 8:00 to 18:00 on five minute boundaries, from 15 minutes to 2 hours long, with a fixed seed.
+ */
++ (nonnull NSArray<NSArray<TCNEvent *> *> *)eventsByAttendeeWithCount:(NSInteger)attendeeCount
+                                                            startDate:(nonnull NSDate *)startDate
+                                                                 days:(NSInteger)days {
+    srand48(11);
+    NSMutableArray<NSArray<TCNEvent *> *> *const eventsByAttendee = [[NSMutableArray alloc] init];
+    for (NSInteger attendee = 0; attendee < attendeeCount; attendee++) {
+        NSMutableArray<TCNEvent *> *const events = [[NSMutableArray alloc] init];
+        for (NSInteger day = 0; day < days; day++) {
+            NSDate *const dayStart = [TCNDateUtil dateByAddingDays:day toDate:startDate];
+            for (NSInteger i = 0; i < EventsPerDay; i++) {
+                const NSTimeInterval start = (8 * 3600) + ((NSInteger)(drand48() * 120) * 300);
+                const NSTimeInterval duration = (3 + (NSInteger)(drand48() * 21)) * 300;
+                NSDate *const startDateTime = [dayStart dateByAddingTimeInterval:start];
+                TCNEvent *const event = [[TCNEvent alloc] initWithName:@""
+                                                         startDateTime:startDateTime
+                                                           endDateTime:[startDateTime dateByAddingTimeInterval:duration]
+                                                              location:nil
+                                                              timezone:nil
+                                                              isAllDay:NO];
+                if (event) {
+                    [events addObject:event];
+                }
+            }
+        }
+        [eventsByAttendee addObject:events];
+    }
+    return eventsByAttendee;
+}
+
+/**
+ The first @c WindowCount free windows in working hours, found by merging every event into one list.
+ */
++ (nonnull NSArray<TCNEvent *> *)mergedFreeEventsForEventsByAttendee:(nonnull NSArray<NSArray<TCNEvent *> *> *)eventsByAttendee
+                                                           startDate:(nonnull NSDate *)startDate
+                                                             endDate:(nonnull NSDate *)endDate {
+    NSMutableArray<TCNEvent *> *const allEvents = [[NSMutableArray alloc] init];
+    for (NSArray<TCNEvent *> *events in eventsByAttendee) {
+        [allEvents addObjectsFromArray:events];
+    }
+    NSArray<TCNEvent *> *const busyEvents = [TCNEvent mergedEventsForEvents:allEvents];
+
+    NSMutableArray<TCNEvent *> *const freeEvents = [[NSMutableArray alloc] init];
+    for (NSDate *day = startDate; [TCNDateUtil date:endDate isAfterDate:day]; day = [TCNDateUtil dateByAddingDays:1 toDate:day]) {
+        NSDate *freeStart = [TCNDateUtil dateWithDate:day atHour:9];
+        NSDate *const workingHoursEnd = [TCNDateUtil dateWithDate:day atHour:17];
+        for (TCNEvent *busyEvent in busyEvents) {
+            if (![TCNDateUtil date:workingHoursEnd isAfterDate:busyEvent.startDateTime]) {
+                break;
+            }
+            if ([TCNDateUtil date:busyEvent.startDateTime isAfterDate:freeStart]) {
+                [self addFreeEventFrom:freeStart to:busyEvent.startDateTime toEvents:freeEvents];
+            }
+            freeStart = [TCNDateUtil latestDate:freeStart otherDate:busyEvent.endDateTime];
+        }
+        if ([TCNDateUtil date:workingHoursEnd isAfterDate:freeStart]) {
+            [self addFreeEventFrom:freeStart to:workingHoursEnd toEvents:freeEvents];
+        }
+        if (freeEvents.count >= WindowCount) {
+            return [freeEvents subarrayWithRange:NSMakeRange(0, WindowCount)];
+        }
+    }
+    return freeEvents;
+}
+
++ (void)addFreeEventFrom:(nonnull NSDate *)startDate to:(nonnull NSDate *)endDate toEvents:(nonnull NSMutableArray<TCNEvent *> *)events {
+    if ([endDate timeIntervalSinceDate:startDate] < MinimumDuration) {
+        return;
+    }
+    TCNEvent *const event = [[TCNEvent alloc] initWithName:@"" startDateTime:startDate endDateTime:endDate location:nil timezone:nil isAllDay:NO];
+    if (event) {
+        [events addObject:event];
+    }
+}
+
+@end
@@ -0,0 +1,539 @@
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+
+#import "TCNDayViewLayout.h"
+#import "TCNDayViewLayoutSnapshot.h"
+#import "TCNDayViewTimeView.h"
+#import "TCNMacros.h"
+
+#pragma mark - TCNDayViewLayoutPerformanceDelegate
+
+/**
+ Provides precomputed event times through the per-item @c TCNDayViewLayoutDelegate methods only.
+ */
+@interface TCNDayViewLayoutPerformanceDelegate : NSObject <TCNDayViewLayoutDelegate, UICollectionViewDataSource>
+
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSDate *> *startTimes;
+@property (nonatomic, copy, nonnull, readonly) NSArray<NSDate *> *endTimes;
+
+- (nonnull instancetype)initWithEventCount:(NSInteger)eventCount;
+
+/**
+ Moves the event of @c item to the given minutes of today.
+ */
+- (void)setStartMinute:(NSInteger)startMinute endMinute:(NSInteger)endMinute forItem:(NSInteger)item;
+
+@end
+
+@implementation TCNDayViewLayoutPerformanceDelegate
+
+static const uint32_t Seed = 42;
+
+- (nonnull instancetype)initWithEventCount:(NSInteger)eventCount {
+    self = [super init];
+    if (!self) {
+        return nil;
+    }
+
+    NSCalendar *const calendar = [NSCalendar currentCalendar];
+    NSDate *const startOfDay = [calendar startOfDayForDate:[NSDate date]];
+    NSMutableArray<NSDate *> *const startTimes = [[NSMutableArray alloc] init];
+    NSMutableArray<NSDate *> *const endTimes = [[NSMutableArray alloc] init];
+    srand48(Seed);
+    for (NSInteger event = 0; event < eventCount; event++) {
+        // Events of 15 minutes to 3 hours, starting on the quarter hour
+        const NSInteger startMinute = 15 * (NSInteger)(drand48() * 84);
+        const NSInteger length = 15 * (1 + (NSInteger)(drand48() * 12));
+        [startTimes addObject:[calendar dateByAddingUnit:NSCalendarUnitMinute value:startMinute toDate:startOfDay options:0]];
+        [endTimes addObject:[calendar dateByAddingUnit:NSCalendarUnitMinute value:startMinute + length toDate:startOfDay options:0]];
+    }
+    _startTimes = startTimes;
+    _endTimes = endTimes;
+
+    return self;
+}
+
+- (void)setStartMinute:(NSInteger)startMinute endMinute:(NSInteger)endMinute forItem:(NSInteger)item {
+    NSCalendar *const calendar = [NSCalendar currentCalendar];
+    NSDate *const startOfDay = [calendar startOfDayForDate:[NSDate date]];
+    NSMutableArray<NSDate *> *const startTimes = [self.startTimes mutableCopy];
+    NSMutableArray<NSDate *> *const endTimes = [self.endTimes mutableCopy];
+    startTimes[(NSUInteger)item] = [calendar dateByAddingUnit:NSCalendarUnitMinute value:startMinute toDate:startOfDay options:0];
+    endTimes[(NSUInteger)item] = [calendar dateByAddingUnit:NSCalendarUnitMinute value:endMinute toDate:startOfDay options:0];
+    _startTimes = startTimes;
+    _endTimes = endTimes;
+}
+
+- (NSInteger)collectionView:(__unused UICollectionView *)collectionView numberOfItemsInSection:(__unused NSInteger)section {
+    return (NSInteger)self.startTimes.count;
+}
+
+- (UICollectionViewCell *)collectionView:(__unused UICollectionView *)collectionView cellForItemAtIndexPath:(__unused NSIndexPath *)indexPath {
+    return [[UICollectionViewCell alloc] init];
+}
+
+- (nonnull NSDate *)collectionView:(nullable __unused UICollectionView *)collectionView
+                            layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+       startTimeForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    return self.startTimes[(NSUInteger)indexPath.item];
+}
+
+- (nonnull NSDate *)collectionView:(nullable __unused UICollectionView *)collectionView
+                            layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+         endTimeForItemAtIndexPath:(nonnull NSIndexPath *)indexPath {
+    return self.endTimes[(NSUInteger)indexPath.item];
+}
+
+- (BOOL)collectionView:(nullable __unused UICollectionView *)collectionView
+                                layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+  shouldAdjustLayoutForItemAtIndexPath:(nonnull __unused NSIndexPath *)indexPath {
+    return YES;
+}
+
+@end
+
+#pragma mark - TCNDayViewLayoutBulkPerformanceDelegate
+
+/**
+ Provides the same event times as its superclass, but also through the bulk time range method.
+ */
+@interface TCNDayViewLayoutBulkPerformanceDelegate : TCNDayViewLayoutPerformanceDelegate
+
+@end
+
+@implementation TCNDayViewLayoutBulkPerformanceDelegate
+
+- (BOOL)collectionView:(nullable __unused UICollectionView *)collectionView
+                layout:(nonnull __unused TCNDayViewLayout *)collectionViewLayout
+         getTimeRanges:(nonnull TCNDayViewLayoutItemTimeRange *)timeRanges
+     forItemsInSection:(__unused NSInteger)section
+                 count:(NSInteger)count {
+    NSCalendar *const calendar = [NSCalendar currentCalendar];
+    for (NSInteger item = 0; item < count; item++) {
+        NSInteger startHour, startMinute, endHour, endMinute;
+        [calendar getHour:&startHour minute:&startMinute second:NULL nanosecond:NULL fromDate:self.startTimes[(NSUInteger)item]];
+        [calendar getHour:&endHour minute:&endMinute second:NULL nanosecond:NULL fromDate:self.endTimes[(NSUInteger)item]];
+        timeRanges[item] = (TCNDayViewLayoutItemTimeRange){(startHour * 60) + startMinute, (endHour * 60) + endMinute, YES};
+    }
+    return YES;
+}
+
+@end
+
+#pragma mark - TCNDayViewLayoutMultiColumnPerformanceDelegate
+
+/**
+ Provides the same events as its superclass in every one of many sections, like a day view with a column per resource.
+ */
+@interface TCNDayViewLayoutMultiColumnPerformanceDelegate : TCNDayViewLayoutBulkPerformanceDelegate
+
+@end
+
+@implementation TCNDayViewLayoutMultiColumnPerformanceDelegate
+
+static const NSInteger NumberOfColumns = 200;
+
+- (NSInteger)numberOfSectionsInCollectionView:(__unused UICollectionView *)collectionView {
+    return NumberOfColumns;
+}
+
+@end
+
+#pragma mark - TCNDayViewLayoutPerformanceTests
+
+@interface TCNDayViewLayoutPerformanceTests : XCTestCase
+
+@end
+
+/**
+ Measures a full @c prepareLayout pass of @c TCNDayViewLayout in a collection view that is never put in a window,
+ comparing per-item delegate input with the bulk time range method, and with many columns of which only a few are visible.
+ Frames computed on a background queue, frames shown from a layout snapshot, frames moved to a new width and frames of
+ a dragged event are checked against the main thread layout, and loading a snapshot from a file, resizing and dragging
+ are measured against a fresh layout. Hour labels at the edges of a rect are checked to be returned when zoomed out.
+ */
+@implementation TCNDayViewLayoutPerformanceTests
+
+#pragma mark - Per-item input
+
+- (void)testPrepareLayoutWithPerItemInput100Events {
+    [self measurePrepareLayoutWithDelegate:[[TCNDayViewLayoutPerformanceDelegate alloc] initWithEventCount:100]];
+}
+
+- (void)testPrepareLayoutWithPerItemInput1000Events {
+    [self measurePrepareLayoutWithDelegate:[[TCNDayViewLayoutPerformanceDelegate alloc] initWithEventCount:1000]];
+}
+
+#pragma mark - Bulk input
+
+- (void)testPrepareLayoutWithBulkInput100Events {
+    [self measurePrepareLayoutWithDelegate:[[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:100]];
+}
+
+- (void)testPrepareLayoutWithBulkInput1000Events {
+    [self measurePrepareLayoutWithDelegate:[[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000]];
+}
+
+- (void)testBulkInputMatchesPerItemInput {
+    TCNDayViewLayoutPerformanceDelegate *const perItemDelegate = [[TCNDayViewLayoutPerformanceDelegate alloc] initWithEventCount:200];
+    TCNDayViewLayoutPerformanceDelegate *const bulkDelegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:200];
+    UICollectionView *const perItemCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:perItemDelegate];
+    UICollectionView *const bulkCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:bulkDelegate];
+    [perItemCollectionView.collectionViewLayout prepareLayout];
+    [bulkCollectionView.collectionViewLayout prepareLayout];
+
+    for (NSInteger item = 0; item < 200; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:0];
+        XCTAssertTrue(CGRectEqualToRect([perItemCollectionView.collectionViewLayout layoutAttributesForItemAtIndexPath:indexPath].frame,
+                                        [bulkCollectionView.collectionViewLayout layoutAttributesForItemAtIndexPath:indexPath].frame));
+    }
+}
+
+#pragma mark - Background layout
+
+- (void)testBackgroundLayoutMatchesMainThreadLayout {
+    TCNDayViewLayoutPerformanceDelegate *const mainThreadDelegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    TCNDayViewLayoutPerformanceDelegate *const backgroundDelegate = [[TCNDayViewLayoutPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const mainThreadCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:mainThreadDelegate];
+    UICollectionView *const backgroundCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:backgroundDelegate];
+    TCNDayViewLayout *const backgroundLayout = (TCNDayViewLayout *)backgroundCollectionView.collectionViewLayout;
+    [mainThreadCollectionView.collectionViewLayout prepareLayout];
+
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Background layout finished"];
+    [backgroundLayout prepareEventLayoutInBackgroundWithCompletion:^(BOOL finished) {
+        XCTAssertTrue(finished);
+        [expectation fulfill];
+    }];
+
+    // Nothing is laid out on the main thread while the frames are computed
+    [backgroundLayout prepareLayout];
+    XCTAssertTrue([backgroundLayout layoutAttributesForItemAtIndexPath:[NSIndexPath indexPathForItem:0 inSection:0]].hidden);
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    [backgroundLayout prepareLayout];
+    for (NSInteger item = 0; item < 1000; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:0];
+        UICollectionViewLayoutAttributes *const mainThreadAttributes = [mainThreadCollectionView.collectionViewLayout layoutAttributesForItemAtIndexPath:indexPath];
+        UICollectionViewLayoutAttributes *const backgroundAttributes = [backgroundLayout layoutAttributesForItemAtIndexPath:indexPath];
+        XCTAssertTrue(CGRectEqualToRect(mainThreadAttributes.frame, backgroundAttributes.frame));
+        XCTAssertEqual(mainThreadAttributes.zIndex, backgroundAttributes.zIndex);
+        XCTAssertFalse(backgroundAttributes.hidden);
+    }
+}
+
+- (void)testBackgroundLayoutIsCancelledByNewerLayout {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+
+    XCTestExpectation *const cancelledExpectation = [self expectationWithDescription:@"First background layout cancelled"];
+    XCTestExpectation *const finishedExpectation = [self expectationWithDescription:@"Second background layout finished"];
+    [layout prepareEventLayoutInBackgroundWithCompletion:^(BOOL finished) {
+        XCTAssertFalse(finished);
+        [cancelledExpectation fulfill];
+    }];
+    [layout prepareEventLayoutInBackgroundWithCompletion:^(BOOL finished) {
+        XCTAssertTrue(finished);
+        [finishedExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+#pragma mark - Layout snapshots
+
+- (void)testPrepareLayoutFromSnapshot1000Events {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    const TCNLayoutSnapshotKey key = [layout layoutSnapshotKeyForDate:[NSDate date] dataVersion:1];
+    NSURL *const fileURL = [[NSURL fileURLWithPath:NSTemporaryDirectory()] URLByAppendingPathComponent:@"TCNDayViewLayoutPerformanceTests.snapshot"];
+    XCTAssertTrue([[self snapshotOfLayout:layout key:key] writeToURL:fileURL error:NULL]);
+
+    // Compare with testPrepareLayoutWithBulkInput1000Events, which lays out the same events
+    [self measureBlock:^{
+        TCNDayViewLayoutSnapshot *const snapshot = [TCNDayViewLayoutSnapshot snapshotWithContentsOfURL:fileURL];
+        [layout prepareEventLayoutInSection:0 fromSnapshot:snapshot key:key completion:nil];
+        [layout prepareLayout];
+    }];
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:NULL];
+}
+
+- (void)testSnapshotLayoutMatchesMainThreadLayoutAtAnotherWidth {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    const TCNLayoutSnapshotKey key = [layout layoutSnapshotKeyForDate:[NSDate date] dataVersion:1];
+    TCNDayViewLayoutSnapshot *const snapshot = [self snapshotOfLayout:layout key:key];
+
+    // The snapshot was taken at 375 points wide
+    UICollectionView *const mainThreadCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    UICollectionView *const snapshotCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    mainThreadCollectionView.frame = CGRectMake(0, 0, 768, 1024);
+    snapshotCollectionView.frame = CGRectMake(0, 0, 768, 1024);
+    TCNDayViewLayout *const snapshotLayout = (TCNDayViewLayout *)snapshotCollectionView.collectionViewLayout;
+    [mainThreadCollectionView.collectionViewLayout prepareLayout];
+
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Snapshot verified"];
+    [snapshotLayout prepareEventLayoutInSection:0 fromSnapshot:snapshot key:key completion:^(TCNDayViewLayoutSnapshot *currentSnapshot, BOOL snapshotWasCurrent) {
+        XCTAssertNotNil(currentSnapshot);
+        XCTAssertTrue(snapshotWasCurrent);
+        [expectation fulfill];
+    }];
+
+    // The snapshot is shown before it is verified
+    [snapshotLayout prepareLayout];
+    [self assertLayout:snapshotLayout matchesLayout:(TCNDayViewLayout *)mainThreadCollectionView.collectionViewLayout itemCount:1000];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    [snapshotLayout prepareLayout];
+    [self assertLayout:snapshotLayout matchesLayout:(TCNDayViewLayout *)mainThreadCollectionView.collectionViewLayout itemCount:1000];
+}
+
+- (void)testStaleSnapshotIsReplacedByVerifiedLayout {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:200];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    const TCNLayoutSnapshotKey key = [layout layoutSnapshotKeyForDate:[NSDate date] dataVersion:1];
+    TCNDayViewLayoutSnapshot *const snapshot = [self snapshotOfLayout:layout key:key];
+
+    // A snapshot of the same number of events, each an hour later than it is now
+    NSMutableData *const staleRecordData = [NSMutableData dataWithBytes:snapshot.records length:(NSUInteger)snapshot.count * sizeof(TCNLayoutSnapshotRecord)];
+    TCNLayoutSnapshotRecord *const staleRecords = staleRecordData.mutableBytes;
+    for (NSInteger item = 0; item < snapshot.count; item++) {
+        staleRecords[item].minY += 88;
+    }
+    TCNDayViewLayoutSnapshot *const staleSnapshot = [TCNDayViewLayoutSnapshot snapshotWithKey:key records:staleRecords count:snapshot.count];
+
+    UICollectionView *const mainThreadCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    UICollectionView *const snapshotCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const snapshotLayout = (TCNDayViewLayout *)snapshotCollectionView.collectionViewLayout;
+    [mainThreadCollectionView.collectionViewLayout prepareLayout];
+
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Snapshot verified"];
+    [snapshotLayout prepareEventLayoutInSection:0 fromSnapshot:staleSnapshot key:key completion:^(TCNDayViewLayoutSnapshot *currentSnapshot, BOOL snapshotWasCurrent) {
+        XCTAssertFalse(snapshotWasCurrent);
+        XCTAssertEqual(currentSnapshot.count, (NSInteger)200);
+        XCTAssertTrue(TCNLayoutSnapshotRecordsEqual(currentSnapshot.records, snapshot.records, 200));
+        [expectation fulfill];
+    }];
+    [snapshotLayout prepareLayout];
+    NSIndexPath *const firstIndexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+    XCTAssertEqual(CGRectGetMinY([snapshotLayout layoutAttributesForItemAtIndexPath:firstIndexPath].frame),
+                   CGRectGetMinY([mainThreadCollectionView.collectionViewLayout layoutAttributesForItemAtIndexPath:firstIndexPath].frame) + 88);
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    [snapshotLayout prepareLayout];
+    [self assertLayout:snapshotLayout matchesLayout:(TCNDayViewLayout *)mainThreadCollectionView.collectionViewLayout itemCount:200];
+}
+
+- (void)testSnapshotWithAnotherKeyIsNotShown {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:200];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    TCNDayViewLayoutSnapshot *const snapshot = [self snapshotOfLayout:layout key:[layout layoutSnapshotKeyForDate:[NSDate date] dataVersion:1]];
+
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Snapshot verified"];
+    const TCNLayoutSnapshotKey newerKey = [layout layoutSnapshotKeyForDate:[NSDate date] dataVersion:2];
+    [layout prepareEventLayoutInSection:0 fromSnapshot:snapshot key:newerKey completion:^(TCNDayViewLayoutSnapshot *currentSnapshot, BOOL snapshotWasCurrent) {
+        XCTAssertFalse(snapshotWasCurrent);
+        XCTAssertTrue([currentSnapshot hasKey:newerKey]);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+#pragma mark - Resizing
+
+- (void)testResizeMatchesFullLayout {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const resizedCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    UICollectionView *const fullLayoutCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    [resizedCollectionView.collectionViewLayout prepareLayout];
+
+    // Like rotating from portrait to landscape
+    resizedCollectionView.frame = CGRectMake(0, 0, 667, 375);
+    [resizedCollectionView.collectionViewLayout invalidateLayoutWithContext:[resizedCollectionView.collectionViewLayout invalidationContextForBoundsChange:resizedCollectionView.bounds]];
+    [resizedCollectionView.collectionViewLayout prepareLayout];
+    fullLayoutCollectionView.frame = CGRectMake(0, 0, 667, 375);
+    [fullLayoutCollectionView.collectionViewLayout prepareLayout];
+
+    [self assertLayout:(TCNDayViewLayout *)resizedCollectionView.collectionViewLayout
+         matchesLayout:(TCNDayViewLayout *)fullLayoutCollectionView.collectionViewLayout
+             itemCount:1000];
+}
+
+- (void)testResize1000Events {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    UICollectionViewLayout *const layout = collectionView.collectionViewLayout;
+    [layout prepareLayout];
+
+    // Compare with testPrepareLayoutWithBulkInput1000Events, which lays out the same events from scratch
+    __block CGFloat width = 375;
+    [self measureBlock:^{
+        width = width == 375 ? 320 : 375;
+        collectionView.frame = CGRectMake(0, 0, width, 667);
+        [layout invalidateLayoutWithContext:[layout invalidationContextForBoundsChange:collectionView.bounds]];
+        [layout prepareLayout];
+    }];
+}
+
+#pragma mark - Dragging
+
+- (void)testDragMatchesFullLayout {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:100];
+    TCNDayViewLayoutPerformanceDelegate *const movedDelegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:100];
+    [movedDelegate setStartMinute:600 endMinute:660 forItem:0];
+    UICollectionView *const draggedCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    UICollectionView *const movedCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:movedDelegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)draggedCollectionView.collectionViewLayout;
+    [layout prepareLayout];
+    [movedCollectionView.collectionViewLayout prepareLayout];
+
+    NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+    [layout dragEventItemAtIndexPath:indexPath toStartMinute:600 endMinute:660];
+    [layout prepareLayout];
+    [self assertLayout:layout matchesLayout:(TCNDayViewLayout *)movedCollectionView.collectionViewLayout itemCount:100];
+
+    // The dragged item is hit where it is shown, not where it is cached
+    const CGRect draggedFrame = [layout layoutAttributesForItemAtIndexPath:indexPath].frame;
+    NSIndexPath *const hitIndexPath = [layout indexPathForEventItemAtPoint:CGPointMake(CGRectGetMidX(draggedFrame), CGRectGetMidY(draggedFrame))];
+    XCTAssertNotNil(hitIndexPath);
+    XCTAssertTrue(CGRectIntersectsRect([layout layoutAttributesForItemAtIndexPath:TCN_FORCE_UNWRAP(hitIndexPath)].frame, draggedFrame));
+
+    UICollectionView *const originalCollectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    [originalCollectionView.collectionViewLayout prepareLayout];
+    [layout endEventItemDrag];
+    [layout prepareLayout];
+    [self assertLayout:layout matchesLayout:(TCNDayViewLayout *)originalCollectionView.collectionViewLayout itemCount:100];
+}
+
+- (void)testDrag1000Events {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:1000];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    [layout prepareLayout];
+
+    // Each step of a drag through the day, as the day view asks for it every 15 minutes
+    NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+    __block NSInteger startMinute = 0;
+    [self measureBlock:^{
+        startMinute = (startMinute + 15) % (23 * 60);
+        [layout dragEventItemAtIndexPath:indexPath toStartMinute:startMinute endMinute:startMinute + 60];
+        [layout prepareLayout];
+        [layout layoutAttributesForElementsInRect:collectionView.bounds];
+    }];
+    [layout endEventItemDrag];
+}
+
+#pragma mark - Multiple columns
+
+- (void)testPrepareLayoutWith200Columns {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutMultiColumnPerformanceDelegate alloc] initWithEventCount:100];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate columnWidth:150];
+    [self measureBlock:^{
+        [collectionView.collectionViewLayout invalidateLayout];
+        [collectionView.collectionViewLayout prepareLayout];
+    }];
+}
+
+- (void)testOnlyColumnsNearVisibleAreaAreLaidOut {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutMultiColumnPerformanceDelegate alloc] initWithEventCount:20];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate columnWidth:150];
+    UICollectionViewLayout *const layout = collectionView.collectionViewLayout;
+    [layout prepareLayout];
+
+    // The first 375 points show columns 0 to 2, and column 3 is laid out ahead of scrolling
+    const CGRect contentRect = {CGPointZero, layout.collectionViewContentSize};
+    NSMutableIndexSet *const laidOutSections = [[NSMutableIndexSet alloc] init];
+    for (UICollectionViewLayoutAttributes *attributes in [layout layoutAttributesForElementsInRect:contentRect]) {
+        [laidOutSections addIndex:(NSUInteger)attributes.indexPath.section];
+    }
+    XCTAssertEqualObjects(laidOutSections, [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, 4)]);
+
+    // Columns far away are laid out on demand, at the same position relative to their column
+    NSIndexPath *const nearIndexPath = [NSIndexPath indexPathForItem:0 inSection:0];
+    NSIndexPath *const farIndexPath = [NSIndexPath indexPathForItem:0 inSection:150];
+    const CGRect nearFrame = [layout layoutAttributesForItemAtIndexPath:nearIndexPath].frame;
+    const CGRect farFrame = [layout layoutAttributesForItemAtIndexPath:farIndexPath].frame;
+    XCTAssertTrue(CGRectEqualToRect(CGRectOffset(nearFrame, 150 * 150, 0), farFrame));
+}
+
+#pragma mark - Time scale
+
+- (void)testEdgeTimeViewsAreReturnedWhenZoomedOut {
+    TCNDayViewLayoutPerformanceDelegate *const delegate = [[TCNDayViewLayoutBulkPerformanceDelegate alloc] initWithEventCount:20];
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    TCNDayViewLayout *const layout = (TCNDayViewLayout *)collectionView.collectionViewLayout;
+    layout.timeScale = 0.5;
+    [layout prepareLayout];
+
+    // Hour labels keep their height when zoomed out, so only a few points of each reach into these rects
+    NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:12 inSection:0];
+    const CGRect timeViewFrame = TCN_FORCE_UNWRAP([layout layoutAttributesForSupplementaryViewOfKind:TCNDayViewTimeView.reuseIdentifier
+                                                                                           atIndexPath:indexPath]).frame;
+    const CGRect rectBelow = CGRectMake(0, CGRectGetMaxY(timeViewFrame) - 4, 375, 100);
+    const CGRect rectAbove = CGRectMake(0, CGRectGetMinY(timeViewFrame) + 4 - 100, 375, 100);
+    for (NSValue *rectValue in @[[NSValue valueWithCGRect:rectBelow], [NSValue valueWithCGRect:rectAbove]]) {
+        BOOL returnsTimeView = NO;
+        for (UICollectionViewLayoutAttributes *attributes in [layout layoutAttributesForElementsInRect:rectValue.CGRectValue]) {
+            XCTAssertTrue(CGRectIntersectsRect(attributes.frame, rectValue.CGRectValue));
+            if ([attributes.representedElementKind isEqualToString:TCNDayViewTimeView.reuseIdentifier] && [attributes.indexPath isEqual:indexPath]) {
+                returnsTimeView = YES;
+                XCTAssertTrue(CGRectEqualToRect(attributes.frame, timeViewFrame));
+            }
+        }
+        XCTAssertTrue(returnsTimeView);
+    }
+}
+
+#pragma mark - Helpers
+
+/**
+ Takes a snapshot of the first section of @c layout, waiting for it to be laid out in the background.
+ */
+- (nullable TCNDayViewLayoutSnapshot *)snapshotOfLayout:(nonnull TCNDayViewLayout *)layout key:(TCNLayoutSnapshotKey)key {
+    __block TCNDayViewLayoutSnapshot *snapshot = nil;
+    XCTestExpectation *const expectation = [self expectationWithDescription:@"Snapshot taken"];
+    [layout prepareEventLayoutInSection:0 fromSnapshot:nil key:key completion:^(TCNDayViewLayoutSnapshot *currentSnapshot, __unused BOOL snapshotWasCurrent) {
+        snapshot = currentSnapshot;
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertNotNil(snapshot);
+    return snapshot;
+}
+
+- (void)assertLayout:(nonnull TCNDayViewLayout *)layout matchesLayout:(nonnull TCNDayViewLayout *)otherLayout itemCount:(NSInteger)itemCount {
+    for (NSInteger item = 0; item < itemCount; item++) {
+        NSIndexPath *const indexPath = [NSIndexPath indexPathForItem:item inSection:0];
+        UICollectionViewLayoutAttributes *const attributes = [layout layoutAttributesForItemAtIndexPath:indexPath];
+        UICollectionViewLayoutAttributes *const otherAttributes = [otherLayout layoutAttributesForItemAtIndexPath:indexPath];
+        XCTAssertTrue(CGRectEqualToRect(attributes.frame, otherAttributes.frame));
+        XCTAssertEqual(attributes.zIndex, otherAttributes.zIndex);
+    }
+}
+
+- (void)measurePrepareLayoutWithDelegate:(nonnull TCNDayViewLayoutPerformanceDelegate *)delegate {
+    UICollectionView *const collectionView = [TCNDayViewLayoutPerformanceTests collectionViewWithDelegate:delegate];
+    [self measureBlock:^{
+        [collectionView.collectionViewLayout invalidateLayout];
+        [collectionView.collectionViewLayout prepareLayout];
+    }];
+}
+
++ (nonnull UICollectionView *)collectionViewWithDelegate:(nonnull TCNDayViewLayoutPerformanceDelegate *)delegate {
+    return [self collectionViewWithDelegate:delegate columnWidth:0];
+}
+
++ (nonnull UICollectionView *)collectionViewWithDelegate:(nonnull TCNDayViewLayoutPerformanceDelegate *)delegate columnWidth:(CGFloat)columnWidth {
+    TCNDayViewLayout *const layout = [[TCNDayViewLayout alloc] initWithConfig:[[TCNDayViewConfig alloc] init]];
+    layout.delegate = delegate;
+    layout.columnWidth = columnWidth;
+    UICollectionView *const collectionView = [[UICollectionView alloc] initWithFrame:CGRectMake(0, 0, 375, 667) collectionViewLayout:layout];
+    collectionView.dataSource = delegate;
+    [collectionView reloadData];
+    return collectionView;
+}
+
+@end
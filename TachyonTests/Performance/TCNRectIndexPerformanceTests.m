@@ -0,0 +1,161 @@
+#import <UIKit/UIKit.h>
+#import <XCTest/XCTest.h>
+
+#import "TCNRectIndex.h"
+
+@interface TCNRectIndexPerformanceTests : XCTestCase
+
+@end
+
+/**
+ Compares the linear @c NSPredicate filter that @c TCNDayViewLayout used to answer @c layoutAttributesForElementsInRect:
+ with the @c TCNRectIndex that replaced it. Nothing here needs a collection view or a window.
+
+ Each measurement issues one query per scroll step across a full day, as a vertical scroll would.
+ */
+@implementation TCNRectIndexPerformanceTests
+
+static const CGFloat DayHeight = 2152.0f;
+static const CGFloat ViewportHeight = 667.0f;
+static const CGFloat ViewportWidth = 375.0f;
+static const CGFloat ScrollStep = 8.0f;
+static const NSInteger StaticAttributesCount = 73;
+static const uint32_t Seed = 42;
+
+#pragma mark - Linear filter
+
+- (void)testLinearFilter10Events {
+    [self measureLinearFilterWithEventCount:10];
+}
+
+- (void)testLinearFilter100Events {
+    [self measureLinearFilterWithEventCount:100];
+}
+
+- (void)testLinearFilter1000Events {
+    [self measureLinearFilterWithEventCount:1000];
+}
+
+- (void)testLinearFilter10000Events {
+    [self measureLinearFilterWithEventCount:10000];
+}
+
+#pragma mark - Index
+
+- (void)testIndex10Events {
+    [self measureIndexWithEventCount:10];
+}
+
+- (void)testIndex100Events {
+    [self measureIndexWithEventCount:100];
+}
+
+- (void)testIndex1000Events {
+    [self measureIndexWithEventCount:1000];
+}
+
+- (void)testIndex10000Events {
+    [self measureIndexWithEventCount:10000];
+}
+
+- (void)testIndexMatchesLinearFilter {
+    NSArray<UICollectionViewLayoutAttributes *> *const attributes = [TCNRectIndexPerformanceTests attributesWithEventCount:500];
+    TCNRectIndex *const index = [TCNRectIndexPerformanceTests indexForAttributes:attributes];
+
+    for (CGFloat offset = -ViewportHeight; offset < DayHeight; offset += ViewportHeight / 3) {
+        const CGRect rect = CGRectMake(0, offset, ViewportWidth, ViewportHeight);
+        NSSet *const expected = [NSSet setWithArray:[TCNRectIndexPerformanceTests linearFilterAttributes:attributes inRect:rect]];
+        NSSet *const actual = [NSSet setWithArray:[TCNRectIndexPerformanceTests indexedAttributes:attributes index:index inRect:rect]];
+        XCTAssertEqualObjects(expected, actual);
+    }
+
+    TCNRectIndexDestroy(index);
+}
+
+#pragma mark - Measurement
+
+- (void)measureLinearFilterWithEventCount:(NSInteger)eventCount {
+    NSArray<UICollectionViewLayoutAttributes *> *const attributes = [TCNRectIndexPerformanceTests attributesWithEventCount:eventCount];
+    [self measureBlock:^{
+        for (CGFloat offset = 0; offset + ViewportHeight <= DayHeight; offset += ScrollStep) {
+            [TCNRectIndexPerformanceTests linearFilterAttributes:attributes inRect:CGRectMake(0, offset, ViewportWidth, ViewportHeight)];
+        }
+    }];
+}
+
+- (void)measureIndexWithEventCount:(NSInteger)eventCount {
+    NSArray<UICollectionViewLayoutAttributes *> *const attributes = [TCNRectIndexPerformanceTests attributesWithEventCount:eventCount];
+    TCNRectIndex *const index = [TCNRectIndexPerformanceTests indexForAttributes:attributes];
+    [self measureBlock:^{
+        for (CGFloat offset = 0; offset + ViewportHeight <= DayHeight; offset += ScrollStep) {
+            [TCNRectIndexPerformanceTests indexedAttributes:attributes index:index inRect:CGRectMake(0, offset, ViewportWidth, ViewportHeight)];
+        }
+    }];
+    TCNRectIndexDestroy(index);
+}
+
+#pragma mark - Helpers
+
+/**
+ A day's worth of static time view and gridline frames, plus @c eventCount events of 30 to 180 minutes at random times.
+ */
++ (nonnull NSArray<UICollectionViewLayoutAttributes *> *)attributesWithEventCount:(NSInteger)eventCount {
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const attributes = [[NSMutableArray alloc] init];
+    for (NSInteger item = 0; item < StaticAttributesCount; item++) {
+        UICollectionViewLayoutAttributes *const gridlineAttributes =
+        [UICollectionViewLayoutAttributes layoutAttributesForDecorationViewOfKind:@"Gridline"
+                                                                    withIndexPath:[NSIndexPath indexPathForItem:item inSection:0]];
+        gridlineAttributes.frame = CGRectMake(56, 20 + (item * 44), ViewportWidth - 56, 1);
+        [attributes addObject:gridlineAttributes];
+    }
+
+    srand48(Seed);
+    for (NSInteger item = 0; item < eventCount; item++) {
+        UICollectionViewLayoutAttributes *const eventAttributes =
+        [UICollectionViewLayoutAttributes layoutAttributesForCellWithIndexPath:[NSIndexPath indexPathForItem:item inSection:0]];
+        const CGFloat minY = 20 + (CGFloat)(drand48() * (DayHeight - 64));
+        const CGFloat height = 44 + (CGFloat)(drand48() * 220);
+        eventAttributes.frame = CGRectMake(58, minY, ViewportWidth - 62, height);
+        [attributes addObject:eventAttributes];
+    }
+    return attributes;
+}
+
++ (nonnull TCNRectIndex *)indexForAttributes:(nonnull NSArray<UICollectionViewLayoutAttributes *> *)attributes {
+    TCNRectIndexRect *const rects = malloc(attributes.count * sizeof(TCNRectIndexRect));
+    [attributes enumerateObjectsUsingBlock:^(UICollectionViewLayoutAttributes *layoutAttributes, NSUInteger index, __unused BOOL *stop) {
+        const CGRect frame = layoutAttributes.frame;
+        rects[index] = (TCNRectIndexRect){CGRectGetMinX(frame), CGRectGetMinY(frame), CGRectGetMaxX(frame), CGRectGetMaxY(frame)};
+    }];
+    TCNRectIndex *const index = TCNRectIndexCreate(rects, attributes.count);
+    free(rects);
+    return index;
+}
+
++ (nonnull NSArray<UICollectionViewLayoutAttributes *> *)linearFilterAttributes:(nonnull NSArray<UICollectionViewLayoutAttributes *> *)attributes
+                                                                         inRect:(CGRect)rect {
+    NSPredicate *const predicate =
+    [NSPredicate predicateWithBlock:^BOOL(UICollectionViewLayoutAttributes *layoutAttributes, __unused NSDictionary *bindings) {
+        return CGRectIntersectsRect(rect, layoutAttributes.frame);
+    }];
+    return [attributes filteredArrayUsingPredicate:predicate];
+}
+
++ (nonnull NSArray<UICollectionViewLayoutAttributes *> *)indexedAttributes:(nonnull NSArray<UICollectionViewLayoutAttributes *> *)attributes
+                                                                     index:(nonnull TCNRectIndex *)index
+                                                                    inRect:(CGRect)rect {
+    uint32_t *const candidates = malloc(TCNRectIndexCount(index) * sizeof(uint32_t));
+    const TCNRectIndexRect queryRect = {CGRectGetMinX(rect), CGRectGetMinY(rect), CGRectGetMaxX(rect), CGRectGetMaxY(rect)};
+    const size_t candidateCount = TCNRectIndexQuery(index, queryRect, candidates);
+    NSMutableArray<UICollectionViewLayoutAttributes *> *const visibleAttributes = [[NSMutableArray alloc] initWithCapacity:candidateCount];
+    for (size_t candidate = 0; candidate < candidateCount; candidate++) {
+        UICollectionViewLayoutAttributes *const layoutAttributes = attributes[candidates[candidate]];
+        if (CGRectIntersectsRect(rect, layoutAttributes.frame)) {
+            [visibleAttributes addObject:layoutAttributes];
+        }
+    }
+    free(candidates);
+    return visibleAttributes;
+}
+
+@end
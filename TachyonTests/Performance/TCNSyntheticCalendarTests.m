@@ -0,0 +1,79 @@
+#import <XCTest/XCTest.h>
+
+#import "TCNSyntheticCalendar.h"
+
+@interface TCNSyntheticCalendarTests : XCTestCase
+
+@end
+
+/**
+ The synthetic calendars that TachyonBenchmarks lays out. Benchmark results are only comparable if every run lays out
+ the same events, so these check that a seed always gives the same calendar and that each profile has its shape.
+ */
+@implementation TCNSyntheticCalendarTests
+
+static const uint64_t Seed = 42;
+
+- (void)testSameSeedGeneratesSameDay {
+    for (int profile = 0; profile < TCNSyntheticCalendarProfileCount; profile++) {
+        const size_t maximumCount = TCNSyntheticCalendarProfileMaximumEventCount((TCNSyntheticCalendarProfile)profile);
+        TCNEventGeometryInput *const inputs = malloc(maximumCount * sizeof(TCNEventGeometryInput));
+        TCNEventGeometryInput *const otherInputs = malloc(maximumCount * sizeof(TCNEventGeometryInput));
+
+        const size_t count = TCNSyntheticCalendarGenerateDay((TCNSyntheticCalendarProfile)profile, Seed, 3, inputs);
+        XCTAssertEqual(TCNSyntheticCalendarGenerateDay((TCNSyntheticCalendarProfile)profile, Seed, 3, otherInputs), count);
+        XCTAssertLessThanOrEqual(count, maximumCount);
+        for (size_t i = 0; i < count; i++) {
+            XCTAssertEqual(inputs[i].startMinute, otherInputs[i].startMinute);
+            XCTAssertEqual(inputs[i].endMinute, otherInputs[i].endMinute);
+            XCTAssertEqual(inputs[i].shouldAdjustLayout, otherInputs[i].shouldAdjustLayout);
+            XCTAssertGreaterThanOrEqual(inputs[i].startMinute, 0);
+            XCTAssertLessThan(inputs[i].startMinute, inputs[i].endMinute);
+            XCTAssertLessThanOrEqual(inputs[i].endMinute, 24 * 60);
+        }
+
+        free(inputs);
+        free(otherInputs);
+    }
+}
+
+- (void)testDaysAndSeedsDiffer {
+    TCNEventGeometryInput inputs[60];
+    TCNEventGeometryInput otherDayInputs[60];
+    TCNEventGeometryInput otherSeedInputs[60];
+    TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfileHeavyOverlap, Seed, 0, inputs);
+    TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfileHeavyOverlap, Seed, 1, otherDayInputs);
+    TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfileHeavyOverlap, Seed + 1, 0, otherSeedInputs);
+    XCTAssertNotEqual(memcmp(inputs, otherDayInputs, sizeof(inputs)), 0);
+    XCTAssertNotEqual(memcmp(inputs, otherSeedInputs, sizeof(inputs)), 0);
+}
+
+- (void)testBackToBackEventsDontOverlap {
+    TCNEventGeometryInput inputs[24];
+    const size_t count = TCNSyntheticCalendarGenerateDay(TCNSyntheticCalendarProfileBackToBack, Seed, 0, inputs);
+    XCTAssertEqual(count, 24u);
+
+    TCNOverlapInterval intervals[24];
+    TCNOverlapPlacement placements[24];
+    for (size_t i = 0; i < count; i++) {
+        intervals[i] = (TCNOverlapInterval){(double)inputs[i].startMinute, (double)inputs[i].endMinute};
+    }
+    XCTAssertEqual(TCNOverlapEngineComputePlacements(intervals, count, placements), 0);
+    for (size_t i = 0; i < count; i++) {
+        XCTAssertEqual(placements[i].columnCount, 1u);
+    }
+}
+
+- (void)testProfileNames {
+    for (int profile = 0; profile < TCNSyntheticCalendarProfileCount; profile++) {
+        TCNSyntheticCalendarProfile namedProfile;
+        XCTAssertEqual(TCNSyntheticCalendarProfileWithName(TCNSyntheticCalendarProfileName((TCNSyntheticCalendarProfile)profile), &namedProfile), 0);
+        XCTAssertEqual((int)namedProfile, profile);
+    }
+
+    TCNSyntheticCalendarProfile namedProfile;
+    XCTAssertEqual(TCNSyntheticCalendarProfileWithName("busy", &namedProfile), -1);
+    XCTAssertEqual(TCNSyntheticCalendarProfileMaximumEventCount(TCNSyntheticCalendarProfileStress), 10000u);
+}
+
+@end